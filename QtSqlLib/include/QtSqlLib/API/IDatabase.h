@@ -1,11 +1,16 @@
 #pragma once
 
+#include <QtSqlLib/DatabaseOptions.h>
 #include <QtSqlLib/ResultSet.h>
 #include <QtSqlLib/ResultSetPrinter.h>
+#include <QtSqlLib/RowBlock.h>
 
 #include <QSqlDatabase>
 #include <QString>
 
+#include <future>
+#include <memory>
+
 namespace QtSqlLib::API
 {
 
@@ -21,9 +26,14 @@ public:
   virtual void initialize(
     ISchemaConfigurator& schemaConfigurator, const QString& fileName,
     const QString& databaseName = QSqlDatabase::defaultConnection) = 0;
+  virtual void initialize(
+    ISchemaConfigurator& schemaConfigurator, const QString& fileName, const DatabaseOptions& options,
+    const QString& databaseName = QSqlDatabase::defaultConnection) = 0;
   virtual void close() = 0;
 
   virtual ResultSet execQuery(IQueryElement& query) = 0;
+  // the rows are fetched by the executor thread, which owns the connection of the query
+  virtual std::future<RowBlock> execQueryAsync(std::unique_ptr<IQueryElement> query) = 0;
   virtual ResultSetPrinter createResultSetPrinter(ResultSet& resultSet, int maxColumnWidth = 24) const = 0;
 
 };
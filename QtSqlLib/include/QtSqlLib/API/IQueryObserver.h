@@ -0,0 +1,50 @@
+#pragma once
+
+#include <QString>
+#include <QVariant>
+
+#include <chrono>
+#include <memory>
+#include <vector>
+
+namespace QtSqlLib::API
+{
+
+class IQueryObserver
+{
+public:
+  struct QueryExecution
+  {
+    QString sqlQuery;
+    QVariantList boundValues;
+    bool isBatch = false;
+    QString errorText;
+
+    std::chrono::nanoseconds prepareDuration { 0 };
+    std::chrono::nanoseconds execDuration { 0 };
+    std::chrono::nanoseconds resultsDuration { 0 };
+
+    int numRowsAffected = -1;
+  };
+
+  struct ResultIteration
+  {
+    QString sqlQuery;
+    std::chrono::nanoseconds iterationDuration { 0 };
+
+    int numRowsFetched = 0;
+    int numTuplesReturned = 0;
+    int numJoinedTuplesReturned = 0;
+  };
+
+  IQueryObserver() = default;
+  virtual ~IQueryObserver() = default;
+
+  virtual void onQueryExecuted(const QueryExecution& execution) = 0;
+  virtual void onResultIterationFinished(const ResultIteration& iteration) = 0;
+
+};
+
+using QueryObservers = std::vector<std::shared_ptr<IQueryObserver>>;
+
+}
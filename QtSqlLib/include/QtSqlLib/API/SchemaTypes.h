@@ -93,9 +93,16 @@ struct QueryMetaInfo
 {
   API::IID::Type tableId = 0;
   std::optional<API::IID::Type> relationshipId;
+
+  // relationship of the join the tuple is joined to, std::nullopt for the queried table
+  std::optional<API::IID::Type> parentRelationshipId;
+
   ColumnHelper::SelectColumnList columns;
   std::vector<size_t> columnQueryIndices;
   std::vector<size_t> primaryKeyColumnIndices;
+
+  // maps column ids to query indices, -1 if not selected
+  std::vector<int> columnIdQueryIndices;
 };
 
 }
@@ -31,6 +31,14 @@ public:
     QString alias;
   };
 
+  struct Parameter
+  {
+    Parameter();
+    explicit Parameter(const QString& name);
+
+    QString name;
+  };
+
   struct SelectColumn
   {
     SelectColumn();
@@ -101,6 +109,7 @@ public:
   };
 
   using ColumnList = std::vector<API::IID::Type>;
+  using RelationshipPath = std::vector<API::IID::Type>;
   using SelectColumnList = std::vector<SelectColumn>;
   using GroupColumnList = std::vector<GroupColumn>;
   using OrderColumnList = std::vector<OrderColumn>;
@@ -243,3 +252,4 @@ private:
 
 Q_DECLARE_METATYPE(QtSqlLib::ColumnHelper::ColumnData);
 Q_DECLARE_METATYPE(QtSqlLib::ColumnHelper::ColumnAlias);
+Q_DECLARE_METATYPE(QtSqlLib::ColumnHelper::Parameter);
@@ -0,0 +1,44 @@
+#pragma once
+
+#include <QtSqlLib/EComparisonOperator.h>
+
+#include <QVariant>
+
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+namespace QtSqlLib
+{
+
+class ColumnBuffer;
+
+class ColumnKernels
+{
+public:
+  // bit i of word i / 64 is set if row i is selected
+  using Selection = std::vector<uint64_t>;
+
+  ColumnKernels() = delete;
+
+  static Selection filter(
+    const ColumnBuffer& column, EComparisonOperator op, const QVariant& value,
+    const Selection* selection = nullptr);
+
+  static Selection selectAll(size_t numRows);
+  static Selection intersect(const Selection& lhs, const Selection& rhs);
+  static size_t numSelected(const Selection& selection);
+
+  static size_t count(const ColumnBuffer& column, const Selection* selection = nullptr);
+
+  static int64_t sumInt64(const ColumnBuffer& column, const Selection* selection = nullptr);
+  static double sumDouble(const ColumnBuffer& column, const Selection* selection = nullptr);
+
+  static std::optional<int64_t> minInt64(const ColumnBuffer& column, const Selection* selection = nullptr);
+  static std::optional<int64_t> maxInt64(const ColumnBuffer& column, const Selection* selection = nullptr);
+  static std::optional<double> minDouble(const ColumnBuffer& column, const Selection* selection = nullptr);
+  static std::optional<double> maxDouble(const ColumnBuffer& column, const Selection* selection = nullptr);
+
+};
+
+}
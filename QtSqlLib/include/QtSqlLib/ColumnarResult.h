@@ -0,0 +1,141 @@
+#pragma once
+
+#include <QtSqlLib/API/IID.h>
+#include <QtSqlLib/API/SchemaTypes.h>
+#include <QtSqlLib/ID.h>
+
+#include <QByteArray>
+#include <QString>
+#include <QVariant>
+
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+namespace QtSqlLib
+{
+
+class ResultSet;
+class TupleView;
+
+class ColumnBuffer
+{
+public:
+  enum class Type
+  {
+    Null,
+    Int64,
+    Double,
+    Text,
+    Blob
+  };
+
+  ColumnBuffer(const std::optional<API::IID::Type>& columnId, const QString& alias);
+
+  std::optional<API::IID::Type> columnId() const;
+  const QString& alias() const;
+  Type type() const;
+  size_t size() const;
+
+  bool isNull(size_t row) const;
+  int64_t int64At(size_t row) const;
+  double doubleAt(size_t row) const;
+  QString textAt(size_t row) const;
+  QByteArray blobAt(size_t row) const;
+
+  // bit i of word i / 64 is set if row i is not null
+  const std::vector<uint64_t>& validityBitmap() const;
+  const std::vector<int64_t>& int64Values() const;
+  const std::vector<double>& doubleValues() const;
+
+  // text (UTF-8) and blob values of row i are stored at data()[offsets()[i]] to data()[offsets()[i + 1]]
+  const std::vector<int64_t>& offsets() const;
+  const QByteArray& data() const;
+
+private:
+  friend class ColumnarTable;
+
+  std::optional<API::IID::Type> m_columnId;
+  QString m_alias;
+  Type m_type;
+  size_t m_size;
+
+  std::vector<uint64_t> m_validityBitmap;
+  std::vector<int64_t> m_int64Values;
+  std::vector<double> m_doubleValues;
+  std::vector<int64_t> m_offsets;
+  QByteArray m_data;
+
+  void append(const QVariant& value);
+  void initializeType(Type type);
+  void throwIfOutOfRange(size_t row) const;
+
+};
+
+class ColumnarTable
+{
+public:
+  explicit ColumnarTable(const API::QueryMetaInfo& queryMetaInfo);
+
+  API::IID::Type tableId() const;
+  std::optional<API::IID::Type> relationshipId() const;
+  std::optional<API::IID::Type> parentRelationshipId() const;
+  size_t numRows() const;
+
+  const std::vector<ColumnBuffer>& columns() const;
+
+  template <typename T>
+  const ColumnBuffer& column(const T& columnId) const
+  {
+    return columnIntern(QtSqlLib::ID<T>(columnId));
+  }
+
+  // rows of joined tables refer to the row of the tuple they were joined to, which is a row of the queried tuples or,
+  // for nested joins, of the table joined by the parent relationship
+  const std::vector<size_t>& parentRows() const;
+
+private:
+  friend class ColumnarResult;
+
+  API::IID::Type m_tableId;
+  std::optional<API::IID::Type> m_relationshipId;
+  std::optional<API::IID::Type> m_parentRelationshipId;
+  size_t m_numRows;
+
+  std::vector<ColumnBuffer> m_columns;
+  std::vector<size_t> m_parentRows;
+
+  const ColumnBuffer& columnIntern(const API::IID& columnId) const;
+
+  size_t append(const TupleView& tuple, const std::optional<size_t>& parentRow);
+
+};
+
+class ColumnarResult
+{
+public:
+  ColumnarResult(const API::QueryMetaInfo& queryMetaInfo, const std::vector<API::QueryMetaInfo>& joinMetaInfos);
+
+  const ColumnarTable& tuples() const;
+  const std::vector<ColumnarTable>& joins() const;
+
+  template <typename T>
+  const ColumnarTable& joinedTuples(const T& relationshipId) const
+  {
+    return joinedTuplesIntern(QtSqlLib::ID<T>(relationshipId));
+  }
+
+private:
+  friend class ResultSet;
+
+  ColumnarTable m_tuples;
+  std::vector<ColumnarTable> m_joins;
+
+  const ColumnarTable& joinedTuplesIntern(const API::IID& relationshipId) const;
+
+  size_t appendTuple(const TupleView& tuple);
+  size_t appendJoinedTuple(size_t joinIndex, const TupleView& tuple, size_t parentRow);
+
+};
+
+}
@@ -1,10 +1,18 @@
 #pragma once
 
 #include <QtSqlLib/API/IDatabase.h>
+#include <QtSqlLib/API/IQueryObserver.h>
+#include <QtSqlLib/Query/CompiledQuery.h>
+#include <QtSqlLib/QueryPlan.h>
+#include <QtSqlLib/StatementCache.h>
+#include <QtSqlLib/Transaction.h>
 
 #include <QSqlDatabase>
 
+#include <map>
 #include <memory>
+#include <mutex>
+#include <thread>
 
 namespace QtSqlLib::API
 {
@@ -12,9 +20,18 @@ class ISchema;
 class ISchemaConfigurator;
 }
 
+namespace QtSqlLib::Query
+{
+class FromTable;
+}
+
 namespace QtSqlLib
 {
 
+class ConnectionPool;
+class QueryExecutor;
+class QueryPlanDiagnostics;
+
 class Database : public API::IDatabase
 {
 public:
@@ -24,22 +41,91 @@ public:
   void initialize(
     API::ISchemaConfigurator& schemaConfigurator, const QString& fileName,
     const QString& databaseName = QSqlDatabase::defaultConnection) override;
+  void initialize(
+    API::ISchemaConfigurator& schemaConfigurator, const QString& fileName, const DatabaseOptions& options,
+    const QString& databaseName = QSqlDatabase::defaultConnection) override;
+  // waits for threads other than the calling one to release their pooled connections or to exit. Throws if they
+  // do not within the acquire timeout of the pool.
   void close() override;
 
   ResultSet execQuery(API::IQueryElement& query) override;
+  std::future<RowBlock> execQueryAsync(std::unique_ptr<API::IQueryElement> query) override;
+
+  Transaction beginTransaction();
+
+  Query::CompiledQuery compile(Query::FromTable& query) const;
   ResultSetPrinter createResultSetPrinter(ResultSet& resultSet, int maxColumnWidth) const override;
 
+  // closes the current pool, so that the same restrictions as for close() apply
+  void setConnectionPoolSize(int maxConnections, int acquireTimeoutMs = 30000);
+  int getConnectionPoolSize() const;
+  void releaseThreadConnection();
+
+  void setNumAsyncExecutorThreads(int numThreads);
+  int getNumAsyncExecutorThreads() const;
+
+  void setStatementCacheCapacity(int capacity);
+  StatementCache::Statistics getStatementCacheStatistics() const;
+
+  bool isReturningSupported() const;
+
+  void applyOptions(const DatabaseOptions& options);
+  DatabaseOptions getOptions() const;
+
+  void registerProfile(const QString& name, const DatabaseOptions& options);
+  void applyProfile(const QString& name);
+
+  void registerQueryObserver(const std::shared_ptr<API::IQueryObserver>& observer);
+  void unregisterQueryObserver(const std::shared_ptr<API::IQueryObserver>& observer);
+
+  void setQueryPlanDiagnosticsEnabled(bool enabled);
+  bool isQueryPlanDiagnosticsEnabled() const;
+  std::vector<QueryPlan> getQueryPlans() const;
+  void clearQueryPlans();
+
 private:
   std::unique_ptr<QSqlDatabase> m_db;
   std::unique_ptr<API::ISchema> m_schema;
+  mutable std::mutex m_connectionPoolMutex;
+  std::shared_ptr<ConnectionPool> m_connectionPool;
+  std::unique_ptr<QueryExecutor> m_queryExecutor;
+  std::shared_ptr<ConnectionPool> m_queryExecutorConnectionPool;
+  std::mutex m_queryExecutorMutex;
 
   QString m_databaseName;
+  QString m_fileName;
+  std::thread::id m_ownerThreadId;
+
+  int m_connectionPoolSize;
+  int m_connectionPoolAcquireTimeoutMs;
+  int m_numAsyncExecutorThreads;
+  int m_statementCacheCapacity;
+
+  mutable std::mutex m_optionsMutex;
+  DatabaseOptions m_options;
+  std::map<QString, DatabaseOptions> m_profiles;
+  int m_optionsGeneration;
+  mutable int m_dbOptionsGeneration;
+
+  mutable std::mutex m_queryObserversMutex;
+  std::shared_ptr<const API::QueryObservers> m_queryObservers;
+
+  std::unique_ptr<QueryPlanDiagnostics> m_queryPlanDiagnostics;
 
   void loadDatabaseFile(const QString& filename);
   int  queryDatabaseVersion();
   void createOrMigrateTables(int currentVersion = 1);
 
-  ResultSet execQueryForSchema(API::ISchema& schema, API::IQueryElement& query) const;
+  std::shared_ptr<ConnectionPool> makeConnectionPool(const QString& poolName, int maxConnections);
+  void createConnectionPool();
+  void closeConnectionPool();
+  std::shared_ptr<ConnectionPool> getConnectionPool() const;
+  void stopQueryExecutor();
+  QueryExecutor& getQueryExecutor(std::shared_ptr<ConnectionPool>& connectionPool);
+  QSqlDatabase& getThreadConnection() const;
+  std::shared_ptr<const API::QueryObservers> getQueryObservers() const;
+
+  ResultSet execQueryForSchema(QSqlDatabase& db, API::ISchema& schema, API::IQueryElement& query) const;
 
   bool isVersionTableExisting() const;
 
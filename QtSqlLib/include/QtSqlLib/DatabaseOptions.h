@@ -0,0 +1,66 @@
+#pragma once
+
+#include <QString>
+#include <QtGlobal>
+
+#include <optional>
+
+namespace QtSqlLib
+{
+
+struct DatabaseOptions
+{
+  enum class JournalMode
+  {
+    Delete,
+    Truncate,
+    Persist,
+    Memory,
+    Wal,
+    Off
+  };
+
+  enum class Synchronous
+  {
+    Off,
+    Normal,
+    Full,
+    Extra
+  };
+
+  enum class TempStore
+  {
+    Default,
+    File,
+    Memory
+  };
+
+  enum class AutoVacuum
+  {
+    None,
+    Full,
+    Incremental
+  };
+
+  static const QString bulkLoadProfileName;
+  static const QString oltpProfileName;
+
+  static DatabaseOptions bulkLoadProfile();
+  static DatabaseOptions oltpProfile();
+
+  DatabaseOptions& merge(const DatabaseOptions& other);
+
+  // runtime options, applied to every connection
+  std::optional<JournalMode> journalMode;
+  std::optional<Synchronous> synchronous;
+  std::optional<int> cacheSize;
+  std::optional<qint64> mmapSize;
+  std::optional<TempStore> tempStore;
+  std::optional<int> busyTimeoutMs;
+
+  // creation options, only applied when the database file is created
+  std::optional<int> pageSize;
+  std::optional<AutoVacuum> autoVacuum;
+};
+
+}
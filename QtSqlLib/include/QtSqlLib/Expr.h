@@ -34,6 +34,7 @@ public:
   virtual ~Expr();
 
   bool isEmpty() const;
+  bool hasRelationshipColumns() const;
 
   template <typename TLeft, typename TRight>
   Expr& equal(TLeft&& lhs, TRight&& rhs)
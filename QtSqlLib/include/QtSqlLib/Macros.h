@@ -47,6 +47,7 @@
 #define IN(A, B) opIn(A, QVariant(B))
 
 #define ALIAS(A) QtSqlLib::ColumnHelper::ColumnAlias(A)
+#define PARAM(A) QVariant::fromValue(QtSqlLib::ColumnHelper::Parameter(A))
 
 #define OR opOr()
 #define AND opAnd()
@@ -60,17 +61,32 @@
 #define INSERT_INTO(X) QtSqlLib::Query::InsertInto(QtSqlLib::ID(X))
 #define INSERT_INTO_EXT(X) QtSqlLib::Query::InsertIntoExt(QtSqlLib::ID(X))
 #define BATCH_INSERT_INTO(X) QtSqlLib::Query::BatchInsertInto(QtSqlLib::ID(X))
+#define BATCH_INSERT_INTO_EXT(X) QtSqlLib::Query::BatchInsertIntoExt(QtSqlLib::ID(X))
+#define UPSERT(X) QtSqlLib::Query::Upsert(QtSqlLib::ID(X))
+#define BATCH_UPSERT(X) QtSqlLib::Query::BatchUpsert(QtSqlLib::ID(X))
 #define FROM_TABLE(X) QtSqlLib::Query::FromTable(QtSqlLib::ID(X))
 #define UPDATE_TABLE(X) QtSqlLib::Query::UpdateTable(QtSqlLib::ID(X))
+#define BATCH_UPDATE_TABLE(X) QtSqlLib::Query::BatchUpdateTable(QtSqlLib::ID(X))
 #define DELETE_FROM(X) QtSqlLib::Query::DeleteFrom(QtSqlLib::ID(X))
 #define LINK_TUPLES(X) QtSqlLib::Query::LinkTuples(QtSqlLib::ID(X))
 #define UNLINK_TUPLES(X) QtSqlLib::Query::UnlinkTuples(QtSqlLib::ID(X))
 
 #define VALUES(X, Y) values(QtSqlLib::ID(X), Y)
 #define VALUE(X, Y) value(QtSqlLib::ID(X), Y)
+#define KEY_VALUES(X, Y) keyValues(QtSqlLib::ID(X), Y)
+#define USE_STAGING_TABLE useStagingTable()
 
 #define SET(X, Y) set(QtSqlLib::ID(X), Y)
 
+#define ON_CONFLICT_PRIMARY_KEY onConflictPrimaryKey()
+#define ON_CONFLICT_UNIQUE_COLS onConflictUniqueCols()
+#define KEEP(X) keep(QtSqlLib::ID(X))
+#define OVERWRITE(X) overwrite(QtSqlLib::ID(X))
+#define OVERWRITE_IF(X, Y) overwriteIf(QtSqlLib::ID(X), QtSqlLib::Expr().Y)
+#define EXCLUDED(X) QtSqlLib::ColumnHelper::ColumnData(QtSqlLib::Query::ConflictClause::excludedRelationshipId, X)
+#define DO_NOTHING doNothing()
+#define BIND(X, Y) bind(X, Y)
+
 #define WHERE(X) where(QtSqlLib::Expr().X)
 #define HAVING(X) having(QtSqlLib::Expr().X)
 
@@ -88,6 +104,14 @@
 #define ORDER_BY(...) orderBy(QtSqlLib::ColumnHelper::make<QtSqlLib::ColumnHelper::OrderColumn>(__VA_ARGS__))
 #define ORDER_BY_NOCASE(...) orderBy(QtSqlLib::ColumnHelper::make<QtSqlLib::ColumnHelper::OrderColumn>(__VA_ARGS__), true)
 
+#define LIMIT(X) limit(X)
+#define OFFSET(X) offset(X)
+#define AFTER(X) after(X)
+#define BEFORE(X) before(X)
+
+#define STREAMING streaming()
+#define SPLIT_JOINS splitJoins()
+
 #define ASC ,QtSqlLib::ColumnHelper::EOrder::Ascending
 #define DESC ,QtSqlLib::ColumnHelper::EOrder::Descending
 
@@ -105,6 +129,10 @@
 #define JOIN_ALL(X) joinAll(QtSqlLib::ID(X))
 #define JOIN(X, ...) join(QtSqlLib::ID(X), QtSqlLib::ColumnHelper::make<QtSqlLib::ColumnHelper::SelectColumn>(__VA_ARGS__))
 
+#define REL_PATH(...) QtSqlLib::ColumnHelper::make<QtSqlLib::API::IID::Type>(__VA_ARGS__)
+#define JOIN_ALL_PATH(...) joinAll(REL_PATH(__VA_ARGS__))
+#define JOIN_PATH(X, ...) join(X, QtSqlLib::ColumnHelper::make<QtSqlLib::ColumnHelper::SelectColumn>(__VA_ARGS__))
+
 #define LINK_TO_ONE_TUPLE(X, Y) linkToOneTuple(QtSqlLib::ID(X), Y)
 #define LINK_TO_MANY_TUPLES(X, ...) linkToManyTuples(QtSqlLib::ID(X), __VA_ARGS__)
 
@@ -4,6 +4,10 @@
 
 #include <QVariant>
 
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <vector>
 
 namespace QtSqlLib
@@ -22,12 +26,28 @@ public:
     API::IID::Type tableId,
     std::vector<ColumnValue>&& values);
 
+  template <typename TColumnValueFunc>
+  explicit PrimaryKey(
+    API::IID::Type tableId,
+    size_t numValues,
+    TColumnValueFunc&& columnValueFunc) :
+    PrimaryKey(tableId)
+  {
+    for (size_t i=0; i<numValues; ++i)
+    {
+      appendValue(columnValueFunc(i));
+    }
+    updateHash();
+  }
+
   PrimaryKey();
 
   virtual ~PrimaryKey();
 
   API::IID::Type tableId() const;
-  const std::vector<ColumnValue>& values() const;
+  std::vector<ColumnValue> values() const;
+  size_t numValues() const;
+  uint64_t hash() const;
 
   template <typename T>
   bool hasValue(const T& columnId) const
@@ -51,12 +71,43 @@ public:
   bool operator!=(const PrimaryKey& rhs) const;
 
 private:
+  struct InlineValue
+  {
+    API::IID::Type columnId = -1;
+    int type = 0;
+    int64_t value = 0;
+  };
+
+  static constexpr size_t sc_maxInlineValues = 2;
+
+  explicit PrimaryKey(API::IID::Type tableId);
+
   API::IID::Type m_tableId;
+  uint64_t m_hash;
+
+  // integer keys with up to two columns are stored inline, all other keys fall back to m_values
+  size_t m_numInlineValues;
+  std::array<InlineValue, sc_maxInlineValues> m_inlineValues;
   std::vector<ColumnValue> m_values;
 
+  bool isInline() const;
+  ColumnValue columnValueAt(size_t index) const;
+
+  void appendValue(ColumnValue&& value);
+  void updateHash();
+
   bool hasValueIntern(const API::IID& columnId) const;
   QVariant valueIntern(const API::IID& columnId) const;
 
 };
 
 }
+
+template <>
+struct std::hash<QtSqlLib::PrimaryKey>
+{
+  size_t operator()(const QtSqlLib::PrimaryKey& primaryKey) const noexcept
+  {
+    return static_cast<size_t>(primaryKey.hash());
+  }
+};
@@ -1,6 +1,7 @@
 #pragma once
 #pragma once
 
+#include <QtSqlLib/API/SchemaTypes.h>
 #include <QtSqlLib/ColumnHelper.h>
 #include <QtSqlLib/Query/Query.h>
 
@@ -17,15 +18,25 @@ public:
 
   void addColumn(const API::IID& id);
 
+  ResultSet getQueryResults(API::ISchema& schema, QSqlQuery&& query) override;
+
 protected:
-  QSqlQuery getQSqlQuery(const QSqlDatabase& db, API::ISchema& schema) const;
+  QSqlQuery getQSqlQuery(const QSqlDatabase& db, API::ISchema& schema, int numRows = 1) const;
+  QSqlQuery execAndQueryInsertedIds(const QSqlDatabase& db, API::ISchema& schema) const;
   virtual void bindQueryValues(QSqlQuery& query) const = 0;
+  virtual void bindConflictValues(QSqlQuery& query, const std::vector<QVariant>& values) const;
+  virtual QString createConflictString(API::ISchema& schema, API::IID::Type tableId,
+    const ColumnHelper::ColumnList& columns, std::vector<QVariant>& boundValuesOut) const;
+
+  void setReturningIds();
+  bool isReturningIds() const;
 
 private:
   void throwIfColumnIdAlreadyExisting(API::IID::Type id) const;
 
   API::IID::Type m_tableId;
   ColumnHelper::ColumnList m_columns;
+  bool m_bIsReturningIds;
 
 };
 
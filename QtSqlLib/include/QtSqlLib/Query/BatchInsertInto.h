@@ -17,15 +17,22 @@ public:
   ~BatchInsertInto() override;
 
   BatchInsertInto& values(const API::IID& columnId, const QVariantList& values);
+  // all rows are inserted by one statement, which returns the keys of every row in one result set. SQLite limits
+  // the statement to 32766 bound values (number of rows times number of columns), larger batches throw a
+  // DatabaseException and have to be split up by the caller.
+  BatchInsertInto& returnIds();
 
   SqlQuery getSqlQuery(const QSqlDatabase& db, API::ISchema& schema, ResultSet& previousQueryResults) override;
 
 protected:
   void bindQueryValues(QSqlQuery& query) const override;
+  void bindConflictValues(QSqlQuery& query, const std::vector<QVariant>& values) const override;
 
 private:
   std::vector<QVariantList> m_values;
 
+  int getNumRows() const;
+
 };
 
 }
\ No newline at end of file
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <QtSqlLib/Query/QuerySequence.h>
+
+#include <QtSqlLib/API/IID.h>
+#include <QtSqlLib/API/SchemaTypes.h>
+#include <QtSqlLib/PrimaryKey.h>
+
+#include <QVariant>
+
+#include <map>
+#include <memory>
+#include <vector>
+
+namespace QtSqlLib::Query
+{
+
+/**
+ * Inserts many rows and links each of them to the tuples specified per row. The rows and all links of a
+ * relationship are inserted by batch queries.
+ */
+class BatchInsertIntoExt : public QuerySequence
+{
+public:
+  BatchInsertIntoExt(const API::IID& tableId);
+  ~BatchInsertIntoExt() override;
+
+  BatchInsertIntoExt& values(const API::IID& columnId, const QVariantList& values);
+  BatchInsertIntoExt& linkToOneTuple(const API::IID& relationshipId, const std::vector<PrimaryKey>& tupleKeyValuesPerRow);
+  BatchInsertIntoExt& linkToManyTuples(const API::IID& relationshipId,
+    const std::vector<std::vector<PrimaryKey>>& tupleKeyValuesListPerRow);
+
+  void prepare(API::ISchema& schema) override;
+
+private:
+  enum class LinkType
+  {
+    ToOne,
+    ToMany
+  };
+
+  struct LinkedTuples
+  {
+    LinkType linkType;
+    std::vector<std::vector<PrimaryKey>> linkedPrimaryKeysPerRow;
+  };
+
+  API::IID::Type m_tableId;
+  std::vector<std::pair<API::IID::Type, QVariantList>> m_values;
+  std::map<API::IID::Type, LinkedTuples> m_linkedTuplesMap;
+
+  void throwIdLinkedTupleAlreadyExisting(API::IID::Type relationshipId) const;
+  bool isSeparateLinkTuplesQueryNeeded(const API::Relationship& relationship) const;
+  int getNumRows() const;
+
+  void addForeignKeyValues(
+    API::ISchema& schema, API::IID::Type relationshipId,
+    const API::Relationship& relationship,
+    const LinkedTuples& linkedTuples);
+
+  std::shared_ptr<std::vector<PrimaryKey>> createInsertedKeys(const API::Table& table, int numRows) const;
+  void addInsertQueries(const API::Table& table, std::shared_ptr<std::vector<PrimaryKey>> insertedKeys, int numRows);
+  void addLinkTuplesQuery(
+    API::ISchema& schema, API::IID::Type relationshipId,
+    const API::Relationship& relationship,
+    const std::shared_ptr<std::vector<PrimaryKey>>& insertedKeys);
+
+};
+
+}
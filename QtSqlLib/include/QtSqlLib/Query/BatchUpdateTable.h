@@ -0,0 +1,48 @@
+#pragma once
+
+#include <QtSqlLib/Query/QuerySequence.h>
+
+#include <QtSqlLib/API/IID.h>
+
+#include <QVariant>
+
+#include <memory>
+
+namespace QtSqlLib::API
+{
+struct Table;
+}
+
+namespace QtSqlLib::Query
+{
+
+class BatchUpdateRows;
+
+/**
+ * Updates many tuples to different values by a single prepared statement. Each row of the value lists updates the
+ * tuples matching the key values of the same row. For very large batches the rows can be inserted into a temporary
+ * staging table first, which is joined by one update statement. The staging table is created, filled, joined and
+ * dropped by separate queries of the sequence.
+ */
+class BatchUpdateTable : public QuerySequence
+{
+public:
+  BatchUpdateTable(const API::IID& tableId);
+  ~BatchUpdateTable() override;
+
+  BatchUpdateTable& values(const API::IID& columnId, const QVariantList& values);
+  BatchUpdateTable& keyValues(const API::IID& columnId, const QVariantList& values);
+  BatchUpdateTable& useStagingTable();
+
+  void prepare(API::ISchema& schema) override;
+
+private:
+  API::IID::Type m_tableId;
+  bool m_bIsUsingStagingTable;
+  std::unique_ptr<BatchUpdateRows> m_batchUpdateRows;
+
+  void addStagingTableQueries(const API::Table& table);
+
+};
+
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <QtSqlLib/Query/BatchInsertInto.h>
+#include <QtSqlLib/Query/ConflictClause.h>
+
+#include <QtSqlLib/API/IID.h>
+
+#include <QString>
+#include <QVariant>
+
+namespace QtSqlLib::Query
+{
+
+class BatchUpsert : public BatchInsertInto
+{
+public:
+  BatchUpsert(const API::IID& tableId);
+  ~BatchUpsert() override;
+
+  BatchUpsert& values(const API::IID& columnId, const QVariantList& values);
+  // limited like BatchInsertInto::returnIds()
+  BatchUpsert& returnIds();
+
+  BatchUpsert& onConflictPrimaryKey();
+  BatchUpsert& onConflictUniqueCols();
+
+  BatchUpsert& keep(const API::IID& columnId);
+  BatchUpsert& overwrite(const API::IID& columnId);
+  BatchUpsert& overwriteIf(const API::IID& columnId, Expr& condition);
+  BatchUpsert& doNothing();
+
+protected:
+  QString createConflictString(API::ISchema& schema, API::IID::Type tableId,
+    const ColumnHelper::ColumnList& columns, std::vector<QVariant>& boundValuesOut) const override;
+
+private:
+  ConflictClause m_conflictClause;
+
+};
+
+}
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <QtSqlLib/Query/Query.h>
+
+#include <QtSqlLib/API/SchemaTypes.h>
+
+#include <QString>
+#include <QVariant>
+
+#include <map>
+#include <vector>
+
+namespace QtSqlLib::Query
+{
+
+class CompiledQuery : public Query
+{
+public:
+  CompiledQuery(
+    const QString& queryString,
+    const std::vector<QVariant>& boundValues,
+    API::QueryMetaInfo&& queryMetaInfo,
+    std::vector<API::QueryMetaInfo>&& joins,
+    bool isForwardOnly = false);
+  ~CompiledQuery() override;
+
+  CompiledQuery& bind(const QString& parameterName, const QVariant& value);
+  void clearBindings();
+
+  const QString& getQueryString() const;
+  std::vector<QString> getParameterNames() const;
+
+  SqlQuery getSqlQuery(const QSqlDatabase& db, API::ISchema& schema, ResultSet& previousQueryResults) override;
+  ResultSet getQueryResults(API::ISchema& schema, QSqlQuery&& query) override;
+
+private:
+  struct BoundValue
+  {
+    QVariant value;
+    QString parameterName;
+    bool isParameter = false;
+  };
+
+  QString m_queryString;
+  std::vector<BoundValue> m_boundValues;
+  std::map<QString, QVariant> m_parameterValues;
+
+  API::QueryMetaInfo m_queryMetaInfo;
+  std::vector<API::QueryMetaInfo> m_joins;
+  bool m_isForwardOnly;
+
+};
+
+}
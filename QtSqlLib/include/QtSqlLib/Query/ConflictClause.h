@@ -0,0 +1,81 @@
+#pragma once
+
+#include <QtSqlLib/API/IID.h>
+#include <QtSqlLib/API/SchemaTypes.h>
+#include <QtSqlLib/ColumnHelper.h>
+
+#include <QString>
+#include <QVariant>
+
+#include <limits>
+#include <map>
+#include <memory>
+#include <vector>
+
+namespace QtSqlLib::API
+{
+class ISchema;
+}
+
+namespace QtSqlLib
+{
+class Expr;
+}
+
+namespace QtSqlLib::Query
+{
+
+/**
+ * Creates the ON CONFLICT clause of upsert queries. Inserted columns that are neither part of the conflict target
+ * nor of the primary key are overwritten by default.
+ */
+class ConflictClause
+{
+public:
+  enum class Target
+  {
+    PrimaryKey,
+    UniqueColumns
+  };
+
+  enum class Action
+  {
+    Keep,
+    Overwrite,
+    OverwriteIf
+  };
+
+  // relationship id of column data referring to the values of the conflicting row that were not inserted
+  static constexpr API::IID::Type excludedRelationshipId = std::numeric_limits<API::IID::Type>::min();
+
+  ConflictClause();
+  ConflictClause(ConflictClause&& other) noexcept;
+  virtual ~ConflictClause();
+
+  void setTarget(Target target);
+  void setColumnAction(API::IID::Type columnId, Action action);
+  void setColumnOverwriteCondition(API::IID::Type columnId, Expr& condition);
+  void setDoNothing();
+
+  QString toQueryString(
+    API::ISchema& schema, API::IID::Type tableId,
+    const ColumnHelper::ColumnList& insertedColumns,
+    std::vector<QVariant>& boundValuesOut) const;
+
+private:
+  struct ColumnAction
+  {
+    Action action = Action::Overwrite;
+    std::unique_ptr<Expr> condition;
+  };
+
+  Target m_target;
+  bool m_bIsDoNothing;
+  std::map<API::IID::Type, ColumnAction> m_columnActions;
+
+  void addColumnAction(API::IID::Type columnId, ColumnAction&& columnAction);
+  const ColumnHelper::ColumnList& getTargetColumns(const API::Table& table) const;
+
+};
+
+}
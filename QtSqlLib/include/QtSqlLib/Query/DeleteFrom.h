@@ -21,12 +21,15 @@ public:
   ~DeleteFrom() override;
 
   DeleteFrom& where(Expr& expr);
+  DeleteFrom& returnIds();
 
   SqlQuery getSqlQuery(const QSqlDatabase& db, API::ISchema& schema, ResultSet& previousQueryResults) override;
+  ResultSet getQueryResults(API::ISchema& schema, QSqlQuery&& query) override;
 
 private:
   API::IID::Type m_tableId;
   std::unique_ptr<Expr> m_whereExpr;
+  bool m_bIsReturningIds;
 
 };
 
@@ -1,13 +1,16 @@
 #pragma once
 
+#include <QtSqlLib/Query/CompiledQuery.h>
 #include <QtSqlLib/Query/Query.h>
 
 #include <QtSqlLib/API/IID.h>
 #include <QtSqlLib/API/SchemaTypes.h>
 #include <QtSqlLib/ColumnHelper.h>
 #include <QtSqlLib/ConcatenatedColumn.h>
+#include <QtSqlLib/PrimaryKey.h>
 #include <QtSqlLib/QueryIdentifiers.h>
 
+#include <QSqlQuery>
 #include <QString>
 
 #include <map>
@@ -35,15 +38,29 @@ public:
   FromTable& joinAll(const API::IID& relationshipId);
   FromTable& join(const API::IID& relationshipId, const ColumnHelper::SelectColumnList& columns);
 
+  FromTable& joinAll(const ColumnHelper::RelationshipPath& relationshipPath);
+  FromTable& join(const ColumnHelper::RelationshipPath& relationshipPath, const ColumnHelper::SelectColumnList& columns);
+
   FromTable& where(Expr& expr);
   FromTable& having(Expr& expr);
 
   FromTable& groupBy(const ColumnHelper::GroupColumnList& columnIds, bool caseInsensitive = false);
   FromTable& orderBy(const ColumnHelper::OrderColumnList& columnIds, bool caseInsensitive = false);
 
+  FromTable& limit(int numTuples);
+  FromTable& offset(int numTuples);
+
+  FromTable& after(const PrimaryKey& primaryKey);
+  FromTable& before(const PrimaryKey& primaryKey);
+
+  FromTable& streaming();
+  FromTable& splitJoins();
+
   SqlQuery getSqlQuery(const QSqlDatabase& db, API::ISchema& schema, ResultSet& previousQueryResults) override;
   ResultSet getQueryResults(API::ISchema& schema, QSqlQuery&& query) override;
 
+  CompiledQuery compile(API::ISchema& schema);
+
 private:
   struct SelectColumnData
   {
@@ -51,14 +68,25 @@ private:
     QString alias;
   };
 
+  struct SplitJoinQueryData
+  {
+    QString queryString;
+    std::vector<QVariant> boundValues;
+    API::QueryMetaInfo parentKeyMetaInfo;
+    QSqlQuery sqlQuery;
+  };
+
   bool m_hasColumnsSelected;
   bool m_isTableAliasesNeeded;
+  bool m_isStreaming;
+  bool m_isSplitJoins;
 
   API::QueryMetaInfo m_queryMetaInfo;
   std::vector<API::QueryMetaInfo> m_joins;
 
   QueryIdentifiers m_queryIdentifiers;
   std::vector<SelectColumnData> m_compiledColumnSelection;
+  std::vector<SplitJoinQueryData> m_splitJoinQueries;
 
   std::unique_ptr<Expr> m_whereExpr;
   std::unique_ptr<Expr> m_havingExpr;
@@ -69,8 +97,24 @@ private:
   bool m_isGroupByCaseInsensitive;
   bool m_isOrderByCaseInsensitive;
 
+  std::optional<int> m_limit;
+  std::optional<int> m_offset;
+
+  std::optional<PrimaryKey> m_keysetPrimaryKey;
+  ColumnHelper::EOrder m_keysetOrder;
+
+  static QSqlQuery prepareQuery(const QSqlDatabase& db, const QString& queryStr, const std::vector<QVariant>& boundValues);
+  void releaseSplitJoinQueries();
+
+  QString createQueryString(API::ISchema& schema, std::vector<QVariant>& boundValues);
+  void createSplitJoinQueries(API::ISchema& schema, const API::Table& table);
+
   void throwIfMultipleSelects() const;
   void throwIfMultipleJoins(API::IID::Type relationshipId) const;
+  void throwIfMultipleKeysets() const;
+
+  void addJoin(const ColumnHelper::RelationshipPath& relationshipPath, const ColumnHelper::SelectColumnList& columns);
+  const API::QueryMetaInfo& findJoin(API::IID::Type relationshipId) const;
 
   void verifyJoinsAndCheckAliasesNeeded(API::ISchema& schema);
   void generateQueryIdentifiers(API::ISchema& schema);
@@ -81,13 +125,23 @@ private:
     const API::PrimaryForeignKeyColumnIdMap& primaryForeignKeyColumnIdMap);
 
   QString processJoinsAndCreateQuerySubstring(
+    API::ISchema& schema,
+    std::vector<QVariant>& boundValues);
+
+  QString createJoinQuerySubstring(
     API::ISchema& schema,
     std::vector<QVariant>& boundValues,
-    const API::Table& table);
+    API::QueryMetaInfo& join,
+    bool isInnerJoin = false);
 
   QString createSelectString(API::ISchema& schema) const;
+  QString createFromTableString(API::ISchema& schema, const API::Table& table) const;
+  QString createWhereString(API::ISchema& schema, const API::Table& table, std::vector<QVariant>& boundValues) const;
   QString createGroupByString(API::ISchema& schema) const;
   QString createOrderByString(API::ISchema& schema) const;
+  QString createStreamingOrderByString(API::ISchema& schema, const API::Table& table) const;
+  QString createPrimaryKeyOrderByString(API::ISchema& schema, const API::Table& table, ColumnHelper::EOrder order) const;
+  QString createKeysetString(API::ISchema& schema, const API::Table& table, std::vector<QVariant>& boundValues) const;
 
   void appendJoinQuerySubstring(
     QString& joinStrOut, API::ISchema& schema, const API::Table& joinTable,
@@ -96,6 +150,7 @@ private:
     const API::RelationshipToForeignKeyReferencesMap& foreignKeyReferences,
     int foreignKeyReferencesIndex,
     bool noJoinAlias,
+    bool isInnerJoin,
     std::vector<QVariant>& boundValues);
 
 };
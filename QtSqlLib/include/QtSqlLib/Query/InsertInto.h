@@ -18,6 +18,7 @@ public:
   ~InsertInto() override;
 
   InsertInto& value(const API::IID& columnId, const QVariant& value);
+  InsertInto& returnIds();
 
   SqlQuery getSqlQuery(const QSqlDatabase& db, API::ISchema& schema, ResultSet& previousQueryResults) override;
 
@@ -20,14 +20,17 @@ public:
 
   UpdateTable& set(const API::IID& columnId, const QVariant& newValue);
   UpdateTable& where(Expr& expr);
+  UpdateTable& returnIds();
 
   SqlQuery getSqlQuery(const QSqlDatabase& db, API::ISchema& schema, ResultSet& previousQueryResults) override;
+  ResultSet getQueryResults(API::ISchema& schema, QSqlQuery&& query) override;
 
 private:
   API::IID::Type m_tableId;
 
   std::map<API::IID::Type, QVariant> m_colIdNewValueMap;
   std::unique_ptr<Expr> m_whereExpr;
+  bool m_bIsReturningIds;
 };
 
 }
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <QtSqlLib/Query/InsertInto.h>
+#include <QtSqlLib/Query/ConflictClause.h>
+
+#include <QtSqlLib/API/IID.h>
+
+#include <QString>
+#include <QVariant>
+
+namespace QtSqlLib::Query
+{
+
+class Upsert : public InsertInto
+{
+public:
+  Upsert(const API::IID& tableId);
+  ~Upsert() override;
+
+  Upsert& value(const API::IID& columnId, const QVariant& value);
+  Upsert& returnIds();
+
+  Upsert& onConflictPrimaryKey();
+  Upsert& onConflictUniqueCols();
+
+  Upsert& keep(const API::IID& columnId);
+  Upsert& overwrite(const API::IID& columnId);
+  Upsert& overwriteIf(const API::IID& columnId, Expr& condition);
+  Upsert& doNothing();
+
+  SqlQuery getSqlQuery(const QSqlDatabase& db, API::ISchema& schema, ResultSet& previousQueryResults) override;
+
+protected:
+  QString createConflictString(API::ISchema& schema, API::IID::Type tableId,
+    const ColumnHelper::ColumnList& columns, std::vector<QVariant>& boundValuesOut) const override;
+
+private:
+  ConflictClause m_conflictClause;
+
+};
+
+}
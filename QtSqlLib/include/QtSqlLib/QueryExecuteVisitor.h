@@ -1,11 +1,14 @@
 #pragma once
 
+#include <QtSqlLib/API/IQueryObserver.h>
 #include <QtSqlLib/API/IQueryVisitor.h>
 
 #include <QtSqlLib/ResultSet.h>
 
 #include <QSqlDatabase>
 
+#include <memory>
+
 namespace QtSqlLib::API
 {
 class IQuery;
@@ -15,10 +18,15 @@ class ISchema;
 namespace QtSqlLib
 {
 
+class QueryPlanDiagnostics;
+
 class QueryExecuteVisitor : public API::IQueryVisitor
 {
 public:
-  QueryExecuteVisitor(const QSqlDatabase& sqlDb, API::ISchema& schema);
+  QueryExecuteVisitor(
+    const QSqlDatabase& sqlDb, API::ISchema& schema,
+    std::shared_ptr<const API::QueryObservers> observers = nullptr,
+    QueryPlanDiagnostics* queryPlanDiagnostics = nullptr);
   ~QueryExecuteVisitor() override;
 
   void visit(API::IQuery& query) override;
@@ -29,9 +37,13 @@ public:
 private:
   const QSqlDatabase& m_sqlDb;
   API::ISchema& m_schema;
+  std::shared_ptr<const API::QueryObservers> m_observers;
+  QueryPlanDiagnostics* m_queryPlanDiagnostics;
 
   ResultSet m_lastResults;
 
+  void notifyQueryExecuted(const API::IQueryObserver::QueryExecution& execution) const;
+
 };
 
 }
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <QtSqlLib/API/IID.h>
+
+#include <QString>
+
+#include <optional>
+#include <vector>
+
+namespace QtSqlLib
+{
+
+struct QueryPlan
+{
+  enum class NodeType
+  {
+    Scan,
+    Search,
+    TempBTree,
+    Other
+  };
+
+  struct ColumnReference
+  {
+    API::IID::Type tableId = 0;
+    API::IID::Type columnId = 0;
+  };
+
+  struct Node
+  {
+    int id = 0;
+    NodeType type = NodeType::Other;
+    QString detail;
+
+    std::optional<API::IID::Type> tableId;
+    QString indexName;
+    bool bIsAutomaticIndex = false;
+    std::vector<ColumnReference> columns;
+
+    std::vector<Node> children;
+  };
+
+  std::vector<Node> findNodes(NodeType type) const;
+  std::vector<Node> findFullTableScans() const;
+  std::vector<Node> findAutomaticIndices() const;
+
+  QString sqlQuery;
+  std::vector<Node> nodes;
+};
+
+}
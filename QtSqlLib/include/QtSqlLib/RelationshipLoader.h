@@ -0,0 +1,68 @@
+#pragma once
+
+#include <QtSqlLib/API/IID.h>
+#include <QtSqlLib/ColumnHelper.h>
+#include <QtSqlLib/PrimaryKey.h>
+#include <QtSqlLib/Tuple.h>
+
+#include <memory>
+#include <optional>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace QtSqlLib::API
+{
+class IDatabase;
+}
+
+namespace QtSqlLib
+{
+
+class TupleArena;
+
+/**
+ * Collects the keys of tuples whose related tuples are requested and loads them with one query per batch of keys,
+ * instead of one query per tuple.
+ */
+class RelationshipLoader
+{
+public:
+  RelationshipLoader(API::IDatabase& database, const API::IID& relationshipId);
+  RelationshipLoader(
+    API::IDatabase& database,
+    const API::IID& relationshipId,
+    const ColumnHelper::SelectColumnList& columns);
+
+  virtual ~RelationshipLoader();
+
+  RelationshipLoader(const RelationshipLoader& rhs) = delete;
+  RelationshipLoader& operator=(const RelationshipLoader& rhs) = delete;
+
+  void request(const PrimaryKey& tupleKey);
+  size_t numPendingKeys() const;
+
+  void load();
+
+  bool isLoaded(const PrimaryKey& tupleKey) const;
+  const std::vector<Tuple>& relatedTuples(const PrimaryKey& tupleKey);
+
+  void clear();
+
+private:
+  API::IDatabase& m_database;
+  API::IID::Type m_relationshipId;
+  ColumnHelper::SelectColumnList m_columns;
+
+  std::optional<API::IID::Type> m_tableId;
+  std::vector<PrimaryKey> m_pendingKeys;
+  std::unordered_set<PrimaryKey> m_pendingKeySet;
+
+  std::shared_ptr<TupleArena> m_arena;
+  std::unordered_map<PrimaryKey, std::vector<Tuple>> m_relatedTuples;
+
+  void loadBatch(std::vector<PrimaryKey>::const_iterator begin, std::vector<PrimaryKey>::const_iterator end);
+
+};
+
+}
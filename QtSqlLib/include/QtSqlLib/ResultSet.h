@@ -3,24 +3,38 @@
 #include <QSqlQuery>
 
 #include <QtSqlLib/API/IID.h>
+#include <QtSqlLib/API/IQueryObserver.h>
 #include <QtSqlLib/API/SchemaTypes.h>
+#include <QtSqlLib/ColumnarResult.h>
 #include <QtSqlLib/PrimaryKey.h>
+#include <QtSqlLib/RowBlock.h>
+#include <QtSqlLib/TupleArena.h>
 #include <QtSqlLib/TupleView.h>
 
+#include <memory>
 #include <optional>
-#include <set>
+#include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
+namespace QtSqlLib::Query
+{
+class FromTable;
+}
+
 namespace QtSqlLib
 {
 
+class QueryExecuteVisitor;
+
 class ResultSet
 {
 public:
   ResultSet(
     QSqlQuery&& query,
     API::QueryMetaInfo&& queryMetaInfo,
-    std::vector<API::QueryMetaInfo>&& joinMetaInfo);
+    std::vector<API::QueryMetaInfo>&& joinMetaInfo,
+    bool isForwardOnly = false);
 
   ResultSet();
 
@@ -33,8 +47,10 @@ public:
   virtual ~ResultSet();
 
   bool isValid() const;
+  bool isForwardOnly() const;
   void resetIteration();
   bool isAtBeginning() const;
+  void fetchAll();
 
   bool hasNextTuple();
   bool hasNextJoinedTuple();
@@ -42,10 +58,24 @@ public:
   TupleView nextTuple();
   TupleView nextJoinedTuple();
 
+  size_t nextBlock(RowBlock& block, size_t maxNumTuples);
+
+  ColumnarResult toColumnar();
+
   const API::QueryMetaInfo& queryMetaInfo() const;
   const std::vector<API::QueryMetaInfo>& joinQueryMetaInfos() const;
 
 private:
+  friend class QueryExecuteVisitor;
+  friend class TupleView;
+  friend class Query::FromTable;
+
+  struct Observation
+  {
+    std::shared_ptr<const API::QueryObservers> observers;
+    API::IQueryObserver::ResultIteration iteration;
+  };
+
   struct NextTupleResult
   {
     bool hasNext = false;
@@ -59,18 +89,76 @@ private:
     JOIN_TUPLE
   };
 
+  // joined tuples are deduplicated per queried tuple and parent tuple, which is the queried tuple or the tuple of the
+  // parent join, because the same parent tuple can be joined to multiple queried tuples
+  struct JoinResultKey
+  {
+    API::IID::Type relationshipId;
+    PrimaryKey tupleKey;
+    PrimaryKey parentTupleKey;
+    PrimaryKey joinTupleKey;
+
+    bool operator==(const JoinResultKey& rhs) const;
+  };
+
+  struct JoinResultKeyHash
+  {
+    size_t operator()(const JoinResultKey& key) const noexcept;
+  };
+
+  // joined tuples of one relationship, queried separately and matched to the tuples by the parent primary key
+  struct SplitJoin
+  {
+    QSqlQuery sqlQuery;
+    API::QueryMetaInfo parentKeyMetaInfo;
+    std::unordered_map<PrimaryKey, std::vector<int>> rowsByParentKey;
+    const std::vector<int>* currentRows = nullptr;
+    size_t currentRowIndex = 0;
+  };
+
   QSqlQuery m_sqlQuery;
   API::QueryMetaInfo m_queryMetaInfo;
   std::vector<API::QueryMetaInfo> m_joinMetaInfo;
 
+  // index of the parent join of each join, -1 for joins of the queried table
+  std::vector<int> m_joinParentIndices;
+
   bool m_isValid;
+  bool m_isForwardOnly;
   NextTupleResult m_nextTupleResult;
-  std::set<PrimaryKey> m_retrievedResultKeys;
-  std::map<std::pair<API::IID::Type, PrimaryKey>, std::set<PrimaryKey>> m_retrievedJoinResultKeys;
+
+  // in forward-only mode rows are ordered by the parent primary key, so only the current parent has to be tracked
+  std::optional<PrimaryKey> m_currentTupleKey;
+  std::unordered_set<PrimaryKey> m_retrievedResultKeys;
+  std::unordered_set<JoinResultKey, JoinResultKeyHash> m_retrievedJoinResultKeys;
+
+  std::vector<SplitJoin> m_splitJoins;
+  bool m_isSplitJoinsIndexed;
+
+  std::unique_ptr<Observation> m_observation;
+  // shared with row blocks and detached tuples, which may outlive the result set
+  std::shared_ptr<const std::vector<API::QueryMetaInfo>> m_sharedMetaInfos;
+  std::shared_ptr<TupleArena> m_tupleArena;
+
+  const std::shared_ptr<const std::vector<API::QueryMetaInfo>>& sharedMetaInfos();
+  const std::shared_ptr<TupleArena>& tupleArena();
+  const API::QueryMetaInfo& parentQueryMetaInfo(size_t metaInfoIndex) const;
+
+  void observe(std::shared_ptr<const API::QueryObservers> observers, const QString& sqlQuery);
+  void notifyIterationFinished();
+
+  void addSplitJoinQuery(QSqlQuery&& query, API::QueryMetaInfo&& parentKeyMetaInfo);
+  void indexSplitJoins();
+  void selectSplitJoinRows(const PrimaryKey& tupleKey);
+  TupleView nextSplitJoinTuple();
 
   void searchNextTuple(SearchMode searchMode);
+  void findNextTuple(SearchMode searchMode);
+  bool isNewTupleKey(const PrimaryKey& tupleKey);
   void findNextJoinTuple(const PrimaryKey& tupleKey);
+  void createJoinParentIndices();
 
+  void releaseQuery();
   void resetNextTupleResult();
   void clearNextJoinsMask();
 
@@ -0,0 +1,106 @@
+#pragma once
+
+#include <QtSqlLib/API/IID.h>
+#include <QtSqlLib/API/SchemaTypes.h>
+#include <QtSqlLib/ID.h>
+#include <QtSqlLib/PrimaryKey.h>
+
+#include <QVariant>
+
+#include <memory>
+#include <optional>
+#include <vector>
+
+namespace QtSqlLib
+{
+
+class ResultSet;
+class TupleView;
+
+class RowBlock
+{
+public:
+  class Row
+  {
+  public:
+    API::IID::Type tableId() const;
+    std::optional<API::IID::Type> relationshipId() const;
+    std::optional<API::IID::Type> parentRelationshipId() const;
+
+    bool isJoinedTuple() const;
+
+    // joined rows refer to the row of their parent tuple, which is the queried tuple or, for nested joins, the tuple
+    // of the parent relationship
+    size_t parentRow() const;
+
+    PrimaryKey primaryKey() const;
+    PrimaryKey parentPrimaryKey() const;
+
+    template <typename T>
+    bool hasColumnValue(const T& columnId) const
+    {
+      return columnIndexOf(QtSqlLib::ID<T>(columnId)) >= 0;
+    }
+
+    template <typename T>
+    const QVariant& columnValue(const T& columnId) const
+    {
+      return columnValueIntern(QtSqlLib::ID<T>(columnId));
+    }
+
+    const QVariant& columnValueAtIndex(size_t index) const;
+
+  private:
+    friend class RowBlock;
+
+    Row(const RowBlock& block, size_t index);
+
+    const RowBlock& m_block;
+    size_t m_index;
+
+    int columnIndexOf(const API::IID& columnId) const;
+    const QVariant& columnValueIntern(const API::IID& columnId) const;
+
+  };
+
+  RowBlock();
+  virtual ~RowBlock();
+
+  RowBlock(RowBlock&& rhs);
+  RowBlock& operator=(RowBlock&& rhs);
+
+  size_t size() const;
+  bool isEmpty() const;
+  size_t numTuples() const;
+
+  Row row(size_t index) const;
+
+  void clear();
+
+private:
+  friend class ResultSet;
+
+  struct RowData
+  {
+    size_t metaInfoIndex = 0;
+    size_t parentRow = 0;
+    size_t valuesOffset = 0;
+  };
+
+  using MetaInfos = std::vector<API::QueryMetaInfo>;
+
+  // the meta infos are shared with the result set, so that the block stays valid when passed to another thread
+  std::shared_ptr<const MetaInfos> m_metaInfos;
+  std::vector<std::vector<int>> m_columnIdIndices;
+
+  // the values of all rows are stored in one vector, each row refers to its first value by an offset
+  std::vector<RowData> m_rows;
+  std::vector<QVariant> m_values;
+  size_t m_numTuples;
+
+  void reset(const std::shared_ptr<const MetaInfos>& metaInfos);
+  size_t append(size_t metaInfoIndex, const std::optional<size_t>& parentRow, const TupleView& tuple);
+
+};
+
+}
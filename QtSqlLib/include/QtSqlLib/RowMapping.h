@@ -0,0 +1,226 @@
+#pragma once
+
+#include <QtSqlLib/API/IID.h>
+#include <QtSqlLib/API/SchemaTypes.h>
+#include <QtSqlLib/DatabaseException.h>
+#include <QtSqlLib/ID.h>
+#include <QtSqlLib/ResultSet.h>
+#include <QtSqlLib/TupleView.h>
+
+#include <QByteArray>
+#include <QString>
+#include <QVariant>
+
+#include <array>
+#include <optional>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * Maps the columns of a tuple to the members of a struct. Has to be used in the global namespace:
+ *
+ * QTSQLLIB_MAP(Track, (TracksCols::Id, &Track::id), (TracksCols::Name, &Track::name))
+ */
+#define QTSQLLIB_MAP(TYPE, ...) \
+  template <> \
+  struct QtSqlLib::RowMapping<TYPE> \
+  { \
+    static auto fields() \
+    { \
+      return std::make_tuple(QTSQLLIB_FOR_EACH(QTSQLLIB_MAP_FIELD, __VA_ARGS__)); \
+    } \
+  };
+
+#define QTSQLLIB_MAP_FIELD(FIELD) QtSqlLib::makeMappedField FIELD
+
+#define QTSQLLIB_PARENS ()
+#define QTSQLLIB_EXPAND(...) QTSQLLIB_EXPAND3(QTSQLLIB_EXPAND3(QTSQLLIB_EXPAND3(QTSQLLIB_EXPAND3(__VA_ARGS__))))
+#define QTSQLLIB_EXPAND3(...) QTSQLLIB_EXPAND2(QTSQLLIB_EXPAND2(QTSQLLIB_EXPAND2(QTSQLLIB_EXPAND2(__VA_ARGS__))))
+#define QTSQLLIB_EXPAND2(...) QTSQLLIB_EXPAND1(QTSQLLIB_EXPAND1(QTSQLLIB_EXPAND1(QTSQLLIB_EXPAND1(__VA_ARGS__))))
+#define QTSQLLIB_EXPAND1(...) __VA_ARGS__
+
+#define QTSQLLIB_FOR_EACH(MACRO, ...) __VA_OPT__(QTSQLLIB_EXPAND(QTSQLLIB_FOR_EACH_HELPER(MACRO, __VA_ARGS__)))
+#define QTSQLLIB_FOR_EACH_HELPER(MACRO, ARG, ...) MACRO(ARG) __VA_OPT__(, QTSQLLIB_FOR_EACH_AGAIN QTSQLLIB_PARENS (MACRO, __VA_ARGS__))
+#define QTSQLLIB_FOR_EACH_AGAIN() QTSQLLIB_FOR_EACH_HELPER
+
+namespace QtSqlLib
+{
+
+template <typename TStruct>
+struct RowMapping;
+
+template <typename TStruct, typename TMember>
+struct MappedField
+{
+  API::IID::Type columnId;
+  TMember TStruct::* member;
+};
+
+template <typename TColumnId, typename TStruct, typename TMember>
+MappedField<TStruct, TMember> makeMappedField(const TColumnId& columnId, TMember TStruct::* member)
+{
+  return { QtSqlLib::ID<TColumnId>(columnId).get(), member };
+}
+
+/**
+ * Resolves the query indices of the mapped columns once for the tuples and each join of a result set.
+ */
+template <typename TStruct>
+class RowMapper
+{
+public:
+  explicit RowMapper(const ResultSet& resultSet) :
+    m_fields(RowMapping<TStruct>::fields())
+  {
+    m_resolutions.emplace_back(resolve(resultSet.queryMetaInfo()));
+    for (const auto& joinMetaInfo : resultSet.joinQueryMetaInfos())
+    {
+      m_resolutions.emplace_back(resolve(joinMetaInfo));
+    }
+  }
+
+  virtual ~RowMapper() = default;
+
+  TStruct map(const TupleView& tuple) const
+  {
+    TStruct target {};
+    map(tuple, target);
+    return target;
+  }
+
+  void map(const TupleView& tuple, TStruct& target) const
+  {
+    const auto& resolution = findResolution(tuple);
+    assignFields(tuple, resolution.queryIndices, target, std::make_index_sequence<sc_numFields>());
+  }
+
+private:
+  using Fields = decltype(RowMapping<TStruct>::fields());
+  static constexpr size_t sc_numFields = std::tuple_size_v<Fields>;
+
+  struct Resolution
+  {
+    std::optional<API::IID::Type> relationshipId;
+    std::array<int, sc_numFields> queryIndices;
+    std::optional<API::IID::Type> missingColumnId;
+  };
+
+  template <typename T>
+  struct IsOptional : std::false_type
+  {
+  };
+
+  template <typename T>
+  struct IsOptional<std::optional<T>> : std::true_type
+  {
+  };
+
+  Fields m_fields;
+  std::vector<Resolution> m_resolutions;
+
+  Resolution resolve(const API::QueryMetaInfo& queryMetaInfo) const
+  {
+    Resolution resolution;
+    resolution.relationshipId = queryMetaInfo.relationshipId;
+
+    size_t fieldIndex = 0;
+    std::apply([&](const auto&... field)
+    {
+      (resolveField(queryMetaInfo, field.columnId, fieldIndex++, resolution), ...);
+    }, m_fields);
+
+    return resolution;
+  }
+
+  static void resolveField(
+    const API::QueryMetaInfo& queryMetaInfo, API::IID::Type columnId,
+    size_t fieldIndex, Resolution& resolution)
+  {
+    resolution.queryIndices[fieldIndex] = -1;
+    for (size_t i=0; i<queryMetaInfo.columns.size(); ++i)
+    {
+      if (queryMetaInfo.columns.at(i).isColumnId(columnId))
+      {
+        resolution.queryIndices[fieldIndex] = static_cast<int>(queryMetaInfo.columnQueryIndices.at(i));
+        return;
+      }
+    }
+
+    if (!resolution.missingColumnId)
+    {
+      resolution.missingColumnId = columnId;
+    }
+  }
+
+  const Resolution& findResolution(const TupleView& tuple) const
+  {
+    for (const auto& resolution : m_resolutions)
+    {
+      if (resolution.relationshipId == tuple.relationshipId())
+      {
+        if (resolution.missingColumnId)
+        {
+          throw DatabaseException(DatabaseException::Type::InvalidId,
+            QString("Mapped column with id %1 not selected.").arg(resolution.missingColumnId.value()));
+        }
+        return resolution;
+      }
+    }
+
+    throw DatabaseException(DatabaseException::Type::InvalidId, "Tuple does not belong to the mapped result set.");
+  }
+
+  template <size_t... Indices>
+  void assignFields(
+    const TupleView& tuple, const std::array<int, sc_numFields>& queryIndices,
+    TStruct& target, std::index_sequence<Indices...>) const
+  {
+    (assignValue(target.*(std::get<Indices>(m_fields).member), tuple.valueAtQueryIndex(queryIndices[Indices])), ...);
+  }
+
+  template <typename T>
+  static void assignValue(T& target, const QVariant& value)
+  {
+    if constexpr (IsOptional<T>::value)
+    {
+      if (value.isNull())
+      {
+        target.reset();
+        return;
+      }
+
+      typename T::value_type optionalValue {};
+      assignValue(optionalValue, value);
+      target = std::move(optionalValue);
+    }
+    else if constexpr (std::is_same_v<T, bool>)
+    {
+      target = value.toBool();
+    }
+    else if constexpr (std::is_enum_v<T> || std::is_integral_v<T>)
+    {
+      target = static_cast<T>(value.toLongLong());
+    }
+    else if constexpr (std::is_floating_point_v<T>)
+    {
+      target = static_cast<T>(value.toDouble());
+    }
+    else if constexpr (std::is_same_v<T, QString>)
+    {
+      target = value.toString();
+    }
+    else if constexpr (std::is_same_v<T, QByteArray>)
+    {
+      target = value.toByteArray();
+    }
+    else
+    {
+      target = value.value<T>();
+    }
+  }
+
+};
+
+}
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <QSqlDatabase>
+#include <QSqlQuery>
+#include <QString>
+
+#include <atomic>
+#include <cstdint>
+#include <list>
+#include <map>
+#include <memory>
+#include <mutex>
+
+class QSqlDriver;
+
+namespace QtSqlLib
+{
+
+class StatementCache
+{
+public:
+  struct Statistics
+  {
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    size_t numCachedStatements = 0;
+  };
+
+  StatementCache() = delete;
+
+  static void registerConnection(const QSqlDatabase& db, const QString& groupName, int capacity);
+  static void unregisterConnection(const QSqlDatabase& db);
+
+  static void setCapacity(const QString& groupName, int capacity);
+  static Statistics getStatistics(const QString& groupName);
+  static void invalidateAll();
+
+  static QSqlQuery prepare(const QSqlDatabase& db, const QString& queryString);
+  static void release(QSqlQuery& query);
+
+private:
+  class Cache
+  {
+  public:
+    Cache(const QString& groupName, int capacity);
+
+    const QString& getGroupName() const;
+    void setCapacity(int capacity);
+    Statistics getStatistics() const;
+
+    QSqlQuery acquire(const QSqlDatabase& db, const QString& queryString);
+    void release(QSqlQuery& query);
+    void invalidate();
+    void clear();
+
+  private:
+    using Entry = std::pair<QString, QSqlQuery>;
+
+    mutable std::mutex m_mutex;
+    QString m_groupName;
+    size_t m_capacity;
+    Statistics m_statistics;
+    uint64_t m_generation;
+
+    std::list<Entry> m_idleStatements;
+    std::map<QString, std::list<Entry>::iterator> m_idleStatementsIndex;
+    std::map<QString, int> m_numCheckedOutStatements;
+
+    void dropStaleStatements();
+    void evictExceedingStatements();
+
+  };
+
+  static std::mutex s_registryMutex;
+  static std::map<const QSqlDriver*, std::shared_ptr<Cache>> s_registry;
+  static std::map<QString, Statistics> s_retiredStatistics;
+  static std::atomic<uint64_t> s_generation;
+
+  static std::shared_ptr<Cache> findCache(const QSqlDriver* driver);
+  static bool isSchemaStatement(const QString& queryString);
+  static bool isTempSchemaStatement(const QString& queryString);
+
+};
+
+}
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <QSqlDatabase>
+#include <QString>
+
+#include <map>
+#include <mutex>
+
+namespace QtSqlLib
+{
+
+class Transaction
+{
+public:
+  explicit Transaction(const QSqlDatabase& db);
+  ~Transaction();
+
+  Transaction(const Transaction& rhs) = delete;
+  Transaction& operator=(const Transaction& rhs) = delete;
+
+  Transaction(Transaction&& rhs);
+  Transaction& operator=(Transaction&& rhs) = delete;
+
+  bool isActive() const;
+  bool isNested() const;
+
+  void commit();
+  void rollback();
+
+  static int getDepth(const QSqlDatabase& db);
+
+private:
+  QSqlDatabase m_db;
+  int m_level;
+  bool m_bIsActive;
+
+  static std::mutex s_depthsMutex;
+  static std::map<QString, int> s_depths;
+
+  void throwIfNotInnermost() const;
+  void execSavepointStatement(const QString& statement) const;
+  void finish();
+
+  QString savepointName() const;
+
+};
+
+}
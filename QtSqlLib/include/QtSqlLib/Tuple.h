@@ -0,0 +1,109 @@
+#pragma once
+
+#include <QtSqlLib/API/IID.h>
+#include <QtSqlLib/API/SchemaTypes.h>
+#include <QtSqlLib/ID.h>
+#include <QtSqlLib/PrimaryKey.h>
+
+#include <QByteArray>
+#include <QString>
+#include <QVariant>
+
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <vector>
+
+namespace QtSqlLib
+{
+
+class TupleArena;
+class TupleView;
+
+/**
+ * Immutable copy of a queried tuple, created by TupleView::detach(). Stays valid after the result set advanced
+ * or was destroyed. The values are stored in a TupleArena that is kept alive by the tuple.
+ */
+class Tuple
+{
+public:
+  virtual ~Tuple();
+
+  API::IID::Type tableId() const;
+  std::optional<API::IID::Type> relationshipId() const;
+  std::optional<API::IID::Type> parentRelationshipId() const;
+
+  PrimaryKey primaryKey() const;
+  PrimaryKey parentPrimaryKey() const;
+
+  size_t numColumns() const;
+
+  template <typename T>
+  bool hasColumnValue(const T& columnId) const
+  {
+    return columnIndexOf(QtSqlLib::ID<T>(columnId)) >= 0;
+  }
+
+  template <typename T>
+  const QVariant& columnValue(const T& columnId) const
+  {
+    return columnValueIntern(QtSqlLib::ID<T>(columnId));
+  }
+
+  // convenience conversions of the QVariant returned by columnValue()
+  template <typename T>
+  bool isNullAt(const T& columnId) const
+  {
+    return columnValueIntern(QtSqlLib::ID<T>(columnId)).isNull();
+  }
+
+  template <typename T>
+  int64_t int64At(const T& columnId) const
+  {
+    return static_cast<int64_t>(columnValueIntern(QtSqlLib::ID<T>(columnId)).toLongLong());
+  }
+
+  template <typename T>
+  double doubleAt(const T& columnId) const
+  {
+    return columnValueIntern(QtSqlLib::ID<T>(columnId)).toDouble();
+  }
+
+  template <typename T>
+  QString textAt(const T& columnId) const
+  {
+    return columnValueIntern(QtSqlLib::ID<T>(columnId)).toString();
+  }
+
+  template <typename T>
+  QByteArray blobAt(const T& columnId) const
+  {
+    return columnValueIntern(QtSqlLib::ID<T>(columnId)).toByteArray();
+  }
+
+  const QVariant& columnValueAtIndex(size_t index) const;
+
+private:
+  friend class TupleView;
+
+  using MetaInfos = std::vector<API::QueryMetaInfo>;
+
+  Tuple(
+    std::shared_ptr<const MetaInfos> metaInfos,
+    size_t metaInfoIndex,
+    std::shared_ptr<TupleArena> arena,
+    const QVariant* values,
+    PrimaryKey parentPrimaryKey);
+
+  std::shared_ptr<const MetaInfos> m_metaInfos;
+  const API::QueryMetaInfo* m_queryMetaInfo;
+  std::shared_ptr<TupleArena> m_arena;
+  const QVariant* m_values;
+  PrimaryKey m_parentPrimaryKey;
+
+  int columnIndexOf(const API::IID& columnId) const;
+  const QVariant& columnValueIntern(const API::IID& columnId) const;
+
+};
+
+}
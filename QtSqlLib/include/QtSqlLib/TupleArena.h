@@ -0,0 +1,47 @@
+#pragma once
+
+#include <QVariant>
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace QtSqlLib
+{
+
+class TupleView;
+
+/**
+ * Bump-pointer storage for the values of detached tuples. Values are placed into chunks of growing size and
+ * released all at once when the arena is destroyed. Not thread-safe.
+ */
+class TupleArena
+{
+public:
+  TupleArena();
+  virtual ~TupleArena();
+
+  TupleArena(const TupleArena& rhs) = delete;
+  TupleArena& operator=(const TupleArena& rhs) = delete;
+
+  size_t numChunks() const;
+  size_t numValues() const;
+
+private:
+  friend class TupleView;
+
+  struct Chunk
+  {
+    std::unique_ptr<QVariant[]> values;
+    size_t capacity = 0;
+  };
+
+  std::vector<Chunk> m_chunks;
+  size_t m_numUsedInChunk;
+  size_t m_numValues;
+
+  QVariant* allocate(size_t numValues);
+
+};
+
+}
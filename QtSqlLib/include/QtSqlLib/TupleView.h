@@ -2,16 +2,24 @@
 
 #include <QtSqlLib/ID.h>
 #include <QtSqlLib/PrimaryKey.h>
+#include <QtSqlLib/Tuple.h>
 
+#include <QByteArray>
 #include <QSqlQuery>
+#include <QString>
 
 #include "API/SchemaTypes.h"
 
+#include <cstdint>
+#include <memory>
 #include <optional>
 
 namespace QtSqlLib
 {
 
+class ResultSet;
+class TupleArena;
+
 class TupleView
 {
 public:
@@ -23,8 +31,10 @@ public:
 
   API::IID::Type tableId() const;
   std::optional<API::IID::Type> relationshipId() const;
+  std::optional<API::IID::Type> parentRelationshipId() const;
 
   PrimaryKey primaryKey() const;
+  PrimaryKey parentPrimaryKey() const;
 
   template <typename T>
   bool hasColumnValue(const T& columnId) const
@@ -38,16 +48,72 @@ public:
     return columnValueIntern(QtSqlLib::ID<T>(columnId));
   }
 
+  // convenience conversions of columnValue(), the values are still read from the driver as QVariant
+  template <typename T>
+  bool isNullAt(const T& columnId) const
+  {
+    return columnValueIntern(QtSqlLib::ID<T>(columnId)).isNull();
+  }
+
+  template <typename T>
+  int64_t int64At(const T& columnId) const
+  {
+    return int64AtIntern(QtSqlLib::ID<T>(columnId));
+  }
+
+  template <typename T>
+  double doubleAt(const T& columnId) const
+  {
+    return doubleAtIntern(QtSqlLib::ID<T>(columnId));
+  }
+
+  template <typename T>
+  QString textAt(const T& columnId) const
+  {
+    return textAtIntern(QtSqlLib::ID<T>(columnId));
+  }
+
+  template <typename T>
+  QByteArray blobAt(const T& columnId) const
+  {
+    return blobAtIntern(QtSqlLib::ID<T>(columnId));
+  }
+
   QVariant columnValueAtIndex(size_t index) const;
 
+  Tuple detach() const;
+  Tuple detach(const std::shared_ptr<TupleArena>& arena) const;
+
 private:
+  friend class ResultSet;
+
+  template <typename TStruct>
+  friend class RowMapper;
+
+  TupleView(
+    const QSqlQuery& sqlQuery,
+    const API::QueryMetaInfo& queryMetaInfo,
+    ResultSet& resultSet,
+    size_t metaInfoIndex);
+
   int m_queryPos;
   const QSqlQuery& m_sqlQuery;
   const API::QueryMetaInfo& m_queryMetaInfo;
 
+  ResultSet* m_resultSet;
+  size_t m_metaInfoIndex;
+
+  int queryIndexOf(const API::IID& columnId) const;
+  QVariant valueAtQueryIndex(int queryIndex) const;
+
   bool hasColumnValueIntern(const API::IID& columnId) const;
   QVariant columnValueIntern(const API::IID& columnId) const;
 
+  int64_t int64AtIntern(const API::IID& columnId) const;
+  double doubleAtIntern(const API::IID& columnId) const;
+  QString textAtIntern(const API::IID& columnId) const;
+  QByteArray blobAtIntern(const API::IID& columnId) const;
+
   void throwIfInvalidated() const;
 
 };
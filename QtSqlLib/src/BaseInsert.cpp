@@ -3,6 +3,11 @@
 #include "QtSqlLib/API/ISanityChecker.h"
 #include "QtSqlLib/API/ISchema.h"
 #include "QtSqlLib/DatabaseException.h"
+#include "QtSqlLib/StatementCache.h"
+
+#include "ReturningClause.h"
+
+#include <QSqlError>
 
 namespace QtSqlLib::Query
 {
@@ -10,6 +15,7 @@ namespace QtSqlLib::Query
 BaseInsert::BaseInsert(const API::IID& tableId)
   : Query()
   , m_tableId(tableId.get())
+  , m_bIsReturningIds(false)
 {
 }
 
@@ -21,6 +27,47 @@ void BaseInsert::addColumn(const API::IID& id)
   m_columns.emplace_back(id.get());
 }
 
+ResultSet BaseInsert::getQueryResults(API::ISchema& schema, QSqlQuery&& query)
+{
+  if (!m_bIsReturningIds)
+  {
+    return {};
+  }
+
+  const auto& table = schema.getTables().at(m_tableId);
+  return ReturningClause::createPrimaryKeysResults(m_tableId, table, std::move(query));
+}
+
+void BaseInsert::setReturningIds()
+{
+  if (m_bIsReturningIds)
+  {
+    throw DatabaseException(DatabaseException::Type::InvalidSyntax,
+      "returnIds() can only be called once per query.");
+  }
+
+  m_bIsReturningIds = true;
+}
+
+bool BaseInsert::isReturningIds() const
+{
+  return m_bIsReturningIds;
+}
+
+void BaseInsert::bindConflictValues(QSqlQuery& query, const std::vector<QVariant>& values) const
+{
+  for (const auto& value : values)
+  {
+    query.addBindValue(value);
+  }
+}
+
+QString BaseInsert::createConflictString(API::ISchema& /*schema*/, API::IID::Type /*tableId*/,
+  const ColumnHelper::ColumnList& /*columns*/, std::vector<QVariant>& /*boundValuesOut*/) const
+{
+  return {};
+}
+
 void BaseInsert::throwIfColumnIdAlreadyExisting(API::IID::Type id) const
 {
   for (const auto& columnId : m_columns)
@@ -33,7 +80,7 @@ void BaseInsert::throwIfColumnIdAlreadyExisting(API::IID::Type id) const
   }
 }
 
-QSqlQuery BaseInsert::getQSqlQuery(const QSqlDatabase& db, API::ISchema& schema) const
+QSqlQuery BaseInsert::getQSqlQuery(const QSqlDatabase& db, API::ISchema& schema, int numRows) const
 {
   schema.getSanityChecker().throwIfTableIdNotExisting(m_tableId);
 
@@ -51,12 +98,62 @@ QSqlQuery BaseInsert::getQSqlQuery(const QSqlDatabase& db, API::ISchema& schema)
   }
 
   columnsString = columnsString.left(columnsString.length() - 2);
-  valuesString = valuesString.left(valuesString.length() - 2);
+  valuesString = QString("(%1)").arg(valuesString.left(valuesString.length() - 2));
+
+  QString rowsString = valuesString;
+  for (auto i=1; i<numRows; ++i)
+  {
+    rowsString += QString(", %1").arg(valuesString);
+  }
 
-  QSqlQuery query(db);
-  query.prepare(QString("INSERT INTO '%1' (%2) VALUES (%3);").arg(table.name).arg(columnsString).arg(valuesString));
+  std::vector<QVariant> conflictValues;
+  const auto conflictString = createConflictString(schema, m_tableId, m_columns, conflictValues);
+
+  QString returningString;
+  const auto isReturningClause = (m_bIsReturningIds && ReturningClause::isSupported(db));
+  if (isReturningClause)
+  {
+    returningString = QString(" RETURNING %1").arg(ReturningClause::createPrimaryKeysString(table));
+  }
+
+  auto query = StatementCache::prepare(db,
+    QString("INSERT INTO '%1' (%2) VALUES %3%4%5;")
+    .arg(table.name)
+    .arg(columnsString)
+    .arg(rowsString)
+    .arg(conflictString)
+    .arg(returningString));
+
+  if (isReturningClause)
+  {
+    query.setForwardOnly(false);
+  }
 
   bindQueryValues(query);
+  bindConflictValues(query, conflictValues);
+
+  return query;
+}
+
+QSqlQuery BaseInsert::execAndQueryInsertedIds(const QSqlDatabase& db, API::ISchema& schema) const
+{
+  // without RETURNING clauses, the key of the inserted row is queried by its rowid
+  auto insertQuery = getQSqlQuery(db, schema);
+  if (!insertQuery.exec())
+  {
+    const auto errorText = insertQuery.lastError().text();
+    StatementCache::release(insertQuery);
+    throw DatabaseException(DatabaseException::Type::QueryError,
+      QString("Could not execute query: %1").arg(errorText));
+  }
+  StatementCache::release(insertQuery);
+
+  const auto& table = schema.getTables().at(m_tableId);
+
+  auto query = StatementCache::prepare(db, QString("SELECT %1 FROM '%2' WHERE rowid = last_insert_rowid();")
+    .arg(ReturningClause::createPrimaryKeysString(table))
+    .arg(table.name));
+  query.setForwardOnly(false);
 
   return query;
 }
@@ -0,0 +1,58 @@
+#include "BatchDeleteTuples.h"
+
+#include "QtSqlLib/API/ISanityChecker.h"
+#include "QtSqlLib/API/ISchema.h"
+#include "QtSqlLib/DatabaseException.h"
+#include "QtSqlLib/StatementCache.h"
+
+namespace QtSqlLib::Query
+{
+
+BatchDeleteTuples::BatchDeleteTuples(API::IID::Type tableId)
+  : Query()
+  , m_tableId(tableId)
+{
+}
+
+BatchDeleteTuples::~BatchDeleteTuples() = default;
+
+void BatchDeleteTuples::addKeyValues(const PrimaryKey& keyValues)
+{
+  for (const auto& keyValue : keyValues.values())
+  {
+    m_keyValues[keyValue.columnId].append(keyValue.value);
+  }
+}
+
+API::IQuery::SqlQuery BatchDeleteTuples::getSqlQuery(const QSqlDatabase& db, API::ISchema& schema,
+  ResultSet& /*previousQueryResults*/)
+{
+  schema.getSanityChecker().throwIfTableIdNotExisting(m_tableId);
+  const auto& table = schema.getTables().at(m_tableId);
+
+  if (m_keyValues.empty())
+  {
+    throw DatabaseException(DatabaseException::Type::UnexpectedError,
+      "Missing key values of the tuples to delete.");
+  }
+
+  QString whereString;
+  for (const auto& keyValues : m_keyValues)
+  {
+    schema.getSanityChecker().throwIfColumnIdNotExisting(table, keyValues.first);
+    whereString += QString("'%1' = ? AND ").arg(table.columns.at(keyValues.first).name);
+  }
+
+  auto query = StatementCache::prepare(db, QString("DELETE FROM '%1' WHERE %2;")
+    .arg(table.name)
+    .arg(whereString.left(whereString.length() - 5)));
+
+  for (const auto& keyValues : m_keyValues)
+  {
+    query.addBindValue(keyValues.second);
+  }
+
+  return { std::move(query), QueryMode::Batch };
+}
+
+}
@@ -0,0 +1,33 @@
+#pragma once
+
+#include "QtSqlLib/Query/Query.h"
+
+#include "QtSqlLib/PrimaryKey.h"
+
+#include <QVariantList>
+
+#include <map>
+
+namespace QtSqlLib::Query
+{
+
+/**
+ * Deletes many tuples identified by their key values by a single prepared statement executed in batch mode.
+ */
+class BatchDeleteTuples : public Query
+{
+public:
+  BatchDeleteTuples(API::IID::Type tableId);
+  ~BatchDeleteTuples() override;
+
+  void addKeyValues(const PrimaryKey& keyValues);
+
+  SqlQuery getSqlQuery(const QSqlDatabase& db, API::ISchema& schema, ResultSet& previousQueryResults) override;
+
+private:
+  API::IID::Type m_tableId;
+  std::map<API::IID::Type, QVariantList> m_keyValues;
+
+};
+
+}
@@ -0,0 +1,80 @@
+#include "BatchInsertGeneratedKeys.h"
+
+#include "QtSqlLib/API/ISchema.h"
+#include "QtSqlLib/DatabaseException.h"
+#include "QtSqlLib/ID.h"
+#include "QtSqlLib/StatementCache.h"
+
+#include <QSqlError>
+
+namespace QtSqlLib::Query
+{
+
+BatchInsertGeneratedKeys::BatchInsertGeneratedKeys(API::IID::Type tableId, int numRows,
+  std::shared_ptr<std::vector<PrimaryKey>> insertedKeys)
+  : BatchInsertInto(ID(tableId))
+  , m_tableId(tableId)
+  , m_numRows(numRows)
+  , m_insertedKeys(std::move(insertedKeys))
+{
+}
+
+BatchInsertGeneratedKeys::~BatchInsertGeneratedKeys() = default;
+
+bool BatchInsertGeneratedKeys::isSupported(const API::Table& table)
+{
+  return (table.primaryKeys.size() == 1) && (table.columns.at(table.primaryKeys.at(0)).type == API::DataType::Integer);
+}
+
+API::IQuery::SqlQuery BatchInsertGeneratedKeys::getSqlQuery(const QSqlDatabase& db, API::ISchema& schema,
+  ResultSet& previousQueryResults)
+{
+  const auto& table = schema.getTables().at(m_tableId);
+  const auto primaryKeyColumnId = table.primaryKeys.at(0);
+
+  // the query is part of the sequence's transaction, so that no other rows are inserted in between
+  const auto greatestKey = queryGreatestKey(db, table);
+
+  QVariantList keyValues;
+  m_insertedKeys->reserve(m_insertedKeys->size() + m_numRows);
+  for (auto i=1; i<=m_numRows; ++i)
+  {
+    const QVariant keyValue(greatestKey + i);
+    keyValues.append(keyValue);
+    m_insertedKeys->emplace_back(m_tableId, std::vector<PrimaryKey::ColumnValue> { { primaryKeyColumnId, keyValue } });
+  }
+
+  values(ID(primaryKeyColumnId), keyValues);
+  return BatchInsertInto::getSqlQuery(db, schema, previousQueryResults);
+}
+
+qint64 BatchInsertGeneratedKeys::queryGreatestKey(const QSqlDatabase& db, const API::Table& table) const
+{
+  const auto& primaryKeyColumn = table.columns.at(table.primaryKeys.at(0));
+  const auto maxKeyString = QString("coalesce(max('%1'.'%2'), 0)").arg(table.name).arg(primaryKeyColumn.name);
+
+  // keys of deleted rows are not reused for auto increment columns
+  auto query = StatementCache::prepare(db, primaryKeyColumn.bIsAutoIncrement
+    ? QString("SELECT max(%1, coalesce((SELECT seq FROM sqlite_sequence WHERE name = ?), 0)) FROM '%2';")
+      .arg(maxKeyString).arg(table.name)
+    : QString("SELECT %1 FROM '%2';").arg(maxKeyString).arg(table.name));
+
+  if (primaryKeyColumn.bIsAutoIncrement)
+  {
+    query.addBindValue(table.name);
+  }
+
+  if (!query.exec() || !query.next())
+  {
+    const auto errorText = query.lastError().text();
+    StatementCache::release(query);
+    throw DatabaseException(DatabaseException::Type::QueryError,
+      QString("Could not query the greatest key: %1").arg(errorText));
+  }
+
+  const auto greatestKey = query.value(0).toLongLong();
+  StatementCache::release(query);
+  return greatestKey;
+}
+
+}
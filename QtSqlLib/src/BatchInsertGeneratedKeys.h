@@ -0,0 +1,37 @@
+#pragma once
+
+#include "QtSqlLib/Query/BatchInsertInto.h"
+
+#include "QtSqlLib/PrimaryKey.h"
+
+#include <memory>
+#include <vector>
+
+namespace QtSqlLib::Query
+{
+
+/**
+ * Batch insert into a table with a single integer primary key, whose values are not specified. The keys are assigned
+ * explicitly following the greatest existing key and appended to a key list shared with subsequent queries of the
+ * same sequence, so that the order of the keys matches the order of the rows.
+ */
+class BatchInsertGeneratedKeys : public BatchInsertInto
+{
+public:
+  BatchInsertGeneratedKeys(API::IID::Type tableId, int numRows, std::shared_ptr<std::vector<PrimaryKey>> insertedKeys);
+  ~BatchInsertGeneratedKeys() override;
+
+  static bool isSupported(const API::Table& table);
+
+  SqlQuery getSqlQuery(const QSqlDatabase& db, API::ISchema& schema, ResultSet& previousQueryResults) override;
+
+private:
+  API::IID::Type m_tableId;
+  int m_numRows;
+  std::shared_ptr<std::vector<PrimaryKey>> m_insertedKeys;
+
+  qint64 queryGreatestKey(const QSqlDatabase& db, const API::Table& table) const;
+
+};
+
+}
@@ -1,7 +1,13 @@
 #include "QtSqlLib/Query/BatchInsertInto.h"
 
+#include "QtSqlLib/DatabaseException.h"
+
+#include "ReturningClause.h"
+#include "SqliteLimits.h"
+
 namespace QtSqlLib::Query
 {
+
 BatchInsertInto::BatchInsertInto(const API::IID& tableId)
   : BaseInsert(tableId)
 {
@@ -16,17 +22,100 @@ BatchInsertInto& BatchInsertInto::values(const API::IID& columnId, const QVarian
   return *this;
 }
 
+BatchInsertInto& BatchInsertInto::returnIds()
+{
+  setReturningIds();
+  return *this;
+}
+
 API::IQuery::SqlQuery BatchInsertInto::getSqlQuery(const QSqlDatabase& db, API::ISchema& schema, ResultSet& /*previousQueryResults*/)
 {
-  return { getQSqlQuery(db, schema), QueryMode::Batch };
+  if (!isReturningIds())
+  {
+    return { getQSqlQuery(db, schema), QueryMode::Batch };
+  }
+
+  // the rows are inserted by a single statement, so that the keys of all rows are returned in one result set
+  ReturningClause::throwIfNotSupported(db);
+
+  const auto numRows = getNumRows();
+  if (numRows == 0)
+  {
+    throw DatabaseException(DatabaseException::Type::InvalidSyntax,
+      "Batch insert queries returning ids require at least one row.");
+  }
+
+  if (numRows * static_cast<int>(m_values.size()) > s_maxBoundValuesPerQuery)
+  {
+    throw DatabaseException(DatabaseException::Type::QueryError,
+      QString("Batch insert queries returning ids are limited to %1 values (%2 rows of %3 columns given).")
+      .arg(s_maxBoundValuesPerQuery)
+      .arg(numRows)
+      .arg(m_values.size()));
+  }
+
+  return { getQSqlQuery(db, schema, numRows), QueryMode::Single };
 }
 
 void BatchInsertInto::bindQueryValues(QSqlQuery& query) const
 {
+  if (!isReturningIds())
+  {
+    for (const auto& value : m_values)
+    {
+      query.addBindValue(value);
+    }
+    return;
+  }
+
+  const auto numRows = getNumRows();
+  for (auto i=0; i<numRows; ++i)
+  {
+    for (const auto& value : m_values)
+    {
+      query.addBindValue(value.at(i));
+    }
+  }
+}
+
+void BatchInsertInto::bindConflictValues(QSqlQuery& query, const std::vector<QVariant>& values) const
+{
+  if (isReturningIds())
+  {
+    BaseInsert::bindConflictValues(query, values);
+    return;
+  }
+
+  // batch executions expect a list of values per placeholder
+  const auto numRows = getNumRows();
+  for (const auto& value : values)
+  {
+    QVariantList valueList;
+    for (auto i=0; i<numRows; ++i)
+    {
+      valueList.append(value);
+    }
+    query.addBindValue(valueList);
+  }
+}
+
+int BatchInsertInto::getNumRows() const
+{
+  if (m_values.empty())
+  {
+    return 0;
+  }
+
+  const auto numRows = m_values.front().size();
   for (const auto& value : m_values)
   {
-    query.addBindValue(value);
+    if (value.size() != numRows)
+    {
+      throw DatabaseException(DatabaseException::Type::InvalidSyntax,
+        "All columns of a batch insert query need the same number of values.");
+    }
   }
+  return static_cast<int>(numRows);
 }
 
 }
@@ -0,0 +1,319 @@
+#include "QtSqlLib/Query/BatchInsertIntoExt.h"
+
+#include "QtSqlLib/API/ISanityChecker.h"
+#include "QtSqlLib/API/ISchema.h"
+#include "QtSqlLib/DatabaseException.h"
+#include "QtSqlLib/ID.h"
+#include "QtSqlLib/Query/BatchInsertInto.h"
+
+#include "BatchInsertGeneratedKeys.h"
+#include "BatchInsertLinkRows.h"
+#include "BatchUpdateLinkedChildren.h"
+
+#include <algorithm>
+
+namespace QtSqlLib::Query
+{
+
+static std::vector<PrimaryKey> flattenKeysList(const std::vector<std::vector<PrimaryKey>>& keysListPerRow)
+{
+  std::vector<PrimaryKey> keys;
+  for (const auto& keysList : keysListPerRow)
+  {
+    keys.insert(keys.end(), keysList.cbegin(), keysList.cend());
+  }
+  return keys;
+}
+
+BatchInsertIntoExt::BatchInsertIntoExt(const API::IID& tableId)
+  : QuerySequence()
+  , m_tableId(tableId.get())
+{
+}
+
+BatchInsertIntoExt::~BatchInsertIntoExt() = default;
+
+BatchInsertIntoExt& BatchInsertIntoExt::values(const API::IID& columnId, const QVariantList& values)
+{
+  m_values.emplace_back(columnId.get(), values);
+  return *this;
+}
+
+BatchInsertIntoExt& BatchInsertIntoExt::linkToOneTuple(
+  const API::IID& relationshipId,
+  const std::vector<PrimaryKey>& tupleKeyValuesPerRow)
+{
+  throwIdLinkedTupleAlreadyExisting(relationshipId.get());
+
+  auto& linkedTuples = m_linkedTuplesMap[relationshipId.get()];
+  linkedTuples.linkType = LinkType::ToOne;
+  for (const auto& tupleKeyValues : tupleKeyValuesPerRow)
+  {
+    linkedTuples.linkedPrimaryKeysPerRow.push_back({ tupleKeyValues });
+  }
+  return *this;
+}
+
+BatchInsertIntoExt& BatchInsertIntoExt::linkToManyTuples(
+  const API::IID& relationshipId,
+  const std::vector<std::vector<PrimaryKey>>& tupleKeyValuesListPerRow)
+{
+  throwIdLinkedTupleAlreadyExisting(relationshipId.get());
+
+  m_linkedTuplesMap[relationshipId.get()] = { LinkType::ToMany, tupleKeyValuesListPerRow };
+  return *this;
+}
+
+void BatchInsertIntoExt::prepare(API::ISchema& schema)
+{
+  schema.getSanityChecker().throwIfTableIdNotExisting(m_tableId);
+
+  if (m_values.empty())
+  {
+    throw DatabaseException(DatabaseException::Type::InvalidSyntax,
+      "Batch insert queries require at least one column.");
+  }
+
+  const auto& table = schema.getTables().at(m_tableId);
+  const auto numRows = getNumRows();
+
+  std::vector<API::IID::Type> separateLinkRelationshipIds;
+
+  const auto& relationships = schema.getRelationships();
+  for (const auto& linkedTuples : m_linkedTuplesMap)
+  {
+    const auto relationshipId = linkedTuples.first;
+
+    schema.getSanityChecker().throwIfRelationshipIsNotExisting(relationshipId);
+    const auto& relationship = relationships.at(relationshipId);
+
+    if ((relationship.tableFromId != m_tableId) && (relationship.tableToId != m_tableId))
+    {
+      throw DatabaseException(DatabaseException::Type::InvalidId,
+        "Invalid relationship ID.");
+    }
+
+    if (static_cast<int>(linkedTuples.second.linkedPrimaryKeysPerRow.size()) != numRows)
+    {
+      throw DatabaseException(DatabaseException::Type::InvalidSyntax,
+        QString("Number of linked tuples of relationship with id %1 does not match the number of rows.").arg(relationshipId));
+    }
+
+    const auto linkedKeys = flattenKeysList(linkedTuples.second.linkedPrimaryKeysPerRow);
+    if (linkedKeys.empty())
+    {
+      continue;
+    }
+
+    if (linkedTuples.second.linkType == LinkType::ToOne)
+    {
+      schema.verifyOneToOneRelationshipPrimaryKeysAndGetTableIds(relationshipId, {}, linkedKeys.at(0));
+      schema.validatePrimaryKeysList(linkedKeys);
+    }
+    else
+    {
+      schema.verifyOneToManyRelationshipPrimaryKeysAndGetTableIds(relationshipId, {}, linkedKeys);
+    }
+
+    if (isSeparateLinkTuplesQueryNeeded(relationship))
+    {
+      separateLinkRelationshipIds.emplace_back(relationshipId);
+      continue;
+    }
+
+    if (linkedTuples.second.linkType == LinkType::ToMany)
+    {
+      throw DatabaseException(DatabaseException::Type::InvalidSyntax,
+        QString("Rows can only be linked to one tuple of relationship with id %1.").arg(relationshipId));
+    }
+
+    addForeignKeyValues(schema, relationshipId, relationship, linkedTuples.second);
+  }
+
+  if (separateLinkRelationshipIds.empty())
+  {
+    addInsertQueries(table, nullptr, numRows);
+    return;
+  }
+
+  // the keys of the inserted rows are taken from the values if possible, otherwise they are assigned by the insert
+  auto insertedKeys = createInsertedKeys(table, numRows);
+  addInsertQueries(table, insertedKeys, numRows);
+
+  for (const auto& relationshipId : separateLinkRelationshipIds)
+  {
+    addLinkTuplesQuery(schema, relationshipId, relationships.at(relationshipId), insertedKeys);
+  }
+}
+
+void BatchInsertIntoExt::throwIdLinkedTupleAlreadyExisting(API::IID::Type relationshipId) const
+{
+  if (m_linkedTuplesMap.count(relationshipId) > 0)
+  {
+    throw DatabaseException(DatabaseException::Type::InvalidSyntax,
+      QString("More than one linked tuple of same relationship with id %1 specified.").arg(relationshipId));
+  }
+}
+
+bool BatchInsertIntoExt::isSeparateLinkTuplesQueryNeeded(const API::Relationship& relationship) const
+{
+  return ((relationship.type == API::RelationshipType::ManyToMany) ||
+    ((relationship.type == API::RelationshipType::OneToMany) && (relationship.tableFromId == m_tableId)) ||
+    ((relationship.type == API::RelationshipType::ManyToOne) && (relationship.tableToId == m_tableId)));
+}
+
+int BatchInsertIntoExt::getNumRows() const
+{
+  const auto numRows = m_values.front().second.size();
+  for (const auto& value : m_values)
+  {
+    if (value.second.size() != numRows)
+    {
+      throw DatabaseException(DatabaseException::Type::InvalidSyntax,
+        "All columns of a batch insert query need the same number of values.");
+    }
+  }
+  return static_cast<int>(numRows);
+}
+
+void BatchInsertIntoExt::addForeignKeyValues(
+  API::ISchema& schema, API::IID::Type relationshipId,
+  const API::Relationship& relationship,
+  const LinkedTuples& linkedTuples)
+{
+  const auto parentTableId = (relationship.type == API::RelationshipType::OneToMany ? relationship.tableFromId : relationship.tableToId);
+  const auto& parentTable = schema.getTables().at(parentTableId);
+  const auto& childTable = schema.getTables().at(m_tableId);
+
+  const auto& foreignKeyReferences = childTable.relationshipToForeignKeyReferencesMap.at({ relationshipId, parentTableId });
+  if (foreignKeyReferences.size() != 1)
+  {
+    throw DatabaseException(DatabaseException::Type::UnexpectedError,
+      "Foreign key references table seems to be corrupted.");
+  }
+
+  for (const auto& parentColumnId : parentTable.primaryKeys)
+  {
+    QVariantList foreignKeyValues;
+    for (const auto& linkedPrimaryKeys : linkedTuples.linkedPrimaryKeysPerRow)
+    {
+      const auto& linkedPrimaryKey = linkedPrimaryKeys.at(0);
+      if (!linkedPrimaryKey.hasValue(parentColumnId))
+      {
+        throw DatabaseException(DatabaseException::Type::QueryError,
+          QString("Missing primary key of tuple hat should be linked ('%1').").arg(parentTable.columns.at(parentColumnId).name));
+      }
+      foreignKeyValues.append(linkedPrimaryKey.value(parentColumnId));
+    }
+
+    m_values.emplace_back(foreignKeyReferences[0].primaryForeignKeyColIdMap.at(parentColumnId), foreignKeyValues);
+  }
+}
+
+std::shared_ptr<std::vector<PrimaryKey>> BatchInsertIntoExt::createInsertedKeys(const API::Table& table, int numRows) const
+{
+  auto insertedKeys = std::make_shared<std::vector<PrimaryKey>>();
+
+  std::vector<const QVariantList*> primaryKeyValues;
+  for (const auto& primaryKeyColumnId : table.primaryKeys)
+  {
+    const auto it = std::find_if(m_values.cbegin(), m_values.cend(), [&primaryKeyColumnId](const auto& value)
+    {
+      return value.first == primaryKeyColumnId;
+    });
+
+    if (it == m_values.cend())
+    {
+      return insertedKeys;
+    }
+    primaryKeyValues.emplace_back(&it->second);
+  }
+
+  insertedKeys->reserve(numRows);
+  for (auto i=0; i<numRows; ++i)
+  {
+    insertedKeys->emplace_back(m_tableId, primaryKeyValues.size(), [&table, &primaryKeyValues, i](size_t j)
+    {
+      return PrimaryKey::ColumnValue { table.primaryKeys.at(j), primaryKeyValues.at(j)->at(i) };
+    });
+  }
+  return insertedKeys;
+}
+
+void BatchInsertIntoExt::addInsertQueries(const API::Table& table,
+  std::shared_ptr<std::vector<PrimaryKey>> insertedKeys, int numRows)
+{
+  std::unique_ptr<BatchInsertInto> insertQuery;
+  if (!insertedKeys || !insertedKeys->empty() || numRows == 0)
+  {
+    insertQuery = std::make_unique<BatchInsertInto>(ID(m_tableId));
+  }
+  else if (BatchInsertGeneratedKeys::isSupported(table))
+  {
+    // the order of rows returned by RETURNING clauses is undefined, so that the keys are assigned explicitly
+    insertQuery = std::make_unique<BatchInsertGeneratedKeys>(m_tableId, numRows, insertedKeys);
+  }
+  else
+  {
+    throw DatabaseException(DatabaseException::Type::InvalidSyntax,
+      QString("Rows of table '%1' can only be linked without primary key values, if the table has a single integer "
+        "primary key.").arg(table.name));
+  }
+
+  for (const auto& value : m_values)
+  {
+    insertQuery->values(ID(value.first), value.second);
+  }
+  addQuery(std::move(insertQuery));
+}
+
+void BatchInsertIntoExt::addLinkTuplesQuery(
+  API::ISchema& schema, API::IID::Type relationshipId,
+  const API::Relationship& relationship,
+  const std::shared_ptr<std::vector<PrimaryKey>>& insertedKeys)
+{
+  const auto& linkedPrimaryKeysPerRow = m_linkedTuplesMap.at(relationshipId).linkedPrimaryKeysPerRow;
+  const auto linkedTableId = (relationship.tableFromId == m_tableId ? relationship.tableToId : relationship.tableFromId);
+
+  if (relationship.type == API::RelationshipType::ManyToMany)
+  {
+    const auto linkTableId = schema.getManyToManyLinkTableId(relationshipId);
+    const auto& linkTable = schema.getTables().at(linkTableId);
+
+    const auto isSelfRelationship = (linkedTableId == m_tableId);
+
+    const auto& foreignKeyRefsInsertedList = linkTable.relationshipToForeignKeyReferencesMap.at({ relationshipId, m_tableId });
+    const auto& foreignKeyRefsLinkedList = linkTable.relationshipToForeignKeyReferencesMap.at({ relationshipId, linkedTableId });
+
+    if ((isSelfRelationship && foreignKeyRefsInsertedList.size() != 2) ||
+      (!isSelfRelationship && (foreignKeyRefsInsertedList.size() != 1 || foreignKeyRefsLinkedList.size() != 1)))
+    {
+      throw DatabaseException(DatabaseException::Type::UnexpectedError,
+        "Foreign key references table seems to be corrupted.");
+    }
+
+    addQuery(std::make_unique<BatchInsertLinkRows>(
+      linkTableId,
+      foreignKeyRefsInsertedList[0].primaryForeignKeyColIdMap,
+      (isSelfRelationship ? foreignKeyRefsLinkedList[1] : foreignKeyRefsLinkedList[0]).primaryForeignKeyColIdMap,
+      insertedKeys,
+      linkedPrimaryKeysPerRow));
+    return;
+  }
+
+  const auto& childTable = schema.getTables().at(linkedTableId);
+  const auto& foreignKeyRefs = childTable.relationshipToForeignKeyReferencesMap.at({ relationshipId, m_tableId });
+  if (foreignKeyRefs.size() != 1)
+  {
+    throw DatabaseException(DatabaseException::Type::UnexpectedError,
+      "Foreign key references table seems to be corrupted.");
+  }
+
+  addQuery(std::make_unique<BatchUpdateLinkedChildren>(
+    linkedTableId,
+    foreignKeyRefs[0].primaryForeignKeyColIdMap,
+    insertedKeys,
+    linkedPrimaryKeysPerRow));
+}
+
+}
@@ -0,0 +1,63 @@
+#include "BatchInsertLinkRows.h"
+
+#include "QtSqlLib/DatabaseException.h"
+#include "QtSqlLib/ID.h"
+
+#include <map>
+
+namespace QtSqlLib::Query
+{
+
+static void appendKeyValues(std::map<API::IID::Type, QVariantList>& colValuesMap, const PrimaryKey& keyValues,
+  const API::PrimaryForeignKeyColumnIdMap& primaryForeignKeyColIdMap)
+{
+  for (const auto& primaryForeignKeyPair : primaryForeignKeyColIdMap)
+  {
+    colValuesMap[primaryForeignKeyPair.second].append(keyValues.value(primaryForeignKeyPair.first));
+  }
+}
+
+BatchInsertLinkRows::BatchInsertLinkRows(
+  API::IID::Type linkTableId,
+  const API::PrimaryForeignKeyColumnIdMap& insertedPrimaryForeignKeyColIdMap,
+  const API::PrimaryForeignKeyColumnIdMap& linkedPrimaryForeignKeyColIdMap,
+  std::shared_ptr<const std::vector<PrimaryKey>> insertedKeys,
+  std::vector<std::vector<PrimaryKey>> linkedKeysLists)
+  : BatchInsertInto(ID(linkTableId))
+  , m_insertedPrimaryForeignKeyColIdMap(insertedPrimaryForeignKeyColIdMap)
+  , m_linkedPrimaryForeignKeyColIdMap(linkedPrimaryForeignKeyColIdMap)
+  , m_insertedKeys(std::move(insertedKeys))
+  , m_linkedKeysLists(std::move(linkedKeysLists))
+{
+}
+
+BatchInsertLinkRows::~BatchInsertLinkRows() = default;
+
+API::IQuery::SqlQuery BatchInsertLinkRows::getSqlQuery(const QSqlDatabase& db, API::ISchema& schema,
+  ResultSet& previousQueryResults)
+{
+  if (m_insertedKeys->size() != m_linkedKeysLists.size())
+  {
+    throw DatabaseException(DatabaseException::Type::UnexpectedError,
+      "Number of inserted keys does not match the number of inserted rows.");
+  }
+
+  std::map<API::IID::Type, QVariantList> colValuesMap;
+  for (size_t i=0; i<m_linkedKeysLists.size(); ++i)
+  {
+    for (const auto& linkedKey : m_linkedKeysLists.at(i))
+    {
+      appendKeyValues(colValuesMap, m_insertedKeys->at(i), m_insertedPrimaryForeignKeyColIdMap);
+      appendKeyValues(colValuesMap, linkedKey, m_linkedPrimaryForeignKeyColIdMap);
+    }
+  }
+
+  for (const auto& column : colValuesMap)
+  {
+    values(ID(column.first), column.second);
+  }
+
+  return BatchInsertInto::getSqlQuery(db, schema, previousQueryResults);
+}
+
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+#include "QtSqlLib/Query/BatchInsertInto.h"
+
+#include "QtSqlLib/API/SchemaTypes.h"
+#include "QtSqlLib/PrimaryKey.h"
+
+#include <memory>
+#include <vector>
+
+namespace QtSqlLib::Query
+{
+
+/**
+ * Inserts the link table rows between each inserted tuple and its linked tuples. The keys of the inserted tuples are
+ * resolved when the query is executed.
+ */
+class BatchInsertLinkRows : public BatchInsertInto
+{
+public:
+  BatchInsertLinkRows(
+    API::IID::Type linkTableId,
+    const API::PrimaryForeignKeyColumnIdMap& insertedPrimaryForeignKeyColIdMap,
+    const API::PrimaryForeignKeyColumnIdMap& linkedPrimaryForeignKeyColIdMap,
+    std::shared_ptr<const std::vector<PrimaryKey>> insertedKeys,
+    std::vector<std::vector<PrimaryKey>> linkedKeysLists);
+  ~BatchInsertLinkRows() override;
+
+  SqlQuery getSqlQuery(const QSqlDatabase& db, API::ISchema& schema, ResultSet& previousQueryResults) override;
+
+private:
+  const API::PrimaryForeignKeyColumnIdMap& m_insertedPrimaryForeignKeyColIdMap;
+  const API::PrimaryForeignKeyColumnIdMap& m_linkedPrimaryForeignKeyColIdMap;
+  std::shared_ptr<const std::vector<PrimaryKey>> m_insertedKeys;
+  std::vector<std::vector<PrimaryKey>> m_linkedKeysLists;
+
+};
+
+}
@@ -0,0 +1,90 @@
+#include "BatchUpdateForeignKeys.h"
+
+#include "QtSqlLib/DatabaseException.h"
+
+namespace QtSqlLib::Query
+{
+
+BatchUpdateForeignKeys::BatchUpdateForeignKeys(
+  API::IID::Type tableId,
+  const API::PrimaryForeignKeyColumnIdMap& primaryForeignKeyColIdMap)
+  : BatchUpdateRows(tableId)
+  , m_remainingKeysMode(RelationshipPreparationData::RemainingKeysMode::NoRemainingKeys)
+  , m_primaryForeignKeyColIdMap(primaryForeignKeyColIdMap)
+  , m_numTuples(0)
+{
+}
+
+BatchUpdateForeignKeys::~BatchUpdateForeignKeys() = default;
+
+void BatchUpdateForeignKeys::setRemainingKeysMode(RelationshipPreparationData::RemainingKeysMode mode)
+{
+  m_remainingKeysMode = mode;
+}
+
+void BatchUpdateForeignKeys::addForeignKeyValues(const PrimaryKey& parentKeyValues)
+{
+  for (const auto& parentKeyValue : parentKeyValues.values())
+  {
+    appendValue(m_primaryForeignKeyColIdMap.at(parentKeyValue.columnId), parentKeyValue.value);
+  }
+}
+
+void BatchUpdateForeignKeys::addNullForeignKeyValues()
+{
+  for (const auto& primaryForeignKeyPair : m_primaryForeignKeyColIdMap)
+  {
+    appendValue(primaryForeignKeyPair.second, QVariant());
+  }
+}
+
+void BatchUpdateForeignKeys::addChildKeyValues(const PrimaryKey& affectedChildKeyValues)
+{
+  for (const auto& childKeyValue : affectedChildKeyValues.values())
+  {
+    appendKeyValue(childKeyValue.columnId, childKeyValue.value);
+  }
+  m_numTuples++;
+}
+
+API::IQuery::SqlQuery BatchUpdateForeignKeys::getSqlQuery(const QSqlDatabase& db, API::ISchema& schema,
+  ResultSet& previousQueryResults)
+{
+  if (m_remainingKeysMode != RelationshipPreparationData::RemainingKeysMode::NoRemainingKeys)
+  {
+    if (!previousQueryResults.isValid() || !previousQueryResults.hasNextTuple())
+    {
+      throw DatabaseException(DatabaseException::Type::InvalidSyntax,
+        "Expected previous query results.");
+    }
+
+    const auto remainingKeyValues = previousQueryResults.nextTuple().primaryKey();
+    previousQueryResults.resetIteration();
+
+    // the remaining key is the same for all tuples of the batch
+    if (m_remainingKeysMode == RelationshipPreparationData::RemainingKeysMode::RemainingForeignKeys)
+    {
+      clearValues();
+      for (auto i=0; i<m_numTuples; ++i)
+      {
+        addForeignKeyValues(remainingKeyValues);
+      }
+    }
+    else
+    {
+      const auto numTuples = getNumRows();
+      clearKeyValues();
+      for (auto i=0; i<numTuples; ++i)
+      {
+        for (const auto& keyValue : remainingKeyValues.values())
+        {
+          appendKeyValue(keyValue.columnId, keyValue.value);
+        }
+      }
+    }
+  }
+
+  return BatchUpdateRows::getSqlQuery(db, schema, previousQueryResults);
+}
+
+}
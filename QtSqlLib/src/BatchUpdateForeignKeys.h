@@ -1,31 +1,36 @@
 #pragma once
 
-#include "QtSqlLib/Query/UpdateTable.h"
-
 #include "QtSqlLib/PrimaryKey.h"
 #include "QtSqlLib/RelationshipPreparationData.h"
 
+#include "BatchUpdateRows.h"
+
 namespace QtSqlLib::Query
 {
 
-class UpdateTableForeignKeys : public UpdateTable
+/**
+ * Updates the foreign keys of many child tuples by a single prepared statement executed in batch mode.
+ */
+class BatchUpdateForeignKeys : public BatchUpdateRows
 {
 public:
-  UpdateTableForeignKeys(
+  BatchUpdateForeignKeys(
     API::IID::Type tableId,
     const API::PrimaryForeignKeyColumnIdMap& primaryForeignKeyColIdMap);
-  ~UpdateTableForeignKeys() override;
+  ~BatchUpdateForeignKeys() override;
 
   void setRemainingKeysMode(RelationshipPreparationData::RemainingKeysMode mode);
-  void setForeignKeyValues(const PrimaryKey& parentKeyValues);
-  void makeAndAddWhereExpr(const PrimaryKey& affectedChildKeyValues);
+  void addForeignKeyValues(const PrimaryKey& parentKeyValues);
+  void addNullForeignKeyValues();
+  void addChildKeyValues(const PrimaryKey& affectedChildKeyValues);
 
   SqlQuery getSqlQuery(const QSqlDatabase& db, API::ISchema& schema, ResultSet& previousQueryResults) override;
 
 private:
   RelationshipPreparationData::RemainingKeysMode m_remainingKeysMode;
   const API::PrimaryForeignKeyColumnIdMap& m_primaryForeignKeyColIdMap;
+  int m_numTuples;
 
 };
 
-}
\ No newline at end of file
+}
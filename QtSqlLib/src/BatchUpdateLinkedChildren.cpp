@@ -0,0 +1,42 @@
+#include "BatchUpdateLinkedChildren.h"
+
+#include "QtSqlLib/DatabaseException.h"
+
+namespace QtSqlLib::Query
+{
+
+BatchUpdateLinkedChildren::BatchUpdateLinkedChildren(
+  API::IID::Type childTableId,
+  const API::PrimaryForeignKeyColumnIdMap& primaryForeignKeyColIdMap,
+  std::shared_ptr<const std::vector<PrimaryKey>> insertedKeys,
+  std::vector<std::vector<PrimaryKey>> childKeysLists)
+  : BatchUpdateForeignKeys(childTableId, primaryForeignKeyColIdMap)
+  , m_insertedKeys(std::move(insertedKeys))
+  , m_childKeysLists(std::move(childKeysLists))
+{
+}
+
+BatchUpdateLinkedChildren::~BatchUpdateLinkedChildren() = default;
+
+API::IQuery::SqlQuery BatchUpdateLinkedChildren::getSqlQuery(const QSqlDatabase& db, API::ISchema& schema,
+  ResultSet& previousQueryResults)
+{
+  if (m_insertedKeys->size() != m_childKeysLists.size())
+  {
+    throw DatabaseException(DatabaseException::Type::UnexpectedError,
+      "Number of inserted keys does not match the number of inserted rows.");
+  }
+
+  for (size_t i=0; i<m_childKeysLists.size(); ++i)
+  {
+    for (const auto& childKey : m_childKeysLists.at(i))
+    {
+      addForeignKeyValues(m_insertedKeys->at(i));
+      addChildKeyValues(childKey);
+    }
+  }
+
+  return BatchUpdateForeignKeys::getSqlQuery(db, schema, previousQueryResults);
+}
+
+}
@@ -0,0 +1,33 @@
+#pragma once
+
+#include "BatchUpdateForeignKeys.h"
+
+#include <memory>
+#include <vector>
+
+namespace QtSqlLib::Query
+{
+
+/**
+ * Sets the foreign keys of the child tuples linked to each inserted tuple. The keys of the inserted tuples are
+ * resolved when the query is executed.
+ */
+class BatchUpdateLinkedChildren : public BatchUpdateForeignKeys
+{
+public:
+  BatchUpdateLinkedChildren(
+    API::IID::Type childTableId,
+    const API::PrimaryForeignKeyColumnIdMap& primaryForeignKeyColIdMap,
+    std::shared_ptr<const std::vector<PrimaryKey>> insertedKeys,
+    std::vector<std::vector<PrimaryKey>> childKeysLists);
+  ~BatchUpdateLinkedChildren() override;
+
+  SqlQuery getSqlQuery(const QSqlDatabase& db, API::ISchema& schema, ResultSet& previousQueryResults) override;
+
+private:
+  std::shared_ptr<const std::vector<PrimaryKey>> m_insertedKeys;
+  std::vector<std::vector<PrimaryKey>> m_childKeysLists;
+
+};
+
+}
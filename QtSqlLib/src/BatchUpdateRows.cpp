@@ -0,0 +1,140 @@
+#include "BatchUpdateRows.h"
+
+#include "QtSqlLib/API/ISanityChecker.h"
+#include "QtSqlLib/API/ISchema.h"
+#include "QtSqlLib/DatabaseException.h"
+#include "QtSqlLib/StatementCache.h"
+
+#include <functional>
+
+namespace QtSqlLib::Query
+{
+
+static QString joinColumnNames(const API::Table& table, const BatchUpdateRows::ColumnValues& columnValues,
+  const QString& separator)
+{
+  QString result;
+  for (const auto& values : columnValues)
+  {
+    if (!result.isEmpty())
+    {
+      result.append(separator);
+    }
+    result.append(QString("'%1' = ?").arg(table.columns.at(values.first).name));
+  }
+  return result;
+}
+
+BatchUpdateRows::BatchUpdateRows(API::IID::Type tableId)
+  : Query()
+  , m_tableId(tableId)
+{
+}
+
+BatchUpdateRows::~BatchUpdateRows() = default;
+
+void BatchUpdateRows::setValues(API::IID::Type columnId, const QVariantList& values)
+{
+  throwIfColumnIdAlreadyExisting(columnId);
+  m_values[columnId] = values;
+}
+
+void BatchUpdateRows::setKeyValues(API::IID::Type columnId, const QVariantList& values)
+{
+  throwIfColumnIdAlreadyExisting(columnId);
+  m_keyValues[columnId] = values;
+}
+
+const BatchUpdateRows::ColumnValues& BatchUpdateRows::getValues() const
+{
+  return m_values;
+}
+
+const BatchUpdateRows::ColumnValues& BatchUpdateRows::getKeyValues() const
+{
+  return m_keyValues;
+}
+
+void BatchUpdateRows::throwIfInvalidColumnValues(API::ISchema& schema, const API::Table& table) const
+{
+  if (m_values.empty() || m_keyValues.empty())
+  {
+    throw DatabaseException(DatabaseException::Type::InvalidSyntax,
+      "Batch update queries need at least one value column and one key column.");
+  }
+
+  const auto numRows = getNumRows();
+  for (const auto& columnValues : { std::cref(m_values), std::cref(m_keyValues) })
+  {
+    for (const auto& values : columnValues.get())
+    {
+      schema.getSanityChecker().throwIfColumnIdNotExisting(table, values.first);
+      if (values.second.size() != numRows)
+      {
+        throw DatabaseException(DatabaseException::Type::InvalidSyntax,
+          "All columns of a batch update query need the same number of values.");
+      }
+    }
+  }
+}
+
+API::IQuery::SqlQuery BatchUpdateRows::getSqlQuery(const QSqlDatabase& db, API::ISchema& schema,
+  ResultSet& /*previousQueryResults*/)
+{
+  schema.getSanityChecker().throwIfTableIdNotExisting(m_tableId);
+  const auto& table = schema.getTables().at(m_tableId);
+
+  throwIfInvalidColumnValues(schema, table);
+
+  auto query = StatementCache::prepare(db, QString("UPDATE '%1' SET %2 WHERE %3;")
+    .arg(table.name)
+    .arg(joinColumnNames(table, m_values, ", "))
+    .arg(joinColumnNames(table, m_keyValues, " AND ")));
+
+  for (const auto& values : m_values)
+  {
+    query.addBindValue(values.second);
+  }
+  for (const auto& values : m_keyValues)
+  {
+    query.addBindValue(values.second);
+  }
+
+  return { std::move(query), QueryMode::Batch };
+}
+
+void BatchUpdateRows::appendValue(API::IID::Type columnId, const QVariant& value)
+{
+  m_values[columnId].append(value);
+}
+
+void BatchUpdateRows::appendKeyValue(API::IID::Type columnId, const QVariant& value)
+{
+  m_keyValues[columnId].append(value);
+}
+
+void BatchUpdateRows::clearValues()
+{
+  m_values.clear();
+}
+
+void BatchUpdateRows::clearKeyValues()
+{
+  m_keyValues.clear();
+}
+
+int BatchUpdateRows::getNumRows() const
+{
+  return m_values.empty() ? 0 : static_cast<int>(m_values.cbegin()->second.size());
+}
+
+void BatchUpdateRows::throwIfColumnIdAlreadyExisting(API::IID::Type columnId) const
+{
+  if ((m_values.count(columnId) > 0) || (m_keyValues.count(columnId) > 0))
+  {
+    throw DatabaseException(DatabaseException::Type::InvalidId,
+      QString("More than one column with id %1 specified.").arg(columnId));
+  }
+}
+
+}
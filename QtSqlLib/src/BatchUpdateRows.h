@@ -0,0 +1,59 @@
+#pragma once
+
+#include "QtSqlLib/Query/Query.h"
+
+#include "QtSqlLib/API/IID.h"
+
+#include <QVariant>
+
+#include <map>
+
+namespace QtSqlLib::API
+{
+struct Table;
+}
+
+namespace QtSqlLib::Query
+{
+
+/**
+ * Updates many tuples to different values by a single prepared statement executed in batch mode. Each row of the
+ * value lists updates the tuples matching the key values of the same row.
+ */
+class BatchUpdateRows : public Query
+{
+public:
+  using ColumnValues = std::map<API::IID::Type, QVariantList>;
+
+  BatchUpdateRows(API::IID::Type tableId);
+  ~BatchUpdateRows() override;
+
+  void setValues(API::IID::Type columnId, const QVariantList& values);
+  void setKeyValues(API::IID::Type columnId, const QVariantList& values);
+
+  const ColumnValues& getValues() const;
+  const ColumnValues& getKeyValues() const;
+
+  void throwIfInvalidColumnValues(API::ISchema& schema, const API::Table& table) const;
+
+  SqlQuery getSqlQuery(const QSqlDatabase& db, API::ISchema& schema, ResultSet& previousQueryResults) override;
+
+protected:
+  void appendValue(API::IID::Type columnId, const QVariant& value);
+  void appendKeyValue(API::IID::Type columnId, const QVariant& value);
+  void clearValues();
+  void clearKeyValues();
+
+  int getNumRows() const;
+
+private:
+  API::IID::Type m_tableId;
+
+  ColumnValues m_values;
+  ColumnValues m_keyValues;
+
+  void throwIfColumnIdAlreadyExisting(API::IID::Type columnId) const;
+
+};
+
+}
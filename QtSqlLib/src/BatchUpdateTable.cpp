@@ -0,0 +1,123 @@
+#include "QtSqlLib/Query/BatchUpdateTable.h"
+
+#include "QtSqlLib/API/ISanityChecker.h"
+#include "QtSqlLib/API/ISchema.h"
+
+#include "BatchUpdateRows.h"
+#include "StatementQuery.h"
+
+namespace QtSqlLib::Query
+{
+
+static const QString s_stagingTableName = "qtsqllib_batch_update_staging";
+
+static QString joinColumnNames(const API::Table& table, const BatchUpdateRows::ColumnValues& columnValues,
+  const QString& format, const QString& separator)
+{
+  QString result;
+  for (const auto& values : columnValues)
+  {
+    if (!result.isEmpty())
+    {
+      result.append(separator);
+    }
+    result.append(QString(format).replace("%1", table.columns.at(values.first).name));
+  }
+  return result;
+}
+
+BatchUpdateTable::BatchUpdateTable(const API::IID& tableId)
+  : QuerySequence()
+  , m_tableId(tableId.get())
+  , m_bIsUsingStagingTable(false)
+  , m_batchUpdateRows(std::make_unique<BatchUpdateRows>(tableId.get()))
+{
+}
+
+BatchUpdateTable::~BatchUpdateTable() = default;
+
+BatchUpdateTable& BatchUpdateTable::values(const API::IID& columnId, const QVariantList& values)
+{
+  m_batchUpdateRows->setValues(columnId.get(), values);
+  return *this;
+}
+
+BatchUpdateTable& BatchUpdateTable::keyValues(const API::IID& columnId, const QVariantList& values)
+{
+  m_batchUpdateRows->setKeyValues(columnId.get(), values);
+  return *this;
+}
+
+BatchUpdateTable& BatchUpdateTable::useStagingTable()
+{
+  m_bIsUsingStagingTable = true;
+  return *this;
+}
+
+void BatchUpdateTable::prepare(API::ISchema& schema)
+{
+  schema.getSanityChecker().throwIfTableIdNotExisting(m_tableId);
+  const auto& table = schema.getTables().at(m_tableId);
+
+  m_batchUpdateRows->throwIfInvalidColumnValues(schema, table);
+
+  if (m_bIsUsingStagingTable)
+  {
+    addStagingTableQueries(table);
+    return;
+  }
+
+  addQuery(std::move(m_batchUpdateRows));
+}
+
+void BatchUpdateTable::addStagingTableQueries(const API::Table& table)
+{
+  // the staging table lives in the temp schema of the connection and is part of the query's transaction
+  const auto& values = m_batchUpdateRows->getValues();
+  const auto& keyValues = m_batchUpdateRows->getKeyValues();
+
+  const auto keyColumns = joinColumnNames(table, keyValues, "'%1'", ", ");
+  const auto valueColumns = joinColumnNames(table, values, "'%1'", ", ");
+  const auto dropString = QString("DROP TABLE IF EXISTS temp.'%1';").arg(s_stagingTableName);
+
+  // a staging table left behind by a failed query is dropped first
+  addQuery(std::make_unique<StatementQuery>(dropString));
+  addQuery(std::make_unique<StatementQuery>(QString("CREATE TEMP TABLE '%1' (%2, %3);")
+    .arg(s_stagingTableName).arg(keyColumns).arg(valueColumns)));
+  addQuery(std::make_unique<StatementQuery>(QString("CREATE INDEX temp.'%1_keys' ON '%1' (%2);")
+    .arg(s_stagingTableName).arg(keyColumns)));
+
+  auto insertQuery = std::make_unique<StatementQuery>(QString("INSERT INTO temp.'%1' (%2, %3) VALUES (%4);")
+    .arg(s_stagingTableName).arg(keyColumns).arg(valueColumns)
+    .arg(QString("?, ").repeated(static_cast<int>(keyValues.size() + values.size() - 1)) + "?"),
+    API::IQuery::QueryMode::Batch);
+
+  for (const auto& columnValues : keyValues)
+  {
+    insertQuery->addBindValue(columnValues.second);
+  }
+  for (const auto& columnValues : values)
+  {
+    insertQuery->addBindValue(columnValues.second);
+  }
+  addQuery(std::move(insertQuery));
+
+  // the last row of a key wins, like in the batch mode
+  const auto stagingRowString = QString("FROM temp.'%1' AS staging WHERE %2")
+    .arg(s_stagingTableName)
+    .arg(joinColumnNames(table, keyValues, QString("staging.'%1' = '%2'.'%1'").replace("%2", table.name), " AND "));
+
+  const auto setString = (values.size() == 1)
+    ? QString("%1 = (SELECT staging.%1 %2 ORDER BY staging.rowid DESC LIMIT 1)")
+      .arg(valueColumns).arg(stagingRowString)
+    : QString("(%1) = (SELECT %2 %3 ORDER BY staging.rowid DESC LIMIT 1)")
+      .arg(valueColumns)
+      .arg(joinColumnNames(table, values, "staging.'%1'", ", "))
+      .arg(stagingRowString);
+
+  addQuery(std::make_unique<StatementQuery>(QString("UPDATE '%1' SET %2 WHERE EXISTS (SELECT 1 %3);")
+    .arg(table.name).arg(setString).arg(stagingRowString)));
+  addQuery(std::make_unique<StatementQuery>(dropString));
+}
+
+}
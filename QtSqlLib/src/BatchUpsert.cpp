@@ -0,0 +1,67 @@
+#include "QtSqlLib/Query/BatchUpsert.h"
+
+namespace QtSqlLib::Query
+{
+
+BatchUpsert::BatchUpsert(const API::IID& tableId)
+  : BatchInsertInto(tableId)
+{
+}
+
+BatchUpsert::~BatchUpsert() = default;
+
+BatchUpsert& BatchUpsert::values(const API::IID& columnId, const QVariantList& values)
+{
+  BatchInsertInto::values(columnId, values);
+  return *this;
+}
+
+BatchUpsert& BatchUpsert::returnIds()
+{
+  setReturningIds();
+  return *this;
+}
+
+BatchUpsert& BatchUpsert::onConflictPrimaryKey()
+{
+  m_conflictClause.setTarget(ConflictClause::Target::PrimaryKey);
+  return *this;
+}
+
+BatchUpsert& BatchUpsert::onConflictUniqueCols()
+{
+  m_conflictClause.setTarget(ConflictClause::Target::UniqueColumns);
+  return *this;
+}
+
+BatchUpsert& BatchUpsert::keep(const API::IID& columnId)
+{
+  m_conflictClause.setColumnAction(columnId.get(), ConflictClause::Action::Keep);
+  return *this;
+}
+
+BatchUpsert& BatchUpsert::overwrite(const API::IID& columnId)
+{
+  m_conflictClause.setColumnAction(columnId.get(), ConflictClause::Action::Overwrite);
+  return *this;
+}
+
+BatchUpsert& BatchUpsert::overwriteIf(const API::IID& columnId, Expr& condition)
+{
+  m_conflictClause.setColumnOverwriteCondition(columnId.get(), condition);
+  return *this;
+}
+
+BatchUpsert& BatchUpsert::doNothing()
+{
+  m_conflictClause.setDoNothing();
+  return *this;
+}
+
+QString BatchUpsert::createConflictString(API::ISchema& schema, API::IID::Type tableId,
+  const ColumnHelper::ColumnList& columns, std::vector<QVariant>& boundValuesOut) const
+{
+  return m_conflictClause.toQueryString(schema, tableId, columns, boundValuesOut);
+}
+
+}
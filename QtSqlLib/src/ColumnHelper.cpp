@@ -12,6 +12,13 @@ ColumnHelper::ColumnAlias::ColumnAlias(const QString& alias) :
 {
 }
 
+ColumnHelper::Parameter::Parameter() = default;
+
+ColumnHelper::Parameter::Parameter(const QString& name) :
+  name(name)
+{
+}
+
 ColumnHelper::SelectColumn::SelectColumn() = default;
 
 ColumnHelper::SelectColumn::SelectColumn(const ConcatenatedColumn& concatenatedColumn, const QString& alias) :
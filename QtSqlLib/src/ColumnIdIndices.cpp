@@ -0,0 +1,38 @@
+#include "ColumnIdIndices.h"
+
+namespace QtSqlLib
+{
+
+std::vector<int> ColumnIdIndices::create(const API::QueryMetaInfo& queryMetaInfo, IndexType indexType)
+{
+  std::vector<int> columnIdIndices;
+  for (size_t i=0; i<queryMetaInfo.columns.size(); ++i)
+  {
+    const auto& column = queryMetaInfo.columns.at(i).column;
+    if (!column.canConvert<API::IID::Type>())
+    {
+      continue;
+    }
+
+    const auto columnId = column.value<API::IID::Type>();
+    if (columnId < 0 || columnId >= maxDenseColumnId)
+    {
+      return {};
+    }
+
+    if (columnIdIndices.size() <= static_cast<size_t>(columnId))
+    {
+      columnIdIndices.resize(columnId + 1, -1);
+    }
+
+    if (columnIdIndices[columnId] < 0)
+    {
+      columnIdIndices[columnId] = static_cast<int>(indexType == IndexType::QueryIndex
+        ? queryMetaInfo.columnQueryIndices.at(i)
+        : i);
+    }
+  }
+  return columnIdIndices;
+}
+
+}
@@ -0,0 +1,33 @@
+#pragma once
+
+#include "QtSqlLib/API/IID.h"
+#include "QtSqlLib/API/SchemaTypes.h"
+
+#include <vector>
+
+namespace QtSqlLib
+{
+
+/**
+ * Dense lookup tables mapping the column ids of a query meta info to the indices of the columns.
+ */
+class ColumnIdIndices
+{
+public:
+  enum class IndexType
+  {
+    ColumnIndex,
+    QueryIndex
+  };
+
+  ColumnIdIndices() = delete;
+
+  // the table is empty for negative ids or ids of maxDenseColumnId and above, callers search linearly then
+  static std::vector<int> create(const API::QueryMetaInfo& queryMetaInfo, IndexType indexType);
+
+private:
+  static constexpr API::IID::Type maxDenseColumnId = 4096;
+
+};
+
+}
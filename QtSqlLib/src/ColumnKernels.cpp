@@ -0,0 +1,398 @@
+#include "QtSqlLib/ColumnKernels.h"
+
+#include "QtSqlLib/ColumnarResult.h"
+#include "QtSqlLib/DatabaseException.h"
+
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <limits>
+
+namespace QtSqlLib
+{
+
+// The kernels process the rows in blocks of 64 with branchless inner loops over contiguous values, so that the
+// compiler is able to vectorize them.
+
+static void throwIfSelectionMismatch(const ColumnBuffer& column, const ColumnKernels::Selection* selection)
+{
+  if (selection && selection->size() != column.validityBitmap().size())
+  {
+    throw DatabaseException(DatabaseException::Type::UnexpectedError, "Selection does not match the column size.");
+  }
+}
+
+static uint64_t blockMask(const ColumnBuffer& column, const ColumnKernels::Selection* selection, size_t block)
+{
+  auto mask = column.validityBitmap()[block];
+  if (selection)
+  {
+    mask &= (*selection)[block];
+  }
+  return mask;
+}
+
+template <typename TValue, typename TReduceFunc>
+static void reduceBlocks(
+  const std::vector<TValue>& values, const ColumnBuffer& column,
+  const ColumnKernels::Selection* selection, TReduceFunc&& reduceFunc)
+{
+  throwIfSelectionMismatch(column, selection);
+
+  const auto numBlocks = column.validityBitmap().size();
+  for (size_t block=0; block<numBlocks; ++block)
+  {
+    const auto mask = blockMask(column, selection, block);
+    if (mask == 0ULL)
+    {
+      continue;
+    }
+
+    const auto begin = block * 64;
+    reduceFunc(values.data() + begin, std::min<size_t>(64, values.size() - begin), mask);
+  }
+}
+
+template <typename TValue, typename TCompareFunc>
+static void filterBlocks(const std::vector<TValue>& values, ColumnKernels::Selection& result, TCompareFunc&& compareFunc)
+{
+  for (size_t block=0; block<result.size(); ++block)
+  {
+    const auto begin = block * 64;
+    const auto numValues = std::min<size_t>(64, values.size() - begin);
+    const auto* blockValues = values.data() + begin;
+
+    uint64_t matches = 0ULL;
+    for (size_t i=0; i<numValues; ++i)
+    {
+      matches |= static_cast<uint64_t>(compareFunc(blockValues[i])) << i;
+    }
+    result[block] &= matches;
+  }
+}
+
+template <typename TValue, typename TRhs>
+static void filterNumeric(
+  const std::vector<TValue>& values, EComparisonOperator op, TRhs rhs, ColumnKernels::Selection& result)
+{
+  switch (op)
+  {
+  case EComparisonOperator::Equal:
+  case EComparisonOperator::Is:
+    filterBlocks(values, result, [rhs](TValue value) { return value == rhs; });
+    return;
+  case EComparisonOperator::Unequal:
+  case EComparisonOperator::Not:
+    filterBlocks(values, result, [rhs](TValue value) { return value != rhs; });
+    return;
+  case EComparisonOperator::Less:
+    filterBlocks(values, result, [rhs](TValue value) { return value < rhs; });
+    return;
+  case EComparisonOperator::LessEqual:
+    filterBlocks(values, result, [rhs](TValue value) { return value <= rhs; });
+    return;
+  case EComparisonOperator::Greater:
+    filterBlocks(values, result, [rhs](TValue value) { return value > rhs; });
+    return;
+  case EComparisonOperator::GreaterEqual:
+    filterBlocks(values, result, [rhs](TValue value) { return value >= rhs; });
+    return;
+  default:
+    break;
+  }
+
+  throw DatabaseException(DatabaseException::Type::InvalidSyntax, "Comparison operator not supported by column filter.");
+}
+
+static void filterBytes(
+  const ColumnBuffer& column, EComparisonOperator op, const QByteArray& rhs, ColumnKernels::Selection& result)
+{
+  const auto isEqual = (op == EComparisonOperator::Equal || op == EComparisonOperator::Is);
+  if (!isEqual && op != EComparisonOperator::Unequal && op != EComparisonOperator::Not)
+  {
+    throw DatabaseException(DatabaseException::Type::InvalidSyntax, "Comparison operator not supported by column filter.");
+  }
+
+  const auto& offsets = column.offsets();
+  const auto* data = column.data().constData();
+
+  for (size_t block=0; block<result.size(); ++block)
+  {
+    auto mask = result[block];
+    while (mask != 0ULL)
+    {
+      const auto bit = std::countr_zero(mask);
+      const auto row = block * 64 + bit;
+      const auto length = offsets[row + 1] - offsets[row];
+
+      const auto matches = (length == rhs.size() && std::memcmp(data + offsets[row], rhs.constData(), length) == 0);
+      if (matches != isEqual)
+      {
+        result[block] &= ~(1ULL << bit);
+      }
+      mask &= mask - 1;
+    }
+  }
+}
+
+static bool isIntegerVariant(const QVariant& value)
+{
+  const auto type = value.userType();
+  return type == QMetaType::Bool || type == QMetaType::Int || type == QMetaType::UInt ||
+    type == QMetaType::LongLong || type == QMetaType::ULongLong;
+}
+
+ColumnKernels::Selection ColumnKernels::filter(
+  const ColumnBuffer& column, EComparisonOperator op, const QVariant& value,
+  const Selection* selection)
+{
+  throwIfSelectionMismatch(column, selection);
+
+  Selection result = column.validityBitmap();
+  if (selection)
+  {
+    result = intersect(result, *selection);
+  }
+
+  if (value.isNull())
+  {
+    if (op == EComparisonOperator::Is)
+    {
+      // selects the null rows
+      auto nullRows = selection ? *selection : selectAll(column.size());
+      for (size_t block=0; block<nullRows.size(); ++block)
+      {
+        nullRows[block] &= ~column.validityBitmap()[block];
+      }
+      return nullRows;
+    }
+    if (op == EComparisonOperator::Not)
+    {
+      return result;
+    }
+
+    throw DatabaseException(DatabaseException::Type::InvalidSyntax, "Null values can only be compared with IS or NOT.");
+  }
+
+  switch (column.type())
+  {
+  case ColumnBuffer::Type::Null:
+    std::fill(result.begin(), result.end(), 0ULL);
+    break;
+  case ColumnBuffer::Type::Int64:
+    if (isIntegerVariant(value))
+    {
+      filterNumeric(column.int64Values(), op, static_cast<int64_t>(value.toLongLong()), result);
+    }
+    else
+    {
+      filterNumeric(column.int64Values(), op, value.toDouble(), result);
+    }
+    break;
+  case ColumnBuffer::Type::Double:
+    filterNumeric(column.doubleValues(), op, value.toDouble(), result);
+    break;
+  case ColumnBuffer::Type::Text:
+    filterBytes(column, op, value.toString().toUtf8(), result);
+    break;
+  case ColumnBuffer::Type::Blob:
+    filterBytes(column, op, value.toByteArray(), result);
+    break;
+  }
+
+  return result;
+}
+
+ColumnKernels::Selection ColumnKernels::selectAll(size_t numRows)
+{
+  Selection selection((numRows + 63) / 64, ~0ULL);
+  if (numRows % 64 != 0)
+  {
+    selection.back() = (1ULL << (numRows % 64)) - 1ULL;
+  }
+  return selection;
+}
+
+ColumnKernels::Selection ColumnKernels::intersect(const Selection& lhs, const Selection& rhs)
+{
+  if (lhs.size() != rhs.size())
+  {
+    throw DatabaseException(DatabaseException::Type::UnexpectedError, "Cannot intersect selections of different sizes.");
+  }
+
+  Selection result(lhs.size());
+  for (size_t i=0; i<lhs.size(); ++i)
+  {
+    result[i] = lhs[i] & rhs[i];
+  }
+  return result;
+}
+
+size_t ColumnKernels::numSelected(const Selection& selection)
+{
+  size_t num = 0;
+  for (const auto word : selection)
+  {
+    num += static_cast<size_t>(std::popcount(word));
+  }
+  return num;
+}
+
+size_t ColumnKernels::count(const ColumnBuffer& column, const Selection* selection)
+{
+  throwIfSelectionMismatch(column, selection);
+
+  size_t num = 0;
+  for (size_t block=0; block<column.validityBitmap().size(); ++block)
+  {
+    num += static_cast<size_t>(std::popcount(blockMask(column, selection, block)));
+  }
+  return num;
+}
+
+int64_t ColumnKernels::sumInt64(const ColumnBuffer& column, const Selection* selection)
+{
+  if (column.type() == ColumnBuffer::Type::Null)
+  {
+    return 0;
+  }
+  if (column.type() != ColumnBuffer::Type::Int64)
+  {
+    throw DatabaseException(DatabaseException::Type::UnexpectedError, "Integer column expected.");
+  }
+
+  int64_t sum = 0;
+  reduceBlocks(column.int64Values(), column, selection, [&sum](const int64_t* values, size_t numValues, uint64_t mask)
+  {
+    int64_t blockSum = 0;
+    for (size_t i=0; i<numValues; ++i)
+    {
+      blockSum += values[i] & -static_cast<int64_t>((mask >> i) & 1ULL);
+    }
+    sum += blockSum;
+  });
+  return sum;
+}
+
+double ColumnKernels::sumDouble(const ColumnBuffer& column, const Selection* selection)
+{
+  switch (column.type())
+  {
+  case ColumnBuffer::Type::Null:
+    return 0.0;
+  case ColumnBuffer::Type::Int64:
+    return static_cast<double>(sumInt64(column, selection));
+  case ColumnBuffer::Type::Double:
+    break;
+  default:
+    throw DatabaseException(DatabaseException::Type::UnexpectedError, "Numeric column expected.");
+  }
+
+  double sum = 0.0;
+  reduceBlocks(column.doubleValues(), column, selection, [&sum](const double* values, size_t numValues, uint64_t mask)
+  {
+    double blockSum = 0.0;
+    for (size_t i=0; i<numValues; ++i)
+    {
+      blockSum += ((mask >> i) & 1ULL) ? values[i] : 0.0;
+    }
+    sum += blockSum;
+  });
+  return sum;
+}
+
+template <typename TValue, typename TSelectFunc>
+static std::optional<TValue> extremum(
+  const std::vector<TValue>& values, const ColumnBuffer& column,
+  const ColumnKernels::Selection* selection, TValue initialValue, TSelectFunc&& selectFunc)
+{
+  auto result = initialValue;
+  auto found = false;
+
+  reduceBlocks(values, column, selection, [&](const TValue* blockValues, size_t numValues, uint64_t mask)
+  {
+    auto blockResult = initialValue;
+    for (size_t i=0; i<numValues; ++i)
+    {
+      blockResult = selectFunc(blockResult, ((mask >> i) & 1ULL) ? blockValues[i] : initialValue);
+    }
+    result = selectFunc(result, blockResult);
+    found = true;
+  });
+
+  return found ? std::make_optional(result) : std::nullopt;
+}
+
+std::optional<int64_t> ColumnKernels::minInt64(const ColumnBuffer& column, const Selection* selection)
+{
+  if (column.type() == ColumnBuffer::Type::Null)
+  {
+    return std::nullopt;
+  }
+  if (column.type() != ColumnBuffer::Type::Int64)
+  {
+    throw DatabaseException(DatabaseException::Type::UnexpectedError, "Integer column expected.");
+  }
+
+  return extremum(column.int64Values(), column, selection, std::numeric_limits<int64_t>::max(),
+    [](int64_t lhs, int64_t rhs) { return std::min(lhs, rhs); });
+}
+
+std::optional<int64_t> ColumnKernels::maxInt64(const ColumnBuffer& column, const Selection* selection)
+{
+  if (column.type() == ColumnBuffer::Type::Null)
+  {
+    return std::nullopt;
+  }
+  if (column.type() != ColumnBuffer::Type::Int64)
+  {
+    throw DatabaseException(DatabaseException::Type::UnexpectedError, "Integer column expected.");
+  }
+
+  return extremum(column.int64Values(), column, selection, std::numeric_limits<int64_t>::min(),
+    [](int64_t lhs, int64_t rhs) { return std::max(lhs, rhs); });
+}
+
+std::optional<double> ColumnKernels::minDouble(const ColumnBuffer& column, const Selection* selection)
+{
+  switch (column.type())
+  {
+  case ColumnBuffer::Type::Null:
+    return std::nullopt;
+  case ColumnBuffer::Type::Int64:
+  {
+    const auto result = minInt64(column, selection);
+    return result ? std::make_optional(static_cast<double>(result.value())) : std::nullopt;
+  }
+  case ColumnBuffer::Type::Double:
+    break;
+  default:
+    throw DatabaseException(DatabaseException::Type::UnexpectedError, "Numeric column expected.");
+  }
+
+  return extremum(column.doubleValues(), column, selection, std::numeric_limits<double>::infinity(),
+    [](double lhs, double rhs) { return std::min(lhs, rhs); });
+}
+
+std::optional<double> ColumnKernels::maxDouble(const ColumnBuffer& column, const Selection* selection)
+{
+  switch (column.type())
+  {
+  case ColumnBuffer::Type::Null:
+    return std::nullopt;
+  case ColumnBuffer::Type::Int64:
+  {
+    const auto result = maxInt64(column, selection);
+    return result ? std::make_optional(static_cast<double>(result.value())) : std::nullopt;
+  }
+  case ColumnBuffer::Type::Double:
+    break;
+  default:
+    throw DatabaseException(DatabaseException::Type::UnexpectedError, "Numeric column expected.");
+  }
+
+  return extremum(column.doubleValues(), column, selection, -std::numeric_limits<double>::infinity(),
+    [](double lhs, double rhs) { return std::max(lhs, rhs); });
+}
+
+}
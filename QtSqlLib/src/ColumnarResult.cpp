@@ -0,0 +1,336 @@
+#include "QtSqlLib/ColumnarResult.h"
+
+#include "QtSqlLib/DatabaseException.h"
+#include "QtSqlLib/TupleView.h"
+
+namespace QtSqlLib
+{
+
+static ColumnBuffer::Type typeOfVariant(const QVariant& value)
+{
+  switch (value.userType())
+  {
+  case QMetaType::Bool:
+  case QMetaType::Int:
+  case QMetaType::UInt:
+  case QMetaType::LongLong:
+  case QMetaType::ULongLong:
+    return ColumnBuffer::Type::Int64;
+  case QMetaType::Float:
+  case QMetaType::Double:
+    return ColumnBuffer::Type::Double;
+  case QMetaType::QByteArray:
+    return ColumnBuffer::Type::Blob;
+  default:
+    break;
+  }
+
+  return ColumnBuffer::Type::Text;
+}
+
+ColumnBuffer::ColumnBuffer(const std::optional<API::IID::Type>& columnId, const QString& alias) :
+  m_columnId(columnId),
+  m_alias(alias),
+  m_type(Type::Null),
+  m_size(0)
+{
+}
+
+std::optional<API::IID::Type> ColumnBuffer::columnId() const
+{
+  return m_columnId;
+}
+
+const QString& ColumnBuffer::alias() const
+{
+  return m_alias;
+}
+
+ColumnBuffer::Type ColumnBuffer::type() const
+{
+  return m_type;
+}
+
+size_t ColumnBuffer::size() const
+{
+  return m_size;
+}
+
+bool ColumnBuffer::isNull(size_t row) const
+{
+  throwIfOutOfRange(row);
+  return (m_validityBitmap[row / 64] & (1ULL << (row % 64))) == 0;
+}
+
+int64_t ColumnBuffer::int64At(size_t row) const
+{
+  throwIfOutOfRange(row);
+  switch (m_type)
+  {
+  case Type::Int64:
+    return m_int64Values[row];
+  case Type::Double:
+    return static_cast<int64_t>(m_doubleValues[row]);
+  default:
+    break;
+  }
+  return 0;
+}
+
+double ColumnBuffer::doubleAt(size_t row) const
+{
+  throwIfOutOfRange(row);
+  switch (m_type)
+  {
+  case Type::Int64:
+    return static_cast<double>(m_int64Values[row]);
+  case Type::Double:
+    return m_doubleValues[row];
+  default:
+    break;
+  }
+  return 0.0;
+}
+
+QString ColumnBuffer::textAt(size_t row) const
+{
+  throwIfOutOfRange(row);
+  if (m_type != Type::Text && m_type != Type::Blob)
+  {
+    return {};
+  }
+
+  return QString::fromUtf8(m_data.constData() + m_offsets[row], static_cast<int>(m_offsets[row + 1] - m_offsets[row]));
+}
+
+QByteArray ColumnBuffer::blobAt(size_t row) const
+{
+  throwIfOutOfRange(row);
+  if (m_type != Type::Text && m_type != Type::Blob)
+  {
+    return {};
+  }
+
+  return m_data.mid(static_cast<int>(m_offsets[row]), static_cast<int>(m_offsets[row + 1] - m_offsets[row]));
+}
+
+const std::vector<uint64_t>& ColumnBuffer::validityBitmap() const
+{
+  return m_validityBitmap;
+}
+
+const std::vector<int64_t>& ColumnBuffer::int64Values() const
+{
+  return m_int64Values;
+}
+
+const std::vector<double>& ColumnBuffer::doubleValues() const
+{
+  return m_doubleValues;
+}
+
+const std::vector<int64_t>& ColumnBuffer::offsets() const
+{
+  return m_offsets;
+}
+
+const QByteArray& ColumnBuffer::data() const
+{
+  return m_data;
+}
+
+void ColumnBuffer::append(const QVariant& value)
+{
+  const auto isNull = value.isNull();
+  if (m_type == Type::Null && !isNull)
+  {
+    initializeType(typeOfVariant(value));
+  }
+
+  const auto row = m_size++;
+  if (row % 64 == 0)
+  {
+    m_validityBitmap.emplace_back(0ULL);
+  }
+
+  if (!isNull)
+  {
+    m_validityBitmap.back() |= (1ULL << (row % 64));
+  }
+
+  // values not matching the column type are converted, since SQLite does not enforce column types
+  switch (m_type)
+  {
+  case Type::Int64:
+    m_int64Values.emplace_back(isNull ? 0 : static_cast<int64_t>(value.toLongLong()));
+    break;
+  case Type::Double:
+    m_doubleValues.emplace_back(isNull ? 0.0 : value.toDouble());
+    break;
+  case Type::Text:
+    if (!isNull)
+    {
+      m_data.append(value.toString().toUtf8());
+    }
+    m_offsets.emplace_back(static_cast<int64_t>(m_data.size()));
+    break;
+  case Type::Blob:
+    if (!isNull)
+    {
+      m_data.append(value.toByteArray());
+    }
+    m_offsets.emplace_back(static_cast<int64_t>(m_data.size()));
+    break;
+  case Type::Null:
+    break;
+  }
+}
+
+void ColumnBuffer::initializeType(Type type)
+{
+  // preceding rows are all null
+  m_type = type;
+  switch (m_type)
+  {
+  case Type::Int64:
+    m_int64Values.assign(m_size, 0);
+    break;
+  case Type::Double:
+    m_doubleValues.assign(m_size, 0.0);
+    break;
+  case Type::Text:
+  case Type::Blob:
+    m_offsets.assign(m_size + 1, 0);
+    break;
+  case Type::Null:
+    break;
+  }
+}
+
+void ColumnBuffer::throwIfOutOfRange(size_t row) const
+{
+  if (row >= m_size)
+  {
+    throw DatabaseException(DatabaseException::Type::UnexpectedError,
+      QString("Row %1 out of range.").arg(row));
+  }
+}
+
+ColumnarTable::ColumnarTable(const API::QueryMetaInfo& queryMetaInfo) :
+  m_tableId(queryMetaInfo.tableId),
+  m_relationshipId(queryMetaInfo.relationshipId),
+  m_parentRelationshipId(queryMetaInfo.parentRelationshipId),
+  m_numRows(0)
+{
+  m_columns.reserve(queryMetaInfo.columns.size());
+  for (const auto& column : queryMetaInfo.columns)
+  {
+    m_columns.emplace_back(column.column.canConvert<API::IID::Type>()
+      ? std::make_optional(column.column.value<API::IID::Type>())
+      : std::nullopt, column.alias);
+  }
+}
+
+API::IID::Type ColumnarTable::tableId() const
+{
+  return m_tableId;
+}
+
+std::optional<API::IID::Type> ColumnarTable::relationshipId() const
+{
+  return m_relationshipId;
+}
+
+std::optional<API::IID::Type> ColumnarTable::parentRelationshipId() const
+{
+  return m_parentRelationshipId;
+}
+
+size_t ColumnarTable::numRows() const
+{
+  return m_numRows;
+}
+
+const std::vector<ColumnBuffer>& ColumnarTable::columns() const
+{
+  return m_columns;
+}
+
+const std::vector<size_t>& ColumnarTable::parentRows() const
+{
+  return m_parentRows;
+}
+
+const ColumnBuffer& ColumnarTable::columnIntern(const API::IID& columnId) const
+{
+  for (const auto& column : m_columns)
+  {
+    if (column.columnId() == columnId.get())
+    {
+      return column;
+    }
+  }
+
+  throw DatabaseException(DatabaseException::Type::InvalidId,
+    QString("Column with id %1 not selected.").arg(columnId.get()));
+}
+
+size_t ColumnarTable::append(const TupleView& tuple, const std::optional<size_t>& parentRow)
+{
+  for (size_t i=0; i<m_columns.size(); ++i)
+  {
+    m_columns[i].append(tuple.columnValueAtIndex(i));
+  }
+
+  if (parentRow)
+  {
+    m_parentRows.emplace_back(parentRow.value());
+  }
+  return m_numRows++;
+}
+
+ColumnarResult::ColumnarResult(const API::QueryMetaInfo& queryMetaInfo, const std::vector<API::QueryMetaInfo>& joinMetaInfos) :
+  m_tuples(queryMetaInfo)
+{
+  m_joins.reserve(joinMetaInfos.size());
+  for (const auto& joinMetaInfo : joinMetaInfos)
+  {
+    m_joins.emplace_back(joinMetaInfo);
+  }
+}
+
+const ColumnarTable& ColumnarResult::tuples() const
+{
+  return m_tuples;
+}
+
+const std::vector<ColumnarTable>& ColumnarResult::joins() const
+{
+  return m_joins;
+}
+
+const ColumnarTable& ColumnarResult::joinedTuplesIntern(const API::IID& relationshipId) const
+{
+  for (const auto& join : m_joins)
+  {
+    if (join.relationshipId() == relationshipId.get())
+    {
+      return join;
+    }
+  }
+
+  throw DatabaseException(DatabaseException::Type::InvalidId,
+    QString("Relationship with id %1 not joined.").arg(relationshipId.get()));
+}
+
+size_t ColumnarResult::appendTuple(const TupleView& tuple)
+{
+  return m_tuples.append(tuple, std::nullopt);
+}
+
+size_t ColumnarResult::appendJoinedTuple(size_t joinIndex, const TupleView& tuple, size_t parentRow)
+{
+  return m_joins.at(joinIndex).append(tuple, parentRow);
+}
+
+}
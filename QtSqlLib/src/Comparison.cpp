@@ -23,7 +23,7 @@ QString Comparison::toQueryString(
   const API::IQueryIdentifiers& queryIdentifiers,
   std::vector<QVariant>& boundValuesOut) const
 {
-  const auto getOperandString = [&schema, &queryIdentifiers, &boundValuesOut](const QVariant& operand) -> QString
+  const auto getOperandString = [this, &schema, &queryIdentifiers, &boundValuesOut](const QVariant& operand) -> QString
   {
     if (operand.canConvert<ColumnHelper::ColumnData>())
     {
@@ -38,6 +38,21 @@ QString Comparison::toQueryString(
     {
       return "NULL";
     }
+    if (m_operator == EComparisonOperator::In && operand.userType() == QMetaType::QVariantList)
+    {
+      // lists are expanded to one placeholder per value
+      QString listStr = "";
+      for (const auto& value : operand.toList())
+      {
+        if (!listStr.isEmpty())
+        {
+          listStr.append(", ");
+        }
+        listStr.append("?");
+        boundValuesOut.emplace_back(value);
+      }
+      return QString("(%1)").arg(listStr);
+    }
 
     boundValuesOut.emplace_back(operand);
     return "?";
@@ -85,6 +100,17 @@ QString Comparison::toQueryString(
     .arg(m_noCase ? " COLLATE NOCASE" : "");
 }
 
+bool Comparison::hasRelationshipColumns() const
+{
+  const auto isRelationshipColumn = [](const QVariant& operand)
+  {
+    return operand.canConvert<ColumnHelper::ColumnData>() &&
+      operand.value<ColumnHelper::ColumnData>().relationshipId.has_value();
+  };
+
+  return isRelationshipColumn(m_lhs) || isRelationshipColumn(m_rhs);
+}
+
 void Comparison::setNoCase(bool noCase)
 {
   m_noCase = noCase;
@@ -20,6 +20,8 @@ public:
     const API::IQueryIdentifiers& queryIdentifiers,
     std::vector<QVariant>& boundValuesOut) const override;
 
+  bool hasRelationshipColumns() const override;
+
   void setNoCase(bool noCase);
 
 private:
@@ -0,0 +1,122 @@
+#include "QtSqlLib/Query/CompiledQuery.h"
+
+#include "QtSqlLib/ColumnHelper.h"
+#include "QtSqlLib/DatabaseException.h"
+#include "QtSqlLib/StatementCache.h"
+
+#include <algorithm>
+
+namespace QtSqlLib::Query
+{
+
+CompiledQuery::CompiledQuery(
+  const QString& queryString,
+  const std::vector<QVariant>& boundValues,
+  API::QueryMetaInfo&& queryMetaInfo,
+  std::vector<API::QueryMetaInfo>&& joins,
+  bool isForwardOnly) :
+  Query(),
+  m_queryString(queryString),
+  m_queryMetaInfo(std::move(queryMetaInfo)),
+  m_joins(std::move(joins)),
+  m_isForwardOnly(isForwardOnly)
+{
+  m_boundValues.reserve(boundValues.size());
+  for (const auto& value : boundValues)
+  {
+    BoundValue boundValue;
+    if (value.canConvert<ColumnHelper::Parameter>())
+    {
+      boundValue.parameterName = value.value<ColumnHelper::Parameter>().name;
+      boundValue.isParameter = true;
+    }
+    else
+    {
+      boundValue.value = value;
+    }
+    m_boundValues.emplace_back(boundValue);
+  }
+}
+
+CompiledQuery::~CompiledQuery() = default;
+
+CompiledQuery& CompiledQuery::bind(const QString& parameterName, const QVariant& value)
+{
+  const auto isParameterExisting = std::any_of(m_boundValues.cbegin(), m_boundValues.cend(),
+    [&parameterName](const BoundValue& boundValue)
+    {
+      return boundValue.isParameter && boundValue.parameterName == parameterName;
+    });
+
+  if (!isParameterExisting)
+  {
+    throw DatabaseException(DatabaseException::Type::InvalidSyntax,
+      QString("Unknown query parameter '%1'.").arg(parameterName));
+  }
+
+  m_parameterValues[parameterName] = value;
+  return *this;
+}
+
+void CompiledQuery::clearBindings()
+{
+  m_parameterValues.clear();
+}
+
+const QString& CompiledQuery::getQueryString() const
+{
+  return m_queryString;
+}
+
+std::vector<QString> CompiledQuery::getParameterNames() const
+{
+  std::vector<QString> names;
+  for (const auto& boundValue : m_boundValues)
+  {
+    if (boundValue.isParameter && std::find(names.cbegin(), names.cend(), boundValue.parameterName) == names.cend())
+    {
+      names.emplace_back(boundValue.parameterName);
+    }
+  }
+  return names;
+}
+
+API::IQuery::SqlQuery CompiledQuery::getSqlQuery(const QSqlDatabase& db, API::ISchema& /*schema*/,
+                                                 ResultSet& /*previousQueryResults*/)
+{
+  std::vector<QVariant> values;
+  values.reserve(m_boundValues.size());
+
+  for (const auto& boundValue : m_boundValues)
+  {
+    if (!boundValue.isParameter)
+    {
+      values.emplace_back(boundValue.value);
+      continue;
+    }
+
+    const auto it = m_parameterValues.find(boundValue.parameterName);
+    if (it == m_parameterValues.end())
+    {
+      throw DatabaseException(DatabaseException::Type::InvalidSyntax,
+        QString("No value bound for query parameter '%1'.").arg(boundValue.parameterName));
+    }
+    values.emplace_back(it->second);
+  }
+
+  auto query = StatementCache::prepare(db, m_queryString);
+  query.setForwardOnly(m_isForwardOnly);
+  for (const auto& value : values)
+  {
+    query.addBindValue(value);
+  }
+
+  return { std::move(query) };
+}
+
+ResultSet CompiledQuery::getQueryResults(API::ISchema& /*schema*/, QSqlQuery&& query)
+{
+  return ResultSet(std::move(query), API::QueryMetaInfo(m_queryMetaInfo), std::vector<API::QueryMetaInfo>(m_joins), m_isForwardOnly);
+}
+
+}
@@ -0,0 +1,155 @@
+#include "QtSqlLib/Query/ConflictClause.h"
+
+#include "QtSqlLib/API/ISanityChecker.h"
+#include "QtSqlLib/API/ISchema.h"
+#include "QtSqlLib/DatabaseException.h"
+#include "QtSqlLib/Expr.h"
+#include "QtSqlLib/QueryIdentifiers.h"
+
+namespace QtSqlLib::Query
+{
+
+ConflictClause::ConflictClause() :
+  m_target(Target::PrimaryKey),
+  m_bIsDoNothing(false)
+{
+}
+
+ConflictClause::ConflictClause(ConflictClause&& other) noexcept = default;
+
+ConflictClause::~ConflictClause() = default;
+
+void ConflictClause::setTarget(Target target)
+{
+  m_target = target;
+}
+
+void ConflictClause::setColumnAction(API::IID::Type columnId, Action action)
+{
+  addColumnAction(columnId, { action, nullptr });
+}
+
+void ConflictClause::setColumnOverwriteCondition(API::IID::Type columnId, Expr& condition)
+{
+  addColumnAction(columnId, { Action::OverwriteIf, std::make_unique<Expr>(std::move(condition)) });
+}
+
+void ConflictClause::setDoNothing()
+{
+  if (!m_columnActions.empty())
+  {
+    throw DatabaseException(DatabaseException::Type::InvalidSyntax,
+      "doNothing() cannot be combined with column conflict actions.");
+  }
+
+  m_bIsDoNothing = true;
+}
+
+QString ConflictClause::toQueryString(
+  API::ISchema& schema, API::IID::Type tableId,
+  const ColumnHelper::ColumnList& insertedColumns,
+  std::vector<QVariant>& boundValuesOut) const
+{
+  const auto& table = schema.getTables().at(tableId);
+  const auto& targetColumns = getTargetColumns(table);
+
+  // the conflict target has to name the columns as identifiers to match the constraint
+  QString targetString;
+  for (const auto& columnId : targetColumns)
+  {
+    targetString += QString("\"%1\", ").arg(table.columns.at(columnId).name);
+  }
+  targetString = targetString.left(targetString.length() - 2);
+
+  for (const auto& columnAction : m_columnActions)
+  {
+    schema.getSanityChecker().throwIfColumnIdNotExisting(table, columnAction.first);
+
+    if ((columnAction.second.action != Action::Keep) && !ColumnHelper::contains(insertedColumns, columnAction.first))
+    {
+      throw DatabaseException(DatabaseException::Type::InvalidId,
+        QString("Column with id %1 cannot be overwritten, because no value is inserted.").arg(columnAction.first));
+    }
+  }
+
+  QString setString;
+  if (!m_bIsDoNothing)
+  {
+    // the primary key of an existing tuple is only overwritten explicitly
+    for (const auto& columnId : insertedColumns)
+    {
+      if (ColumnHelper::contains(targetColumns, columnId) || ColumnHelper::contains(table.primaryKeys, columnId) ||
+        (m_columnActions.count(columnId) > 0))
+      {
+        continue;
+      }
+      setString += QString("'%1' = excluded.'%1', ").arg(table.columns.at(columnId).name);
+    }
+
+    QueryIdentifiers identifiers;
+    identifiers.addTableIdentifier(std::nullopt, tableId);
+    identifiers.addTableIdentifier(excludedRelationshipId, tableId, "excluded");
+
+    for (const auto& columnAction : m_columnActions)
+    {
+      const auto& columnName = table.columns.at(columnAction.first).name;
+      if (columnAction.second.action == Action::Overwrite)
+      {
+        setString += QString("'%1' = excluded.'%1', ").arg(columnName);
+      }
+      else if (columnAction.second.action == Action::OverwriteIf)
+      {
+        setString += QString("'%1' = CASE WHEN %2 THEN excluded.'%1' ELSE '%3'.'%1' END, ")
+          .arg(columnName)
+          .arg(columnAction.second.condition->toQueryString(schema, identifiers, boundValuesOut))
+          .arg(table.name);
+      }
+    }
+  }
+
+  if (setString.isEmpty())
+  {
+    return QString(" ON CONFLICT(%1) DO NOTHING").arg(targetString);
+  }
+
+  return QString(" ON CONFLICT(%1) DO UPDATE SET %2").arg(targetString).arg(setString.left(setString.length() - 2));
+}
+
+void ConflictClause::addColumnAction(API::IID::Type columnId, ColumnAction&& columnAction)
+{
+  if (m_bIsDoNothing)
+  {
+    throw DatabaseException(DatabaseException::Type::InvalidSyntax,
+      "Column conflict actions cannot be combined with doNothing().");
+  }
+
+  if (m_columnActions.count(columnId) > 0)
+  {
+    throw DatabaseException(DatabaseException::Type::InvalidSyntax,
+      QString("More than one conflict action for column with id %1 specified.").arg(columnId));
+  }
+
+  m_columnActions[columnId] = std::move(columnAction);
+}
+
+const ColumnHelper::ColumnList& ConflictClause::getTargetColumns(const API::Table& table) const
+{
+  if (m_target == Target::PrimaryKey)
+  {
+    if (table.primaryKeys.empty())
+    {
+      throw DatabaseException(DatabaseException::Type::InvalidSyntax,
+        QString("Table '%1' has no primary key to detect conflicts.").arg(table.name));
+    }
+    return table.primaryKeys;
+  }
+
+  if (table.uniqueColIds.empty())
+  {
+    throw DatabaseException(DatabaseException::Type::InvalidSyntax,
+      QString("Table '%1' has no unique columns to detect conflicts.").arg(table.name));
+  }
+  return table.uniqueColIds;
+}
+
+}
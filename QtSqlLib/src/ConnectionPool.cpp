@@ -0,0 +1,217 @@
+#include "ConnectionPool.h"
+
+#include "QtSqlLib/DatabaseException.h"
+#include "QtSqlLib/StatementCache.h"
+#include "QtSqlLib/Transaction.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <vector>
+
+namespace QtSqlLib
+{
+
+class ThreadExitReleaser
+{
+public:
+  ThreadExitReleaser() = default;
+
+  ~ThreadExitReleaser()
+  {
+    for (const auto& pool : m_pools)
+    {
+      if (const auto lockedPool = pool.lock())
+      {
+        lockedPool->releaseThreadConnection();
+      }
+    }
+  }
+
+  void addPool(const std::weak_ptr<ConnectionPool>& pool)
+  {
+    m_pools.erase(std::remove_if(m_pools.begin(), m_pools.end(),
+      [](const std::weak_ptr<ConnectionPool>& registeredPool) { return registeredPool.expired(); }), m_pools.end());
+
+    const auto isRegistered = std::any_of(m_pools.cbegin(), m_pools.cend(),
+      [&pool](const std::weak_ptr<ConnectionPool>& registeredPool)
+      {
+        return !registeredPool.owner_before(pool) && !pool.owner_before(registeredPool);
+      });
+
+    if (!isRegistered)
+    {
+      m_pools.emplace_back(pool);
+    }
+  }
+
+private:
+  std::vector<std::weak_ptr<ConnectionPool>> m_pools;
+
+};
+
+static thread_local ThreadExitReleaser s_threadExitReleaser;
+
+static std::atomic<int> s_nextPoolIndex(0);
+
+ConnectionPool::ConnectionPool(const QString& databaseName, const QString& fileName, int maxConnections,
+                               int acquireTimeoutMs, ConnectionInitializer initializer,
+                               ConnectionInitializer configurator) :
+  m_databaseName(databaseName),
+  m_fileName(fileName),
+  m_maxConnections(maxConnections),
+  m_acquireTimeoutMs(acquireTimeoutMs),
+  m_initializer(std::move(initializer)),
+  m_configurator(std::move(configurator)),
+  m_poolIndex(s_nextPoolIndex++),
+  m_nextConnectionIndex(0),
+  m_configurationGeneration(0),
+  m_bIsClosed(false)
+{
+}
+
+ConnectionPool::~ConnectionPool()
+{
+  releaseThreadConnection();
+
+  // connections of other threads can neither be closed nor destroyed on this thread, so they are left open until
+  // the process exits. Their names are unique, so they do not collide with connections of later pools.
+  for (auto& connection : m_connections)
+  {
+    static_cast<void>(connection.second.db.release());
+  }
+}
+
+int ConnectionPool::getMaxConnections() const
+{
+  return m_maxConnections;
+}
+
+int ConnectionPool::getNumConnections() const
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return static_cast<int>(m_connections.size());
+}
+
+QSqlDatabase& ConnectionPool::getThreadConnection()
+{
+  const auto threadId = std::this_thread::get_id();
+
+  std::unique_lock<std::mutex> lock(m_mutex);
+  if (m_bIsClosed)
+  {
+    throw DatabaseException(DatabaseException::Type::UnexpectedError, "Connection pool is closed.");
+  }
+
+  const auto it = m_connections.find(threadId);
+  if (it != m_connections.end())
+  {
+    auto& connection = it->second;
+    if (connection.configurationGeneration != m_configurationGeneration && Transaction::getDepth(*connection.db) == 0)
+    {
+      m_configurator(*connection.db);
+      connection.configurationGeneration = m_configurationGeneration;
+    }
+    return *connection.db;
+  }
+
+  const auto bIsSlotAvailable = m_connectionReleased.wait_for(lock, std::chrono::milliseconds(m_acquireTimeoutMs),
+    [this]() { return m_bIsClosed || static_cast<int>(m_connections.size()) < m_maxConnections; });
+
+  if (m_bIsClosed)
+  {
+    throw DatabaseException(DatabaseException::Type::UnexpectedError, "Connection pool is closed.");
+  }
+
+  if (!bIsSlotAvailable)
+  {
+    throw DatabaseException(DatabaseException::Type::UnexpectedError,
+      QString("Timed out waiting for a free connection (pool size: %1).").arg(m_maxConnections));
+  }
+
+  Connection connection;
+  connection.connectionName = QString("%1_pool%2_%3").arg(m_databaseName).arg(m_poolIndex).arg(m_nextConnectionIndex++);
+  connection.db = std::make_unique<QSqlDatabase>(QSqlDatabase::addDatabase("QSQLITE", connection.connectionName));
+  connection.db->setDatabaseName(m_fileName);
+
+  if (!connection.db->open())
+  {
+    removeConnection(connection);
+    throw DatabaseException(DatabaseException::Type::UnableToLoad,
+      QString("Could not open pooled connection to database file: %1.").arg(m_fileName));
+  }
+
+  try
+  {
+    m_initializer(*connection.db);
+    m_configurator(*connection.db);
+  }
+  catch (const DatabaseException&)
+  {
+    removeConnection(connection);
+    throw;
+  }
+  connection.configurationGeneration = m_configurationGeneration;
+
+  s_threadExitReleaser.addPool(weak_from_this());
+
+  return *m_connections.emplace(threadId, std::move(connection)).first->second.db;
+}
+
+void ConnectionPool::releaseThreadConnection()
+{
+  std::unique_lock<std::mutex> lock(m_mutex);
+  const auto it = m_connections.find(std::this_thread::get_id());
+  if (it == m_connections.end())
+  {
+    return;
+  }
+
+  auto connection = std::move(it->second);
+  m_connections.erase(it);
+  removeConnection(connection);
+
+  lock.unlock();
+  m_connectionReleased.notify_all();
+}
+
+void ConnectionPool::invalidateConfiguration()
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_configurationGeneration++;
+}
+
+void ConnectionPool::closeAll()
+{
+  releaseThreadConnection();
+
+  std::unique_lock<std::mutex> lock(m_mutex);
+  m_bIsClosed = true;
+  m_connectionReleased.notify_all();
+
+  // connections may only be closed by the threads that opened them, so the other threads must release their
+  // connections or exit before the pool is closed
+  const auto bIsReleased = m_connectionReleased.wait_for(lock, std::chrono::milliseconds(m_acquireTimeoutMs),
+    [this]() { return m_connections.empty(); });
+
+  if (!bIsReleased)
+  {
+    throw DatabaseException(DatabaseException::Type::UnexpectedError,
+      QString("Timed out waiting for other threads to release %1 pooled connections.").arg(m_connections.size()));
+  }
+}
+
+void ConnectionPool::removeConnection(Connection& connection)
+{
+  StatementCache::unregisterConnection(*connection.db);
+
+  if (connection.db->isOpen())
+  {
+    connection.db->close();
+  }
+  connection.db.reset();
+
+  QSqlDatabase::removeDatabase(connection.connectionName);
+}
+
+}
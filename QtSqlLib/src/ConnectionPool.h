@@ -0,0 +1,63 @@
+#pragma once
+
+#include <QSqlDatabase>
+#include <QString>
+
+#include <condition_variable>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace QtSqlLib
+{
+
+class ConnectionPool : public std::enable_shared_from_this<ConnectionPool>
+{
+public:
+  using ConnectionInitializer = std::function<void(QSqlDatabase&)>;
+
+  ConnectionPool(const QString& databaseName, const QString& fileName, int maxConnections,
+                 int acquireTimeoutMs, ConnectionInitializer initializer, ConnectionInitializer configurator);
+  ~ConnectionPool();
+
+  int getMaxConnections() const;
+  int getNumConnections() const;
+
+  QSqlDatabase& getThreadConnection();
+  void releaseThreadConnection();
+
+  void invalidateConfiguration();
+
+  // closes the connection of the calling thread and waits for the other threads to release their connections
+  void closeAll();
+
+private:
+  struct Connection
+  {
+    QString connectionName;
+    std::unique_ptr<QSqlDatabase> db;
+    int configurationGeneration = 0;
+  };
+
+  QString m_databaseName;
+  QString m_fileName;
+  int m_maxConnections;
+  int m_acquireTimeoutMs;
+  ConnectionInitializer m_initializer;
+  ConnectionInitializer m_configurator;
+  int m_poolIndex;
+
+  mutable std::mutex m_mutex;
+  std::condition_variable m_connectionReleased;
+  std::map<std::thread::id, Connection> m_connections;
+  int m_nextConnectionIndex;
+  int m_configurationGeneration;
+  bool m_bIsClosed;
+
+  static void removeConnection(Connection& connection);
+
+};
+
+}
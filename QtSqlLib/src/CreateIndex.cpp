@@ -13,7 +13,7 @@ CreateIndex::CreateIndex(const API::Index& index) :
 CreateIndex::~CreateIndex() = default;
 
 API::IQuery::SqlQuery CreateIndex::getSqlQuery(
-  const QSqlDatabase& /*db*/, API::ISchema& schema,
+  const QSqlDatabase& db, API::ISchema& schema,
   ResultSet& /*previousQueryResults*/)
 {
   const auto& table = schema.getTables().at(m_index.tableId);
@@ -37,7 +37,7 @@ API::IQuery::SqlQuery CreateIndex::getSqlQuery(
     .arg(table.name)
     .arg(columns);
 
-  QSqlQuery query;
+  QSqlQuery query(db);
   query.prepare(QString("CREATE %1INDEX '%2' ON '%3'(%4);")
     .arg(m_index.isUnique ? "UNIQUE " : "")
     .arg(m_index.name)
@@ -55,7 +55,7 @@ CreateTable::CreateTable(const API::Table& table) :
 CreateTable::~CreateTable() = default;
 
 API::IQuery::SqlQuery CreateTable::getSqlQuery(
-  const QSqlDatabase& /*db*/, API::ISchema& schema,
+  const QSqlDatabase& db, API::ISchema& schema,
   ResultSet& /*previousQueryResults*/)
 {
   const auto cutTailingComma = [](QString& str)
@@ -156,7 +156,7 @@ API::IQuery::SqlQuery CreateTable::getSqlQuery(
   }
   columns = columns.simplified();
 
-  QSqlQuery query;
+  QSqlQuery query(db);
   query.prepare(QString("CREATE TABLE '%1' (%2);").arg(m_table.name).arg(columns));
 
   return { std::move(query) };
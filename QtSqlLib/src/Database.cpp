@@ -12,13 +12,22 @@
 #include "QtSqlLib/QueryExecuteVisitor.h"
 #include "QtSqlLib/QueryPrepareVisitor.h"
 #include "QtSqlLib/Schema.h"
+#include "QtSqlLib/StatementCache.h"
 
+#include "ConnectionPool.h"
 #include "CreateIndex.h"
 #include "CreateTable.h"
+#include "QueryExecutor.h"
+#include "QueryPlanDiagnostics.h"
+#include "ReturningClause.h"
 #include "SanityChecker.h"
 
+#include <QSqlError>
 #include <QVariant>
 
+#include <algorithm>
+#include <exception>
+#include <limits>
 #include <set>
 
 namespace QtSqlLib
@@ -34,6 +43,9 @@ static const API::IID::Type s_versionColId = 0;
 static const API::IID::Type s_versionTableid = std::numeric_limits<API::IID::Type>::max();
 static const QString s_versionTableName = "database_version";
 
+static const int s_defaultConnectionPoolAcquireTimeoutMs = 30000;
+static const int s_defaultStatementCacheCapacity = 64;
+
 static void verifyPrimaryKeys(const API::Table& table)
 {
   for (const auto& columnId : table.primaryKeys)
@@ -56,15 +68,172 @@ static void verifyPrimaryKeys(const API::Table& table)
   }
 }
 
-Database::Database() = default;
+static void execPragma(QSqlDatabase& db, const QString& pragma)
+{
+  QSqlQuery query(db);
+  if (!query.exec(QString("PRAGMA %1;").arg(pragma)))
+  {
+    throw DatabaseException(DatabaseException::Type::QueryError,
+      QString("Could not execute 'PRAGMA %1': %2").arg(pragma).arg(query.lastError().text()));
+  }
+}
+
+static QString journalModeString(DatabaseOptions::JournalMode journalMode)
+{
+  switch (journalMode)
+  {
+  case DatabaseOptions::JournalMode::Delete:
+    return "DELETE";
+  case DatabaseOptions::JournalMode::Truncate:
+    return "TRUNCATE";
+  case DatabaseOptions::JournalMode::Persist:
+    return "PERSIST";
+  case DatabaseOptions::JournalMode::Memory:
+    return "MEMORY";
+  case DatabaseOptions::JournalMode::Wal:
+    return "WAL";
+  case DatabaseOptions::JournalMode::Off:
+    return "OFF";
+  default:
+    assert(false);
+    break;
+  }
+  return "";
+}
+
+static QString synchronousString(DatabaseOptions::Synchronous synchronous)
+{
+  switch (synchronous)
+  {
+  case DatabaseOptions::Synchronous::Off:
+    return "OFF";
+  case DatabaseOptions::Synchronous::Normal:
+    return "NORMAL";
+  case DatabaseOptions::Synchronous::Full:
+    return "FULL";
+  case DatabaseOptions::Synchronous::Extra:
+    return "EXTRA";
+  default:
+    assert(false);
+    break;
+  }
+  return "";
+}
+
+static QString tempStoreString(DatabaseOptions::TempStore tempStore)
+{
+  switch (tempStore)
+  {
+  case DatabaseOptions::TempStore::Default:
+    return "DEFAULT";
+  case DatabaseOptions::TempStore::File:
+    return "FILE";
+  case DatabaseOptions::TempStore::Memory:
+    return "MEMORY";
+  default:
+    assert(false);
+    break;
+  }
+  return "";
+}
+
+static QString autoVacuumString(DatabaseOptions::AutoVacuum autoVacuum)
+{
+  switch (autoVacuum)
+  {
+  case DatabaseOptions::AutoVacuum::None:
+    return "NONE";
+  case DatabaseOptions::AutoVacuum::Full:
+    return "FULL";
+  case DatabaseOptions::AutoVacuum::Incremental:
+    return "INCREMENTAL";
+  default:
+    assert(false);
+    break;
+  }
+  return "";
+}
+
+static void applyCreationOptions(QSqlDatabase& db, const DatabaseOptions& options)
+{
+  if (options.pageSize.has_value())
+  {
+    execPragma(db, QString("page_size = %1").arg(options.pageSize.value()));
+  }
+  if (options.autoVacuum.has_value())
+  {
+    execPragma(db, QString("auto_vacuum = %1").arg(autoVacuumString(options.autoVacuum.value())));
+  }
+}
+
+static void applyRuntimeOptions(QSqlDatabase& db, const DatabaseOptions& options)
+{
+  if (options.busyTimeoutMs.has_value())
+  {
+    execPragma(db, QString("busy_timeout = %1").arg(options.busyTimeoutMs.value()));
+  }
+  if (options.journalMode.has_value())
+  {
+    execPragma(db, QString("journal_mode = %1").arg(journalModeString(options.journalMode.value())));
+  }
+  if (options.synchronous.has_value())
+  {
+    execPragma(db, QString("synchronous = %1").arg(synchronousString(options.synchronous.value())));
+  }
+  if (options.cacheSize.has_value())
+  {
+    execPragma(db, QString("cache_size = %1").arg(options.cacheSize.value()));
+  }
+  if (options.mmapSize.has_value())
+  {
+    execPragma(db, QString("mmap_size = %1").arg(options.mmapSize.value()));
+  }
+  if (options.tempStore.has_value())
+  {
+    execPragma(db, QString("temp_store = %1").arg(tempStoreString(options.tempStore.value())));
+  }
+}
+
+static void initializeConnection(QSqlDatabase& db, const QString& databaseName, int statementCacheCapacity)
+{
+  QSqlQuery("PRAGMA foreign_keys = ON;", db).exec();
+
+  StatementCache::registerConnection(db, databaseName, statementCacheCapacity);
+}
+
+Database::Database() :
+  m_connectionPoolSize(0),
+  m_connectionPoolAcquireTimeoutMs(s_defaultConnectionPoolAcquireTimeoutMs),
+  m_numAsyncExecutorThreads(1),
+  m_statementCacheCapacity(s_defaultStatementCacheCapacity),
+  m_optionsGeneration(0),
+  m_dbOptionsGeneration(0),
+  m_queryPlanDiagnostics(std::make_unique<QueryPlanDiagnostics>())
+{
+  m_profiles[DatabaseOptions::bulkLoadProfileName] = DatabaseOptions::bulkLoadProfile();
+  m_profiles[DatabaseOptions::oltpProfileName] = DatabaseOptions::oltpProfile();
+}
 
 Database::~Database()
 {
-  Database::close();
+  try
+  {
+    Database::close();
+  }
+  catch (const DatabaseException&)
+  {
+    // pooled connections still held by other threads are left open
+  }
 }
 
 void Database::initialize(API::ISchemaConfigurator& schemaConfigurator, const QString& fileName,
                           const QString& databaseName)
+{
+  initialize(schemaConfigurator, fileName, DatabaseOptions(), databaseName);
+}
+
+void Database::initialize(API::ISchemaConfigurator& schemaConfigurator, const QString& fileName,
+                          const DatabaseOptions& options, const QString& databaseName)
 {
   if (m_db)
   {
@@ -72,6 +241,14 @@ void Database::initialize(API::ISchemaConfigurator& schemaConfigurator, const QS
   }
 
   m_databaseName = databaseName;
+  m_fileName = fileName;
+  m_ownerThreadId = std::this_thread::get_id();
+
+  {
+    std::lock_guard<std::mutex> lock(m_optionsMutex);
+    m_options.merge(options);
+    m_dbOptionsGeneration = m_optionsGeneration;
+  }
 
   schemaConfigurator.configureTable(ID(s_versionTableid), s_versionTableName)
     .column(ID(s_versionColId), "version", API::DataType::Integer).primaryKey().notNull();
@@ -81,22 +258,94 @@ void Database::initialize(API::ISchemaConfigurator& schemaConfigurator, const QS
   m_schema->validateAndPrepareIndices();
 
   loadDatabaseFile(fileName);
+
+  if (m_connectionPoolSize > 0)
+  {
+    createConnectionPool();
+  }
 }
 
 void Database::close()
 {
+  stopQueryExecutor();
+
+  // the connection of this thread is closed, even if other threads still hold pooled connections
+  std::exception_ptr connectionPoolException;
+  try
+  {
+    closeConnectionPool();
+  }
+  catch (const DatabaseException&)
+  {
+    connectionPoolException = std::current_exception();
+  }
+
+  m_queryPlanDiagnostics->clear();
+
   if (m_db && m_db->isOpen())
   {
+    StatementCache::unregisterConnection(*m_db);
+
     m_db->close();
     m_db.reset();
 
     QSqlDatabase::removeDatabase(m_databaseName);
   }
+
+  if (connectionPoolException)
+  {
+    std::rethrow_exception(connectionPoolException);
+  }
 }
 
 ResultSet Database::execQuery(API::IQueryElement& query)
 {
-  return execQueryForSchema(*m_schema, query);
+  return execQueryForSchema(getThreadConnection(), *m_schema, query);
+}
+
+std::future<RowBlock> Database::execQueryAsync(std::unique_ptr<API::IQueryElement> query)
+{
+  std::shared_ptr<ConnectionPool> connectionPool;
+  auto& executor = getQueryExecutor(connectionPool);
+
+  auto promise = std::make_shared<std::promise<RowBlock>>();
+  auto sharedQuery = std::shared_ptr<API::IQueryElement>(std::move(query));
+
+  executor.enqueue([this, promise, sharedQuery, connectionPool]()
+  {
+    try
+    {
+      // the rows are copied and the statement is released by the executor thread owning the connection
+      RowBlock block;
+      {
+        auto results = execQueryForSchema(connectionPool->getThreadConnection(), *m_schema, *sharedQuery);
+        results.nextBlock(block, std::numeric_limits<size_t>::max());
+      }
+
+      promise->set_value(std::move(block));
+    }
+    catch (...)
+    {
+      promise->set_exception(std::current_exception());
+    }
+  });
+
+  return promise->get_future();
+}
+
+Transaction Database::beginTransaction()
+{
+  return Transaction(getThreadConnection());
+}
+
+Query::CompiledQuery Database::compile(Query::FromTable& query) const
+{
+  if (!m_schema)
+  {
+    throw DatabaseException(DatabaseException::Type::UnexpectedError, "Database is not yet initialized.");
+  }
+
+  return query.compile(*m_schema);
 }
 
 ResultSetPrinter Database::createResultSetPrinter(ResultSet& resultSet, int maxColumnWidth) const
@@ -104,6 +353,38 @@ ResultSetPrinter Database::createResultSetPrinter(ResultSet& resultSet, int maxC
   return ResultSetPrinter(*m_schema, resultSet, maxColumnWidth);
 }
 
+void Database::setConnectionPoolSize(int maxConnections, int acquireTimeoutMs)
+{
+  if (maxConnections < 0)
+  {
+    throw DatabaseException(DatabaseException::Type::UnexpectedError,
+      QString("Invalid connection pool size: %1.").arg(maxConnections));
+  }
+
+  closeConnectionPool();
+
+  m_connectionPoolSize = maxConnections;
+  m_connectionPoolAcquireTimeoutMs = acquireTimeoutMs;
+
+  if (m_db && m_connectionPoolSize > 0)
+  {
+    createConnectionPool();
+  }
+}
+
+int Database::getConnectionPoolSize() const
+{
+  return m_connectionPoolSize;
+}
+
+void Database::releaseThreadConnection()
+{
+  if (const auto connectionPool = getConnectionPool())
+  {
+    connectionPool->releaseThreadConnection();
+  }
+}
+
 void Database::loadDatabaseFile(const QString& filename)
 {
   m_db = std::make_unique<QSqlDatabase>(QSqlDatabase::addDatabase("QSQLITE", m_databaseName));
@@ -115,9 +396,18 @@ void Database::loadDatabaseFile(const QString& filename)
       QString("Could not load database file: %1.").arg(filename));
   }
 
-  QSqlQuery("PRAGMA foreign_keys = ON;", *m_db).exec();
+  initializeConnection(*m_db, m_databaseName, m_statementCacheCapacity);
+
+  const auto options = getOptions();
+  const auto isNewDatabase = !isVersionTableExisting();
+  if (isNewDatabase)
+  {
+    applyCreationOptions(*m_db, options);
+  }
+
+  applyRuntimeOptions(*m_db, options);
 
-  if (!isVersionTableExisting())
+  if (isNewDatabase)
   {
     createOrMigrateTables(0);
   }
@@ -181,33 +471,281 @@ void Database::createOrMigrateTables(int currentVersion)
       execQuery(sequence);
     }
   }
+
+  StatementCache::invalidateAll();
 }
 
-ResultSet Database::execQueryForSchema(API::ISchema& schema, API::IQueryElement& query) const
+void Database::setNumAsyncExecutorThreads(int numThreads)
+{
+  if (numThreads <= 0)
+  {
+    throw DatabaseException(DatabaseException::Type::UnexpectedError,
+      QString("Invalid number of executor threads: %1.").arg(numThreads));
+  }
+
+  stopQueryExecutor();
+  m_numAsyncExecutorThreads = numThreads;
+}
+
+int Database::getNumAsyncExecutorThreads() const
+{
+  return m_numAsyncExecutorThreads;
+}
+
+void Database::setStatementCacheCapacity(int capacity)
+{
+  m_statementCacheCapacity = capacity;
+
+  if (m_db)
+  {
+    StatementCache::setCapacity(m_databaseName, capacity);
+  }
+}
+
+StatementCache::Statistics Database::getStatementCacheStatistics() const
+{
+  return StatementCache::getStatistics(m_databaseName);
+}
+
+bool Database::isReturningSupported() const
+{
+  return Query::ReturningClause::isSupported(getThreadConnection());
+}
+
+void Database::applyOptions(const DatabaseOptions& options)
+{
+  {
+    std::lock_guard<std::mutex> lock(m_optionsMutex);
+    m_options.merge(options);
+    m_optionsGeneration++;
+  }
+
+  if (const auto connectionPool = getConnectionPool())
+  {
+    connectionPool->invalidateConfiguration();
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(m_queryExecutorMutex);
+    if (m_queryExecutorConnectionPool)
+    {
+      m_queryExecutorConnectionPool->invalidateConfiguration();
+    }
+  }
+
+  if (m_db)
+  {
+    static_cast<void>(getThreadConnection());
+  }
+}
+
+DatabaseOptions Database::getOptions() const
+{
+  std::lock_guard<std::mutex> lock(m_optionsMutex);
+  return m_options;
+}
+
+void Database::registerProfile(const QString& name, const DatabaseOptions& options)
+{
+  std::lock_guard<std::mutex> lock(m_optionsMutex);
+  m_profiles[name] = options;
+}
+
+void Database::applyProfile(const QString& name)
+{
+  DatabaseOptions options;
+  {
+    std::lock_guard<std::mutex> lock(m_optionsMutex);
+    const auto it = m_profiles.find(name);
+    if (it == m_profiles.end())
+    {
+      throw DatabaseException(DatabaseException::Type::InvalidId,
+        QString("Unknown database profile '%1'.").arg(name));
+    }
+    options = it->second;
+  }
+
+  applyOptions(options);
+}
+
+void Database::registerQueryObserver(const std::shared_ptr<API::IQueryObserver>& observer)
+{
+  std::lock_guard<std::mutex> lock(m_queryObserversMutex);
+
+  auto observers = m_queryObservers ? std::make_shared<API::QueryObservers>(*m_queryObservers)
+                                    : std::make_shared<API::QueryObservers>();
+  if (std::find(observers->cbegin(), observers->cend(), observer) != observers->cend())
+  {
+    return;
+  }
+
+  observers->emplace_back(observer);
+  m_queryObservers = std::move(observers);
+}
+
+void Database::unregisterQueryObserver(const std::shared_ptr<API::IQueryObserver>& observer)
+{
+  std::lock_guard<std::mutex> lock(m_queryObserversMutex);
+  if (!m_queryObservers)
+  {
+    return;
+  }
+
+  auto observers = std::make_shared<API::QueryObservers>(*m_queryObservers);
+  observers->erase(std::remove(observers->begin(), observers->end(), observer), observers->end());
+
+  if (observers->empty())
+  {
+    m_queryObservers.reset();
+    return;
+  }
+
+  m_queryObservers = std::move(observers);
+}
+
+void Database::setQueryPlanDiagnosticsEnabled(bool enabled)
+{
+  m_queryPlanDiagnostics->setEnabled(enabled);
+}
+
+bool Database::isQueryPlanDiagnosticsEnabled() const
+{
+  return m_queryPlanDiagnostics->isEnabled();
+}
+
+std::vector<QueryPlan> Database::getQueryPlans() const
+{
+  return m_queryPlanDiagnostics->getQueryPlans();
+}
+
+void Database::clearQueryPlans()
+{
+  m_queryPlanDiagnostics->clear();
+}
+
+std::shared_ptr<ConnectionPool> Database::makeConnectionPool(const QString& poolName, int maxConnections)
+{
+  const auto databaseName = m_databaseName;
+  const auto statementCacheCapacity = m_statementCacheCapacity;
+
+  return std::make_shared<ConnectionPool>(poolName, m_fileName, maxConnections,
+    m_connectionPoolAcquireTimeoutMs, [databaseName, statementCacheCapacity](QSqlDatabase& db)
+    {
+      initializeConnection(db, databaseName, statementCacheCapacity);
+    },
+    [this](QSqlDatabase& db)
+    {
+      applyRuntimeOptions(db, getOptions());
+    });
+}
+
+void Database::createConnectionPool()
+{
+  auto connectionPool = makeConnectionPool(m_databaseName, m_connectionPoolSize);
+
+  std::lock_guard<std::mutex> lock(m_connectionPoolMutex);
+  m_connectionPool = std::move(connectionPool);
+}
+
+void Database::closeConnectionPool()
+{
+  std::shared_ptr<ConnectionPool> connectionPool;
+  {
+    std::lock_guard<std::mutex> lock(m_connectionPoolMutex);
+    connectionPool = std::move(m_connectionPool);
+  }
+
+  if (connectionPool)
+  {
+    connectionPool->closeAll();
+  }
+}
+
+std::shared_ptr<ConnectionPool> Database::getConnectionPool() const
+{
+  std::lock_guard<std::mutex> lock(m_connectionPoolMutex);
+  return m_connectionPool;
+}
+
+void Database::stopQueryExecutor()
+{
+  std::lock_guard<std::mutex> lock(m_queryExecutorMutex);
+
+  // the executor threads release their connections when they exit
+  m_queryExecutor.reset();
+  if (m_queryExecutorConnectionPool)
+  {
+    m_queryExecutorConnectionPool->closeAll();
+    m_queryExecutorConnectionPool.reset();
+  }
+}
+
+QueryExecutor& Database::getQueryExecutor(std::shared_ptr<ConnectionPool>& connectionPool)
 {
   if (!m_db || !m_schema)
   {
     throw DatabaseException(DatabaseException::Type::UnexpectedError, "Database is not yet initialized.");
   }
 
-  QueryPrepareVisitor prepateVisitor(schema);
-  query.accept(prepateVisitor);
-
-  QueryExecuteVisitor executeVisitor(*m_db, schema);
+  std::lock_guard<std::mutex> lock(m_queryExecutorMutex);
+  if (!m_queryExecutor)
+  {
+    // the executor threads get connections of their own, so that they do not compete with the connection pool
+    m_queryExecutorConnectionPool = makeConnectionPool(QString("%1_executor").arg(m_databaseName), m_numAsyncExecutorThreads);
+    m_queryExecutor = std::make_unique<QueryExecutor>(m_numAsyncExecutorThreads);
+  }
 
-  QSqlDatabase::database().transaction();
+  connectionPool = m_queryExecutorConnectionPool;
+  return *m_queryExecutor;
+}
 
-  try
+QSqlDatabase& Database::getThreadConnection() const
+{
+  if (!m_db || !m_schema)
   {
-    query.accept(executeVisitor);
+    throw DatabaseException(DatabaseException::Type::UnexpectedError, "Database is not yet initialized.");
   }
-  catch (DatabaseException&)
+
+  const auto connectionPool = getConnectionPool();
+  if (!connectionPool || std::this_thread::get_id() == m_ownerThreadId)
   {
-    QSqlDatabase::database().rollback();
-    throw;
+    DatabaseOptions options;
+    {
+      std::lock_guard<std::mutex> lock(m_optionsMutex);
+      // SQLite ignores or rejects some options within transactions, so they are applied after the transaction finished
+      if (m_dbOptionsGeneration == m_optionsGeneration || Transaction::getDepth(*m_db) > 0)
+      {
+        return *m_db;
+      }
+
+      options = m_options;
+      m_dbOptionsGeneration = m_optionsGeneration;
+    }
+
+    applyRuntimeOptions(*m_db, options);
+    return *m_db;
   }
 
-  QSqlDatabase::database().commit();
+  return connectionPool->getThreadConnection();
+}
+
+std::shared_ptr<const API::QueryObservers> Database::getQueryObservers() const
+{
+  std::lock_guard<std::mutex> lock(m_queryObserversMutex);
+  return m_queryObservers;
+}
+
+ResultSet Database::execQueryForSchema(QSqlDatabase& db, API::ISchema& schema, API::IQueryElement& query) const
+{
+  QueryPrepareVisitor prepateVisitor(schema);
+  query.accept(prepateVisitor);
+
+  QueryExecuteVisitor executeVisitor(db, schema, getQueryObservers(),
+    (m_queryPlanDiagnostics->isEnabled() && &schema == m_schema.get()) ? m_queryPlanDiagnostics.get() : nullptr);
+
+  Transaction transaction(db);
+  query.accept(executeVisitor);
+  transaction.commit();
 
   return executeVisitor.takeLastQueryResults();
 }
@@ -223,7 +761,7 @@ bool Database::isVersionTableExisting() const
   table.columns[s_sqliteMasterTypeColId].name = "type";
   table.columns[s_sqliteMasterNameColId].name = "name";
 
-  auto results = execQueryForSchema(sqliteMasterSchema,
+  auto results = execQueryForSchema(getThreadConnection(), sqliteMasterSchema,
     Query::FromTable(ID(s_sqliteMasterTableId))
     .select(ColumnHelper::SelectColumnList{s_sqliteMasterNameColId})
     .where(Expr()
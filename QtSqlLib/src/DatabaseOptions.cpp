@@ -0,0 +1,52 @@
+#include "QtSqlLib/DatabaseOptions.h"
+
+namespace QtSqlLib
+{
+
+const QString DatabaseOptions::bulkLoadProfileName = "bulk-load";
+const QString DatabaseOptions::oltpProfileName = "oltp";
+
+template <typename T>
+static void mergeOption(std::optional<T>& target, const std::optional<T>& source)
+{
+  if (source.has_value())
+  {
+    target = source;
+  }
+}
+
+DatabaseOptions DatabaseOptions::bulkLoadProfile()
+{
+  DatabaseOptions options;
+  options.synchronous = Synchronous::Off;
+  options.cacheSize = -256 * 1024;
+  options.tempStore = TempStore::Memory;
+  return options;
+}
+
+DatabaseOptions DatabaseOptions::oltpProfile()
+{
+  DatabaseOptions options;
+  options.journalMode = JournalMode::Wal;
+  options.synchronous = Synchronous::Normal;
+  options.cacheSize = -16 * 1024;
+  options.mmapSize = 256LL * 1024 * 1024;
+  options.tempStore = TempStore::Default;
+  options.busyTimeoutMs = 5000;
+  return options;
+}
+
+DatabaseOptions& DatabaseOptions::merge(const DatabaseOptions& other)
+{
+  mergeOption(journalMode, other.journalMode);
+  mergeOption(synchronous, other.synchronous);
+  mergeOption(cacheSize, other.cacheSize);
+  mergeOption(mmapSize, other.mmapSize);
+  mergeOption(tempStore, other.tempStore);
+  mergeOption(busyTimeoutMs, other.busyTimeoutMs);
+  mergeOption(pageSize, other.pageSize);
+  mergeOption(autoVacuum, other.autoVacuum);
+  return *this;
+}
+
+}
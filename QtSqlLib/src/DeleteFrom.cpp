@@ -6,13 +6,17 @@
 #include "QtSqlLib/Expr.h"
 #include "QtSqlLib/ID.h"
 #include "QtSqlLib/QueryIdentifiers.h"
+#include "QtSqlLib/StatementCache.h"
+
+#include "ReturningClause.h"
 
 namespace QtSqlLib::Query
 {
 
 DeleteFrom::DeleteFrom(const API::IID& tableId) :
   Query(),
-  m_tableId(tableId.get())
+  m_tableId(tableId.get()),
+  m_bIsReturningIds(false)
 {
 }
 
@@ -30,6 +34,18 @@ DeleteFrom& DeleteFrom::where(Expr& expr)
   return *this;
 }
 
+DeleteFrom& DeleteFrom::returnIds()
+{
+  if (m_bIsReturningIds)
+  {
+    throw DatabaseException(DatabaseException::Type::InvalidSyntax,
+      "returnIds() can only be called once per query.");
+  }
+
+  m_bIsReturningIds = true;
+  return *this;
+}
+
 API::IQuery::SqlQuery DeleteFrom::getSqlQuery(
   const QSqlDatabase& db,
   API::ISchema& schema,
@@ -48,10 +64,19 @@ API::IQuery::SqlQuery DeleteFrom::getSqlQuery(
     identifiers.addTableIdentifier(std::nullopt, m_tableId);
     queryStr.append(QString(" WHERE %1").arg(m_whereExpr->toQueryString(schema, identifiers, boundValues)));
   }
+  if (m_bIsReturningIds)
+  {
+    ReturningClause::throwIfNotSupported(db);
+    queryStr.append(QString(" RETURNING %1").arg(ReturningClause::createPrimaryKeysString(table)));
+  }
   queryStr.append(";");
 
-  QSqlQuery query(db);
-  query.prepare(queryStr);
+  auto query = StatementCache::prepare(db, queryStr);
+  if (m_bIsReturningIds)
+  {
+    query.setForwardOnly(false);
+  }
+
   for (const auto& value : boundValues)
   {
     query.addBindValue(value);
@@ -60,4 +85,14 @@ API::IQuery::SqlQuery DeleteFrom::getSqlQuery(
   return { std::move(query) };
 }
 
+ResultSet DeleteFrom::getQueryResults(API::ISchema& schema, QSqlQuery&& query)
+{
+  if (!m_bIsReturningIds)
+  {
+    return {};
+  }
+
+  return ReturningClause::createPrimaryKeysResults(m_tableId, schema.getTables().at(m_tableId), std::move(query));
+}
+
 }
@@ -8,6 +8,8 @@
 #include "Logic.h"
 #include "NestedExpression.h"
 
+#include <algorithm>
+
 namespace QtSqlLib
 {
 
@@ -26,6 +28,12 @@ bool Expr::isEmpty() const
   return m_termElements.empty();
 }
 
+bool Expr::hasRelationshipColumns() const
+{
+  return std::any_of(m_termElements.cbegin(), m_termElements.cend(),
+    [](const std::unique_ptr<ITermElement>& term) { return term->hasRelationshipColumns(); });
+}
+
 Expr& Expr::noCase()
 {
   if (m_nextExpectation != NextTermExpectation::LogicalOperatorOrCollate || m_lastComparison == nullptr)
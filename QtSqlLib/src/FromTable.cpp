@@ -6,7 +6,9 @@
 #include "QtSqlLib/DatabaseException.h"
 #include "QtSqlLib/Expr.h"
 #include "QtSqlLib/ID.h"
+#include "QtSqlLib/StatementCache.h"
 
+#include <QSqlError>
 #include <QVariant>
 
 namespace QtSqlLib::Query
@@ -49,13 +51,19 @@ static void prepareQueryMetaInfoColumns(API::QueryMetaInfo& queryMetaInfo, const
 FromTable::FromTable(const API::IID& tableId) :
   m_hasColumnsSelected(false),
   m_isTableAliasesNeeded(false),
+  m_isStreaming(false),
+  m_isSplitJoins(false),
   m_isGroupByCaseInsensitive(false),
-  m_isOrderByCaseInsensitive(false)
+  m_isOrderByCaseInsensitive(false),
+  m_keysetOrder(ColumnHelper::EOrder::Ascending)
 {
   m_queryMetaInfo.tableId = tableId.get();
 }
 
-FromTable::~FromTable() = default;
+FromTable::~FromTable()
+{
+  releaseSplitJoinQueries();
+}
 
 FromTable& FromTable::selectAll()
 {
@@ -83,25 +91,30 @@ FromTable& FromTable::select(const ColumnHelper::SelectColumnList& columns)
 
 FromTable& FromTable::joinAll(const API::IID& relationshipId)
 {
-  throwIfMultipleJoins(relationshipId.get());
-
   // empty JoinData::m_columnInfo implies all column ids
-  m_joins.emplace_back(API::QueryMetaInfo { -1, relationshipId.get(), {}, {}, {} });
-
+  addJoin({ relationshipId.get() }, {});
   return *this;
 }
 
 FromTable& FromTable::join(const API::IID& relationshipId, const ColumnHelper::SelectColumnList& columns)
 {
-  throwIfMultipleJoins(relationshipId.get());
+  return join(ColumnHelper::RelationshipPath { relationshipId.get() }, columns);
+}
+
+FromTable& FromTable::joinAll(const ColumnHelper::RelationshipPath& relationshipPath)
+{
+  addJoin(relationshipPath, {});
+  return *this;
+}
 
+FromTable& FromTable::join(const ColumnHelper::RelationshipPath& relationshipPath, const ColumnHelper::SelectColumnList& columns)
+{
   if (columns.empty())
   {
     throw DatabaseException(DatabaseException::Type::InvalidSyntax, "At least one column must be selected");
   }
 
-  m_joins.emplace_back(API::QueryMetaInfo { -1, relationshipId.get(), columns, {}, {} });
-
+  addJoin(relationshipPath, columns);
   return *this;
 }
 
@@ -155,7 +168,144 @@ FromTable& FromTable::orderBy(const ColumnHelper::OrderColumnList& columns, bool
   return *this;
 }
 
+FromTable& FromTable::limit(int numTuples)
+{
+  if (m_limit || numTuples < 0)
+  {
+    throw DatabaseException(DatabaseException::Type::InvalidSyntax,
+      "limit() should only be called once with a non-negative number of tuples.");
+  }
+
+  m_limit = numTuples;
+  return *this;
+}
+
+FromTable& FromTable::offset(int numTuples)
+{
+  if (m_offset || numTuples < 0)
+  {
+    throw DatabaseException(DatabaseException::Type::InvalidSyntax,
+      "offset() should only be called once with a non-negative number of tuples.");
+  }
+
+  m_offset = numTuples;
+  return *this;
+}
+
+FromTable& FromTable::after(const PrimaryKey& primaryKey)
+{
+  throwIfMultipleKeysets();
+
+  m_keysetPrimaryKey = primaryKey;
+  m_keysetOrder = ColumnHelper::EOrder::Ascending;
+  return *this;
+}
+
+FromTable& FromTable::before(const PrimaryKey& primaryKey)
+{
+  throwIfMultipleKeysets();
+
+  // descending order, so that a limit selects the tuples right before the key
+  m_keysetPrimaryKey = primaryKey;
+  m_keysetOrder = ColumnHelper::EOrder::Descending;
+  return *this;
+}
+
+FromTable& FromTable::streaming()
+{
+  m_isStreaming = true;
+  return *this;
+}
+
+FromTable& FromTable::splitJoins()
+{
+  m_isSplitJoins = true;
+  return *this;
+}
+
 API::IQuery::SqlQuery FromTable::getSqlQuery(const QSqlDatabase& db, API::ISchema& schema, ResultSet& /*previousQueryResults*/)
+{
+  std::vector<QVariant> boundValues;
+  const auto queryStr = createQueryString(schema, boundValues);
+
+  auto query = prepareQuery(db, queryStr, boundValues);
+  query.setForwardOnly(m_isStreaming);
+
+  for (auto& splitJoinQuery : m_splitJoinQueries)
+  {
+    splitJoinQuery.sqlQuery = prepareQuery(db, splitJoinQuery.queryString, splitJoinQuery.boundValues);
+    splitJoinQuery.sqlQuery.setForwardOnly(false);
+  }
+
+  return { std::move(query) };
+}
+
+ResultSet FromTable::getQueryResults(API::ISchema& /*schema*/, QSqlQuery&& query)
+{
+  for (auto& splitJoinQuery : m_splitJoinQueries)
+  {
+    if (!splitJoinQuery.sqlQuery.exec())
+    {
+      const auto errorText = splitJoinQuery.sqlQuery.lastError().text();
+      releaseSplitJoinQueries();
+
+      throw DatabaseException(DatabaseException::Type::QueryError,
+        QString("Could not execute query: %1").arg(errorText));
+    }
+  }
+
+  ResultSet results(std::move(query), std::move(m_queryMetaInfo), std::move(m_joins), m_isStreaming);
+  for (auto& splitJoinQuery : m_splitJoinQueries)
+  {
+    results.addSplitJoinQuery(std::move(splitJoinQuery.sqlQuery), std::move(splitJoinQuery.parentKeyMetaInfo));
+  }
+  m_splitJoinQueries.clear();
+
+  return results;
+}
+
+CompiledQuery FromTable::compile(API::ISchema& schema)
+{
+  if (m_isSplitJoins)
+  {
+    throw DatabaseException(DatabaseException::Type::InvalidSyntax, "splitJoins() is not supported by compiled queries.");
+  }
+
+  std::vector<QVariant> boundValues;
+  const auto queryStr = createQueryString(schema, boundValues);
+
+  return CompiledQuery(queryStr, boundValues, std::move(m_queryMetaInfo), std::move(m_joins), m_isStreaming);
+}
+
+QSqlQuery FromTable::prepareQuery(const QSqlDatabase& db, const QString& queryStr, const std::vector<QVariant>& boundValues)
+{
+  for (const auto& value : boundValues)
+  {
+    if (value.canConvert<ColumnHelper::Parameter>())
+    {
+      throw DatabaseException(DatabaseException::Type::InvalidSyntax,
+        QString("Query parameter '%1' requires a compiled query.").arg(value.value<ColumnHelper::Parameter>().name));
+    }
+  }
+
+  auto query = StatementCache::prepare(db, queryStr);
+  for (const auto& value : boundValues)
+  {
+    query.addBindValue(value);
+  }
+  return query;
+}
+
+void FromTable::releaseSplitJoinQueries()
+{
+  for (auto& splitJoinQuery : m_splitJoinQueries)
+  {
+    StatementCache::release(splitJoinQuery.sqlQuery);
+  }
+  m_splitJoinQueries.clear();
+}
+
+QString FromTable::createQueryString(API::ISchema& schema, std::vector<QVariant>& boundValues)
 {
   if (!m_hasColumnsSelected)
   {
@@ -171,24 +321,32 @@ API::IQuery::SqlQuery FromTable::getSqlQuery(const QSqlDatabase& db, API::ISchem
   prepareQueryMetaInfoColumns(m_queryMetaInfo, table);
   addToSelectedColumns(m_queryMetaInfo, table);
 
-  std::vector<QVariant> boundValues;
-  const auto joinStr = processJoinsAndCreateQuerySubstring(schema, boundValues, table);
+  if (m_isSplitJoins)
+  {
+    createSplitJoinQueries(schema, table);
+  }
+
+  const auto joinStr = m_isSplitJoins ? QString() : processJoinsAndCreateQuerySubstring(schema, boundValues);
   const auto selectColsStr = createSelectString(schema);
 
   QString queryStr;
-  queryStr.append(QString("SELECT %1 FROM '%2'").arg(selectColsStr).arg(table.name));
-  if (m_isTableAliasesNeeded)
+  queryStr.append(QString("SELECT %1 FROM %2").arg(selectColsStr).arg(createFromTableString(schema, table)));
+  queryStr.append(joinStr);
+
+  if ((m_limit || m_offset) && !m_joins.empty())
   {
-    queryStr.append(QString(" AS '%1'").arg(m_queryIdentifiers.resolveTableIdentifier(schema)));
+    throw DatabaseException(DatabaseException::Type::InvalidSyntax,
+      "limit() and offset() cannot be used with joins, since they would limit the joined rows.");
   }
 
-  queryStr.append(joinStr);
-
-  if (m_whereExpr)
+  if (m_keysetPrimaryKey && !m_orderColumns.empty())
   {
-    queryStr.append(QString(" WHERE %1").arg(m_whereExpr->toQueryString(schema, m_queryIdentifiers, boundValues)));
+    throw DatabaseException(DatabaseException::Type::InvalidSyntax,
+      "after() and before() cannot be combined with orderBy(), since the tuples are ordered by primary key.");
   }
 
+  queryStr.append(createWhereString(schema, table, boundValues));
+
   if (!m_groupColumns.empty())
   {
     queryStr.append(QString(" GROUP BY %1").arg(createGroupByString(schema)));
@@ -211,22 +369,137 @@ API::IQuery::SqlQuery FromTable::getSqlQuery(const QSqlDatabase& db, API::ISchem
       queryStr.append(" COLLATE NOCASE");
     }
   }
+  else if (m_keysetPrimaryKey)
+  {
+    queryStr.append(QString(" ORDER BY %1").arg(createPrimaryKeyOrderByString(schema, table, m_keysetOrder)));
+  }
+
+  // joined rows of the same tuple have to be adjacent when streaming
+  if (m_isStreaming && !m_joins.empty() && !m_keysetPrimaryKey)
+  {
+    queryStr.append(QString("%1 %2")
+      .arg(m_orderColumns.empty() ? " ORDER BY" : ",")
+      .arg(createStreamingOrderByString(schema, table)));
+  }
+
+  // bound instead of inlined, so that all pages share the same prepared statement
+  if (m_limit || m_offset)
+  {
+    queryStr.append(" LIMIT ?");
+    boundValues.emplace_back(m_limit.value_or(-1));
+
+    if (m_offset)
+    {
+      queryStr.append(" OFFSET ?");
+      boundValues.emplace_back(m_offset.value());
+    }
+  }
 
   queryStr.append(";");
 
-  QSqlQuery query(db);
-  query.prepare(queryStr);
-  for (const auto& value : boundValues)
+  return queryStr;
+}
+
+QString FromTable::createFromTableString(API::ISchema& schema, const API::Table& table) const
+{
+  QString fromStr = QString("'%1'").arg(table.name);
+  if (m_isTableAliasesNeeded)
   {
-    query.addBindValue(value);
+    fromStr.append(QString(" AS '%1'").arg(m_queryIdentifiers.resolveTableIdentifier(schema)));
   }
+  return fromStr;
+}
 
-  return { std::move(query) };
+QString FromTable::createWhereString(
+  API::ISchema& schema, const API::Table& table, std::vector<QVariant>& boundValues) const
+{
+  QString whereStr = "";
+  if (m_whereExpr)
+  {
+    whereStr = m_whereExpr->toQueryString(schema, m_queryIdentifiers, boundValues);
+  }
+
+  if (m_keysetPrimaryKey)
+  {
+    const auto keysetStr = createKeysetString(schema, table, boundValues);
+    whereStr = whereStr.isEmpty() ? keysetStr : QString("(%1) AND %2").arg(whereStr).arg(keysetStr);
+  }
+
+  if (whereStr.isEmpty())
+  {
+    return whereStr;
+  }
+  return QString(" WHERE %1").arg(whereStr);
 }
 
-ResultSet FromTable::getQueryResults(API::ISchema& /*schema*/, QSqlQuery&& query)
+void FromTable::createSplitJoinQueries(API::ISchema& schema, const API::Table& table)
 {
-  return ResultSet(std::move(query), std::move(m_queryMetaInfo), std::move(m_joins));
+  if (m_isStreaming || !m_groupColumns.empty() || m_havingExpr)
+  {
+    throw DatabaseException(DatabaseException::Type::InvalidSyntax,
+      "splitJoins() cannot be combined with streaming(), groupBy() or having().");
+  }
+
+  for (const auto& orderCol : m_orderColumns)
+  {
+    if (orderCol.data.relationshipId.has_value())
+    {
+      throw DatabaseException(DatabaseException::Type::InvalidSyntax,
+        "Queries with split joins can only be ordered by columns of the queried table.");
+    }
+  }
+
+  for (const auto& join : m_joins)
+  {
+    if (join.parentRelationshipId)
+    {
+      throw DatabaseException(DatabaseException::Type::InvalidSyntax, "splitJoins() does not support nested joins.");
+    }
+  }
+
+  // the where expression is applied to the queried table only and each join query contains a single join
+  if (m_whereExpr && m_whereExpr->hasRelationshipColumns())
+  {
+    throw DatabaseException(DatabaseException::Type::InvalidSyntax,
+      "Queries with split joins can only be filtered by columns of the queried table.");
+  }
+
+  // the selection of the queried table is restored after the join queries are created
+  auto compiledColumnSelection = std::move(m_compiledColumnSelection);
+
+  for (auto& join : m_joins)
+  {
+    m_compiledColumnSelection.clear();
+
+    // the parent key columns have the same order as in the queried tuples, so that the keys compare equal
+    SplitJoinQueryData splitJoinQuery;
+    auto& parentKeyMetaInfo = splitJoinQuery.parentKeyMetaInfo;
+    parentKeyMetaInfo.tableId = m_queryMetaInfo.tableId;
+
+    for (const auto columnIndex : m_queryMetaInfo.primaryKeyColumnIndices)
+    {
+      const auto columnId = m_queryMetaInfo.columns.at(columnIndex).column.value<API::IID::Type>();
+
+      parentKeyMetaInfo.primaryKeyColumnIndices.emplace_back(parentKeyMetaInfo.columns.size());
+      parentKeyMetaInfo.columnQueryIndices.emplace_back(m_compiledColumnSelection.size());
+      parentKeyMetaInfo.columns.emplace_back(ColumnHelper::SelectColumn{ columnId });
+
+      m_compiledColumnSelection.emplace_back(SelectColumnData{ QVariant::fromValue(makeColumnData(std::nullopt, columnId)), "" });
+    }
+
+    // parent tuples without related tuples are already part of the root query
+    const auto joinStr = createJoinQuerySubstring(schema, splitJoinQuery.boundValues, join, true);
+
+    auto& queryStr = splitJoinQuery.queryString;
+    queryStr.append(QString("SELECT %1 FROM %2").arg(createSelectString(schema)).arg(createFromTableString(schema, table)));
+    queryStr.append(joinStr);
+    queryStr.append(createWhereString(schema, table, splitJoinQuery.boundValues));
+    queryStr.append(";");
+
+    m_splitJoinQueries.emplace_back(std::move(splitJoinQuery));
+  }
+
+  m_compiledColumnSelection = std::move(compiledColumnSelection);
 }
 
 void FromTable::throwIfMultipleSelects() const
@@ -250,6 +523,47 @@ void FromTable::throwIfMultipleJoins(API::IID::Type relationshipId) const
   }
 }
 
+void FromTable::addJoin(const ColumnHelper::RelationshipPath& relationshipPath, const ColumnHelper::SelectColumnList& columns)
+{
+  if (relationshipPath.empty())
+  {
+    throw DatabaseException(DatabaseException::Type::InvalidSyntax, "Relationship path must not be empty.");
+  }
+
+  // the leading relationships of the path are joined implicitly with all columns, unless joined before
+  std::optional<API::IID::Type> parentRelationshipId;
+  for (size_t i=0; i<relationshipPath.size() - 1; ++i)
+  {
+    const auto relationshipId = relationshipPath.at(i);
+    const auto it = std::find_if(m_joins.cbegin(), m_joins.cend(),
+      [relationshipId](const API::QueryMetaInfo& join) { return join.relationshipId.value() == relationshipId; });
+
+    if (it == m_joins.cend())
+    {
+      m_joins.emplace_back(API::QueryMetaInfo { -1, relationshipId, parentRelationshipId, {}, {}, {}, {} });
+    }
+    else if (it->parentRelationshipId != parentRelationshipId)
+    {
+      throw DatabaseException(DatabaseException::Type::InvalidSyntax,
+        QString("Relationship with id %1 is already joined through another path.").arg(relationshipId));
+    }
+
+    parentRelationshipId = relationshipId;
+  }
+
+  throwIfMultipleJoins(relationshipPath.back());
+  m_joins.emplace_back(API::QueryMetaInfo { -1, relationshipPath.back(), parentRelationshipId, columns, {}, {}, {} });
+}
+
+void FromTable::throwIfMultipleKeysets() const
+{
+  if (m_keysetPrimaryKey)
+  {
+    throw DatabaseException(DatabaseException::Type::InvalidSyntax,
+      "after() or before() should only be called once.");
+  }
+}
+
 void FromTable::verifyJoinsAndCheckAliasesNeeded(API::ISchema& schema)
 {
   std::set<API::IID::Type> joinTableIds;
@@ -262,11 +576,16 @@ void FromTable::verifyJoinsAndCheckAliasesNeeded(API::ISchema& schema)
     schema.getSanityChecker().throwIfRelationshipIsNotExisting(relationshipId);
     const auto& relationship = schema.getRelationships().at(relationshipId);
 
-    if (m_queryMetaInfo.tableId == relationship.tableFromId)
+    // parent joins always precede their nested joins
+    const auto parentTableId = join.parentRelationshipId
+      ? findJoin(join.parentRelationshipId.value()).tableId
+      : m_queryMetaInfo.tableId;
+
+    if (parentTableId == relationship.tableFromId)
     {
       join.tableId = relationship.tableToId;
     }
-    else if (m_queryMetaInfo.tableId == relationship.tableToId)
+    else if (parentTableId == relationship.tableToId)
     {
       join.tableId = relationship.tableFromId;
     }
@@ -275,7 +594,7 @@ void FromTable::verifyJoinsAndCheckAliasesNeeded(API::ISchema& schema)
       throw DatabaseException(DatabaseException::Type::InvalidId,
         QString("Invalid relationship id %1 for join with table with id %2.")
         .arg(relationshipId)
-        .arg(m_queryMetaInfo.tableId));
+        .arg(parentTableId));
     }
 
     schema.getSanityChecker().throwIfTableIdNotExisting(join.tableId);
@@ -290,6 +609,20 @@ void FromTable::verifyJoinsAndCheckAliasesNeeded(API::ISchema& schema)
   }
 }
 
+const API::QueryMetaInfo& FromTable::findJoin(API::IID::Type relationshipId) const
+{
+  for (const auto& join : m_joins)
+  {
+    if (join.relationshipId.value() == relationshipId)
+    {
+      return join;
+    }
+  }
+
+  throw DatabaseException(DatabaseException::Type::UnexpectedError,
+    QString("No join with relationship id %1 found.").arg(relationshipId));
+}
+
 void FromTable::generateQueryIdentifiers(API::ISchema& schema)
 {
   auto tableAliasIndex = 0;
@@ -378,65 +711,80 @@ void FromTable::addForeignKeyColumns(
 
 QString FromTable::processJoinsAndCreateQuerySubstring(
   API::ISchema& schema,
-  std::vector<QVariant>& boundValues,
-  const API::Table& table)
+  std::vector<QVariant>& boundValues)
 {
   QString joinStr = "";
   for (auto& join : m_joins)
   {
-    const auto relationshipId = join.relationshipId.value();
-    const auto& relationship = schema.getRelationships().at(relationshipId);
-    const auto& joinTable = schema.getTables().at(join.tableId);
-    const QString joinTableAlias = m_isTableAliasesNeeded ? m_queryIdentifiers.resolveTableIdentifier(schema, relationshipId) : "";
+    joinStr.append(createJoinQuerySubstring(schema, boundValues, join));
+  }
 
-    prepareQueryMetaInfoColumns(join, joinTable);
-    addToSelectedColumns(join, joinTable);
+  return joinStr;
+}
 
-    if (relationship.type == API::RelationshipType::ManyToMany)
-    {
-      const auto parentFromTableId = m_queryMetaInfo.tableId;
-      const auto linkTableId = schema.getManyToManyLinkTableId(relationshipId);
-      const auto& linkTable = schema.getTables().at(linkTableId);
+QString FromTable::createJoinQuerySubstring(
+  API::ISchema& schema,
+  std::vector<QVariant>& boundValues,
+  API::QueryMetaInfo& join,
+  bool isInnerJoin)
+{
+  QString joinStr = "";
 
-      const auto parentToTableId = join.tableId;
-      const auto& foreignKeyReferences = linkTable.relationshipToForeignKeyReferencesMap;
-      const auto secondForeignKeyRefIndex = (parentFromTableId == parentToTableId ? 1 : 0);
+  const auto relationshipId = join.relationshipId.value();
+  const auto& relationship = schema.getRelationships().at(relationshipId);
+  const auto& joinTable = schema.getTables().at(join.tableId);
 
-      appendJoinQuerySubstring(
-        joinStr, schema, linkTable, relationshipId, relationshipIdForLink(relationshipId),
-        std::nullopt, relationshipIdForLink(relationshipId),
-        foreignKeyReferences, 0, true, boundValues);
+  const auto parentTableId = m_queryIdentifiers.tableId(join.parentRelationshipId);
+  const auto& parentTable = schema.getTables().at(parentTableId);
+  const QString joinTableAlias = m_isTableAliasesNeeded ? m_queryIdentifiers.resolveTableIdentifier(schema, relationshipId) : "";
 
-      appendJoinQuerySubstring(
-        joinStr, schema, joinTable, relationshipId, relationshipIdForLink(relationshipId),
-        relationshipId, relationshipIdForLink(relationshipId),
-        foreignKeyReferences, secondForeignKeyRefIndex, false, boundValues);
-    }
-    else
-    {
-      const auto needToSwapParentChild = (
-        (relationship.type == API::RelationshipType::OneToMany && relationship.tableFromId == m_queryMetaInfo.tableId) ||
-        (relationship.type == API::RelationshipType::ManyToOne && relationship.tableToId == m_queryMetaInfo.tableId));
+  prepareQueryMetaInfoColumns(join, joinTable);
+  addToSelectedColumns(join, joinTable);
 
-      const auto& foreignKeyReferences = (needToSwapParentChild
-        ? joinTable.relationshipToForeignKeyReferencesMap
-        : table.relationshipToForeignKeyReferencesMap);
+  if (relationship.type == API::RelationshipType::ManyToMany)
+  {
+    const auto parentFromTableId = parentTableId;
+    const auto linkTableId = schema.getManyToManyLinkTableId(relationshipId);
+    const auto& linkTable = schema.getTables().at(linkTableId);
+
+    const auto parentToTableId = join.tableId;
+    const auto& foreignKeyReferences = linkTable.relationshipToForeignKeyReferencesMap;
+    const auto secondForeignKeyRefIndex = (parentFromTableId == parentToTableId ? 1 : 0);
+
+    appendJoinQuerySubstring(
+      joinStr, schema, linkTable, relationshipId, relationshipIdForLink(relationshipId),
+      join.parentRelationshipId, relationshipIdForLink(relationshipId),
+      foreignKeyReferences, 0, true, isInnerJoin, boundValues);
+
+    appendJoinQuerySubstring(
+      joinStr, schema, joinTable, relationshipId, relationshipIdForLink(relationshipId),
+      relationshipId, relationshipIdForLink(relationshipId),
+      foreignKeyReferences, secondForeignKeyRefIndex, false, isInnerJoin, boundValues);
+  }
+  else
+  {
+    const auto needToSwapParentChild = (
+      (relationship.type == API::RelationshipType::OneToMany && relationship.tableFromId == parentTableId) ||
+      (relationship.type == API::RelationshipType::ManyToOne && relationship.tableToId == parentTableId));
 
-      std::optional<API::IID::Type> foreignKeyRelationshipId = std::nullopt;
-      std::optional<API::IID::Type> relationshipIdParentTable = join.relationshipId;
-      std::optional<API::IID::Type> relationshipIdChildTable = std::nullopt;
+    const auto& foreignKeyReferences = (needToSwapParentChild
+      ? joinTable.relationshipToForeignKeyReferencesMap
+      : parentTable.relationshipToForeignKeyReferencesMap);
 
-      if (needToSwapParentChild)
-      {
-        foreignKeyRelationshipId = relationshipId;
-        std::swap(relationshipIdParentTable, relationshipIdChildTable);
-      }
+    std::optional<API::IID::Type> foreignKeyRelationshipId = join.parentRelationshipId;
+    std::optional<API::IID::Type> relationshipIdParentTable = join.relationshipId;
+    std::optional<API::IID::Type> relationshipIdChildTable = join.parentRelationshipId;
 
-      appendJoinQuerySubstring(
-        joinStr, schema, joinTable, relationshipId, foreignKeyRelationshipId,
-        relationshipIdParentTable, relationshipIdChildTable,
-        foreignKeyReferences, 0, false, boundValues);
+    if (needToSwapParentChild)
+    {
+      foreignKeyRelationshipId = relationshipId;
+      std::swap(relationshipIdParentTable, relationshipIdChildTable);
     }
+
+    appendJoinQuerySubstring(
+      joinStr, schema, joinTable, relationshipId, foreignKeyRelationshipId,
+      relationshipIdParentTable, relationshipIdChildTable,
+      foreignKeyReferences, 0, false, isInnerJoin, boundValues);
   }
 
   return joinStr;
@@ -506,6 +854,80 @@ QString FromTable::createOrderByString(API::ISchema& schema) const
   return orderByStr;
 }
 
+QString FromTable::createStreamingOrderByString(API::ISchema& schema, const API::Table& table) const
+{
+  for (const auto& orderCol : m_orderColumns)
+  {
+    if (orderCol.data.relationshipId.has_value())
+    {
+      throw DatabaseException(DatabaseException::Type::InvalidSyntax,
+        "Streaming queries with joins can only be ordered by columns of the queried table.");
+    }
+  }
+
+  return createPrimaryKeyOrderByString(schema, table, ColumnHelper::EOrder::Ascending);
+}
+
+QString FromTable::createPrimaryKeyOrderByString(
+  API::ISchema& schema, const API::Table& table, ColumnHelper::EOrder order) const
+{
+  QString orderByStr = "";
+  for (const auto& columnId : table.primaryKeys)
+  {
+    if (!orderByStr.isEmpty())
+    {
+      orderByStr.append(", ");
+    }
+    orderByStr.append(QString("%1 %2")
+      .arg(m_queryIdentifiers.resolveColumnIdentifier(schema, makeColumnData(std::nullopt, columnId)))
+      .arg(order == ColumnHelper::EOrder::Ascending ? "ASC" : "DESC"));
+  }
+
+  return orderByStr;
+}
+
+QString FromTable::createKeysetString(
+  API::ISchema& schema, const API::Table& table, std::vector<QVariant>& boundValues) const
+{
+  const auto& primaryKey = m_keysetPrimaryKey.value();
+  if (primaryKey.tableId() != m_queryMetaInfo.tableId)
+  {
+    throw DatabaseException(DatabaseException::Type::InvalidId,
+      QString("Primary key of table with id %1 cannot be used to paginate table with id %2.")
+      .arg(primaryKey.tableId())
+      .arg(m_queryMetaInfo.tableId));
+  }
+
+  QString columnsStr = "";
+  QString valuesStr = "";
+  for (const auto& columnId : table.primaryKeys)
+  {
+    if (!primaryKey.hasValue(columnId))
+    {
+      throw DatabaseException(DatabaseException::Type::InvalidId,
+        QString("Missing value of primary key column with id %1.").arg(columnId));
+    }
+
+    if (!columnsStr.isEmpty())
+    {
+      columnsStr.append(", ");
+      valuesStr.append(", ");
+    }
+
+    columnsStr.append(m_queryIdentifiers.resolveColumnIdentifier(schema, makeColumnData(std::nullopt, columnId)));
+    valuesStr.append("?");
+    boundValues.emplace_back(primaryKey.value(columnId));
+  }
+
+  // row value comparison, which SQLite can resolve by a range scan on the primary key index
+  const auto op = (m_keysetOrder == ColumnHelper::EOrder::Ascending ? ">" : "<");
+  if (table.primaryKeys.size() == 1)
+  {
+    return QString("%1 %2 %3").arg(columnsStr).arg(op).arg(valuesStr);
+  }
+  return QString("(%1) %2 (%3)").arg(columnsStr).arg(op).arg(valuesStr);
+}
+
 void FromTable::appendJoinQuerySubstring(
   QString& joinStrOut, API::ISchema& schema, const API::Table& joinTable,
   API::IID::Type relationshipId, const std::optional<API::IID::Type>& foreignKeyRelationshipId,
@@ -513,6 +935,7 @@ void FromTable::appendJoinQuerySubstring(
   const API::RelationshipToForeignKeyReferencesMap& foreignKeyReferences,
   int foreignKeyReferencesIndex,
   bool noJoinAlias,
+  bool isInnerJoin,
   std::vector<QVariant>& boundValues)
 {
   const auto parentTableId = m_queryIdentifiers.tableId(relationshipIdFromTable);
@@ -544,7 +967,7 @@ void FromTable::appendJoinQuerySubstring(
       makeColumnData(relationshipIdToTable, idMapping.second));
   }
 
-  joinStrOut.append(QString(" LEFT JOIN '%1'").arg(joinTable.name));
+  joinStrOut.append(QString(" %1 '%2'").arg(isInnerJoin ? "JOIN" : "LEFT JOIN").arg(joinTable.name));
 
   if (m_isTableAliasesNeeded && !noJoinAlias)
   {
@@ -26,6 +26,8 @@ public:
     const API::IQueryIdentifiers& queryIdentifiers,
     std::vector<QVariant>& boundValuesOut) const = 0;
 
+  virtual bool hasRelationshipColumns() const = 0;
+
 };
 
 }
@@ -1,5 +1,7 @@
 #include "QtSqlLib/Query/InsertInto.h"
 
+#include "ReturningClause.h"
+
 namespace QtSqlLib::Query
 {
 
@@ -17,6 +19,12 @@ InsertInto& InsertInto::value(const API::IID& columnId, const QVariant& value)
   return *this;
 }
 
+InsertInto& InsertInto::returnIds()
+{
+  setReturningIds();
+  return *this;
+}
+
 void InsertInto::bindQueryValues(QSqlQuery& query) const
 {
   for (const auto& value : m_values)
@@ -27,6 +35,11 @@ void InsertInto::bindQueryValues(QSqlQuery& query) const
 
 API::IQuery::SqlQuery InsertInto::getSqlQuery(const QSqlDatabase& db, API::ISchema& schema, ResultSet& /*previousQueryResults*/)
 {
+  if (isReturningIds() && !ReturningClause::isSupported(db))
+  {
+    return { execAndQueryInsertedIds(db, schema), QueryMode::Single };
+  }
+
   return { getQSqlQuery(db, schema), QueryMode::Single };
 }
 
@@ -7,7 +7,6 @@
 #include "QtSqlLib/Query/LinkTuples.h"
 
 #include "InsertIntoReferences.h"
-#include "QueryInsertedIDs.h"
 
 namespace QtSqlLib::Query
 {
@@ -105,13 +104,13 @@ void InsertIntoExt::prepare(API::ISchema& schema)
     addUpdateForeignKeyColumnsToInsertIntoQuery(schema, relationshipId, relationship, table, linkedTuples.second);
   }
 
-  addQuery(std::move(m_insertQuery));
-
   if (m_bIsReturningInsertedIds)
   {
-    addQuery(std::make_unique<QueryInsertedIDs>(m_tableId));
+    m_insertQuery->returnIds();
   }
 
+  addQuery(std::move(m_insertQuery));
+
   addLinkTuplesQueriesForRelationshipIds(specialInsertionRelationshipIds);
 }
 
@@ -0,0 +1,59 @@
+#include "JoinParentRows.h"
+
+#include "QtSqlLib/DatabaseException.h"
+#include "QtSqlLib/TupleView.h"
+
+namespace QtSqlLib
+{
+
+JoinParentRows::JoinParentRows(const std::vector<int>& joinParentIndices) :
+  m_joinParentIndices(joinParentIndices),
+  m_isParentJoin(joinParentIndices.size(), false),
+  m_queriedRow(0),
+  m_joinedRowsByKey(joinParentIndices.size())
+{
+  for (const auto parentIndex : joinParentIndices)
+  {
+    if (parentIndex >= 0)
+    {
+      m_isParentJoin[parentIndex] = true;
+    }
+  }
+}
+
+void JoinParentRows::setQueriedRow(size_t row)
+{
+  m_queriedRow = row;
+  for (auto& joinedRows : m_joinedRowsByKey)
+  {
+    joinedRows.clear();
+  }
+}
+
+size_t JoinParentRows::parentRow(size_t joinIndex, const TupleView& tuple) const
+{
+  const auto parentIndex = m_joinParentIndices.at(joinIndex);
+  if (parentIndex < 0)
+  {
+    return m_queriedRow;
+  }
+
+  const auto& joinedRows = m_joinedRowsByKey.at(parentIndex);
+  const auto it = joinedRows.find(tuple.parentPrimaryKey());
+  if (it == joinedRows.end())
+  {
+    throw DatabaseException(DatabaseException::Type::UnexpectedError, "Joined tuple without parent tuple.");
+  }
+  return it->second;
+}
+
+void JoinParentRows::addJoinedRow(size_t joinIndex, const TupleView& tuple, size_t row)
+{
+  // only the rows of joins with nested joins are looked up later
+  if (m_isParentJoin.at(joinIndex))
+  {
+    m_joinedRowsByKey[joinIndex].emplace(tuple.primaryKey(), row);
+  }
+}
+
+}
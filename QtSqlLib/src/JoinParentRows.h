@@ -0,0 +1,38 @@
+#pragma once
+
+#include "QtSqlLib/PrimaryKey.h"
+
+#include <unordered_map>
+#include <vector>
+
+namespace QtSqlLib
+{
+
+class TupleView;
+
+/**
+ * Finds the rows of the parent tuples of joined tuples while the tuples of a result set are copied row by row. The
+ * parent of a joined tuple is the queried tuple or, for nested joins, the tuple of the parent join with the parent
+ * primary key of the joined tuple.
+ */
+class JoinParentRows
+{
+public:
+  // index of the parent join of each join, -1 for joins of the queried table
+  explicit JoinParentRows(const std::vector<int>& joinParentIndices);
+
+  void setQueriedRow(size_t row);
+
+  size_t parentRow(size_t joinIndex, const TupleView& tuple) const;
+  void addJoinedRow(size_t joinIndex, const TupleView& tuple, size_t row);
+
+private:
+  const std::vector<int>& m_joinParentIndices;
+  std::vector<bool> m_isParentJoin;
+
+  size_t m_queriedRow;
+  std::vector<std::unordered_map<PrimaryKey, size_t>> m_joinedRowsByKey;
+
+};
+
+}
@@ -5,7 +5,7 @@
 #include "QtSqlLib/Query/BatchInsertInto.h"
 
 #include "BatchInsertRemainingKeys.h"
-#include "UpdateTableForeignKeys.h"
+#include "BatchUpdateForeignKeys.h"
 
 #include <QVariantList>
 
@@ -70,23 +70,23 @@ void LinkTuples::prepare(API::ISchema& schema)
 
     addQuery(std::move(batchInsertQuery));
   }
-  else
+  else if (!affectedData.affectedTuples.empty())
   {
+    auto updateQuery = std::make_unique<BatchUpdateForeignKeys>(affectedData.tableId, affectedData.primaryForeignKeyColIdMap);
+    updateQuery->setRemainingKeysMode(affectedData.remainingKeysMode);
+
     for (const auto& affectedTuple : affectedData.affectedTuples)
     {
-      auto updateQuery = std::make_unique<UpdateTableForeignKeys>(affectedData.tableId, affectedData.primaryForeignKeyColIdMap);
-      updateQuery->setRemainingKeysMode(affectedData.remainingKeysMode);
-
       if (affectedData.remainingKeysMode != RelationshipPreparationData::RemainingKeysMode::RemainingForeignKeys)
       {
-        updateQuery->setForeignKeyValues(affectedTuple.foreignKeyValues);
+        updateQuery->addForeignKeyValues(affectedTuple.foreignKeyValues);
       }
       if (affectedData.remainingKeysMode != RelationshipPreparationData::RemainingKeysMode::RemainingPrimaryKeys)
       {
-        updateQuery->makeAndAddWhereExpr(affectedTuple.childKeyValues);
+        updateQuery->addChildKeyValues(affectedTuple.childKeyValues);
       }
-      addQuery(std::move(updateQuery));
     }
+    addQuery(std::move(updateQuery));
   }
 }
 
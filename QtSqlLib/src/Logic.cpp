@@ -29,4 +29,9 @@ QString Logic::toQueryString(
   return "";
 }
 
+bool Logic::hasRelationshipColumns() const
+{
+  return false;
+}
+
 }
@@ -18,6 +18,8 @@ public:
     const API::IQueryIdentifiers& queryIdentifiers,
     std::vector<QVariant>& boundValuesOut) const override;
 
+  bool hasRelationshipColumns() const override;
+
 private:
   LogicalOperator m_operator;
 
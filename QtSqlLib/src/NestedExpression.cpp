@@ -20,4 +20,9 @@ QString NestedExpression::toQueryString(
   return QString("(%1)").arg(m_nestedExpr->toQueryString(schema, queryIdentifiers, boundValuesOut));
 }
 
+bool NestedExpression::hasRelationshipColumns() const
+{
+  return m_nestedExpr->hasRelationshipColumns();
+}
+
 }
@@ -22,6 +22,8 @@ public:
     const API::IQueryIdentifiers& queryIdentifiers,
     std::vector<QVariant>& boundValuesOut) const override;
 
+  bool hasRelationshipColumns() const override;
+
 private:
   std::unique_ptr<Expr> m_nestedExpr;
 
@@ -2,15 +2,85 @@
 
 #include "QtSqlLib/DatabaseException.h"
 
+#include <QHash>
+
 #include <algorithm>
 
 namespace QtSqlLib
 {
 
+static bool isIntegerType(int type)
+{
+  return type == QMetaType::Int || type == QMetaType::UInt ||
+    type == QMetaType::LongLong || type == QMetaType::ULongLong;
+}
+
+static QVariant integerToVariant(int type, int64_t value)
+{
+  switch (type)
+  {
+  case QMetaType::Int:
+    return QVariant(static_cast<int>(value));
+  case QMetaType::UInt:
+    return QVariant(static_cast<uint>(value));
+  case QMetaType::LongLong:
+    return QVariant(static_cast<qlonglong>(value));
+  case QMetaType::ULongLong:
+    return QVariant(static_cast<qulonglong>(value));
+  default:
+    break;
+  }
+
+  throw DatabaseException(DatabaseException::Type::UnexpectedError, "Unexpected inline primary key type.");
+}
+
+static uint64_t combineHash(uint64_t seed, uint64_t value)
+{
+  // splitmix64 finalizer
+  value += 0x9E3779B97F4A7C15ULL + (seed << 6) + (seed >> 2);
+  value = (value ^ (value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  value = (value ^ (value >> 27)) * 0x94D049BB133111EBULL;
+  return seed ^ (value ^ (value >> 31));
+}
+
+static uint64_t hashVariant(const QVariant& value)
+{
+  if (value.isNull())
+  {
+    return 0ULL;
+  }
+
+  const auto type = value.userType();
+  if (isIntegerType(type))
+  {
+    return static_cast<uint64_t>(value.toLongLong());
+  }
+
+  switch (type)
+  {
+  case QMetaType::QString:
+    return static_cast<uint64_t>(qHash(value.toString()));
+  case QMetaType::QByteArray:
+    return static_cast<uint64_t>(qHash(value.toByteArray()));
+  case QMetaType::Float:
+  case QMetaType::Double:
+    return static_cast<uint64_t>(std::hash<double>()(value.toDouble()));
+  default:
+    break;
+  }
+
+  return 0ULL;
+}
+
 static bool qVariantsLess(const QVariant& lhs, const QVariant& rhs)
 {
   if (lhs.userType() != rhs.userType())
   {
+    if (isIntegerType(lhs.userType()) && isIntegerType(rhs.userType()))
+    {
+      return lhs.toLongLong() < rhs.toLongLong();
+    }
+
     throw DatabaseException(DatabaseException::Type::UnexpectedError, "Cannot compare tuple values of different types.");
   }
 
@@ -39,16 +109,50 @@ static bool qVariantsLess(const QVariant& lhs, const QVariant& rhs)
   throw DatabaseException(DatabaseException::Type::UnexpectedError, "Tuple types not comparable.");
 }
 
+static bool qVariantsEqual(const QVariant& lhs, const QVariant& rhs)
+{
+  if (lhs.isNull() || rhs.isNull())
+  {
+    return lhs.isNull() && rhs.isNull();
+  }
+
+  if (isIntegerType(lhs.userType()) && isIntegerType(rhs.userType()))
+  {
+    return lhs.toLongLong() == rhs.toLongLong();
+  }
+
+  return lhs.userType() == rhs.userType() && lhs == rhs;
+}
+
 PrimaryKey::PrimaryKey(
     API::IID::Type tableId,
     std::vector<ColumnValue>&& values) :
-  m_tableId(tableId),
-  m_values(std::move(values))
+  PrimaryKey(tableId)
 {
+  if (values.size() > sc_maxInlineValues)
+  {
+    m_values = std::move(values);
+  }
+  else
+  {
+    for (auto& value : values)
+    {
+      appendValue(std::move(value));
+    }
+  }
+  updateHash();
 }
 
 PrimaryKey::PrimaryKey() :
-  m_tableId(-1)
+  PrimaryKey(-1)
+{
+  updateHash();
+}
+
+PrimaryKey::PrimaryKey(API::IID::Type tableId) :
+  m_tableId(tableId),
+  m_hash(0ULL),
+  m_numInlineValues(0)
 {
 }
 
@@ -59,13 +163,100 @@ API::IID::Type PrimaryKey::tableId() const
   return m_tableId;
 }
 
-const std::vector<PrimaryKey::ColumnValue>& PrimaryKey::values() const
+std::vector<PrimaryKey::ColumnValue> PrimaryKey::values() const
+{
+  if (!isInline())
+  {
+    return m_values;
+  }
+
+  std::vector<ColumnValue> values(m_numInlineValues);
+  for (size_t i=0; i<m_numInlineValues; ++i)
+  {
+    values[i] = columnValueAt(i);
+  }
+  return values;
+}
+
+size_t PrimaryKey::numValues() const
 {
-  return m_values;
+  return isInline() ? m_numInlineValues : m_values.size();
+}
+
+uint64_t PrimaryKey::hash() const
+{
+  return m_hash;
+}
+
+bool PrimaryKey::isInline() const
+{
+  return m_values.empty();
+}
+
+PrimaryKey::ColumnValue PrimaryKey::columnValueAt(size_t index) const
+{
+  if (!isInline())
+  {
+    return m_values.at(index);
+  }
+
+  const auto& inlineValue = m_inlineValues.at(index);
+  return { inlineValue.columnId, integerToVariant(inlineValue.type, inlineValue.value) };
+}
+
+void PrimaryKey::appendValue(ColumnValue&& value)
+{
+  const auto type = value.value.userType();
+  if (isInline() && m_numInlineValues < sc_maxInlineValues && !value.value.isNull() && isIntegerType(type))
+  {
+    auto& inlineValue = m_inlineValues[m_numInlineValues++];
+    inlineValue.columnId = value.columnId;
+    inlineValue.type = type;
+    inlineValue.value = value.value.toLongLong();
+    return;
+  }
+
+  if (isInline())
+  {
+    m_values.reserve(m_numInlineValues + 1);
+    for (size_t i=0; i<m_numInlineValues; ++i)
+    {
+      m_values.emplace_back(columnValueAt(i));
+    }
+    m_numInlineValues = 0;
+  }
+
+  m_values.emplace_back(std::move(value));
+}
+
+void PrimaryKey::updateHash()
+{
+  m_hash = combineHash(0ULL, static_cast<uint64_t>(m_tableId));
+  if (isInline())
+  {
+    for (size_t i=0; i<m_numInlineValues; ++i)
+    {
+      m_hash = combineHash(m_hash, static_cast<uint64_t>(m_inlineValues[i].columnId));
+      m_hash = combineHash(m_hash, static_cast<uint64_t>(m_inlineValues[i].value));
+    }
+    return;
+  }
+
+  for (const auto& value : m_values)
+  {
+    m_hash = combineHash(m_hash, static_cast<uint64_t>(value.columnId));
+    m_hash = combineHash(m_hash, hashVariant(value.value));
+  }
 }
 
 bool PrimaryKey::hasValueIntern(const API::IID& columnId) const
 {
+  if (isInline())
+  {
+    return std::any_of(m_inlineValues.cbegin(), m_inlineValues.cbegin() + m_numInlineValues,
+      [&columnId](const InlineValue& value){ return value.columnId == columnId.get(); });
+  }
+
   return std::any_of(m_values.cbegin(), m_values.cend(), [&columnId](const ColumnValue& value){
     return value.columnId == columnId.get();
   });
@@ -73,6 +264,13 @@ bool PrimaryKey::hasValueIntern(const API::IID& columnId) const
 
 QVariant PrimaryKey::valueIntern(const API::IID& columnId) const
 {
+  if (isInline())
+  {
+    const auto it = std::find_if(m_inlineValues.cbegin(), m_inlineValues.cbegin() + m_numInlineValues,
+      [&columnId](const InlineValue& value){ return value.columnId == columnId.get(); });
+    return it != m_inlineValues.cbegin() + m_numInlineValues ? integerToVariant(it->type, it->value) : QVariant();
+  }
+
   const auto it = std::find_if(m_values.cbegin(), m_values.cend(), [&columnId](const ColumnValue& value){
     return value.columnId == columnId.get();
   });
@@ -81,6 +279,12 @@ QVariant PrimaryKey::valueIntern(const API::IID& columnId) const
 
 bool PrimaryKey::isNull() const
 {
+  if (isInline())
+  {
+    // inline values are never null
+    return m_numInlineValues == 0;
+  }
+
   return std::none_of(m_values.cbegin(), m_values.cend(), [](const ColumnValue& value){
     return !value.value.isNull();
   });
@@ -88,26 +292,54 @@ bool PrimaryKey::isNull() const
 
 bool PrimaryKey::operator<(const PrimaryKey& rhs) const
 {
-  if (m_values.size() != rhs.m_values.size())
+  const auto size = numValues();
+  if (size != rhs.numValues())
   {
     throw DatabaseException(DatabaseException::Type::UnexpectedError,
       "Cannot compare primary keys due to incompatibility.");
   }
 
-  if (m_tableId < rhs.m_tableId)
+  if (m_tableId != rhs.m_tableId)
   {
-    return true;
+    return m_tableId < rhs.m_tableId;
   }
-  return std::lexicographical_compare(
-    m_values.cbegin(), m_values.cend(), rhs.m_values.cbegin(), rhs.m_values.cend(), [](const ColumnValue& lhs, const ColumnValue& rhs)
+
+  for (size_t i=0; i<size; ++i)
   {
-    if (lhs.columnId != rhs.columnId)
+    if (isInline() && rhs.isInline())
+    {
+      const auto& lhsValue = m_inlineValues[i];
+      const auto& rhsValue = rhs.m_inlineValues[i];
+      if (lhsValue.columnId != rhsValue.columnId)
+      {
+        throw DatabaseException(DatabaseException::Type::UnexpectedError,
+          "Cannot compare primary keys due to incompatibility.");
+      }
+      if (lhsValue.value != rhsValue.value)
+      {
+        return lhsValue.value < rhsValue.value;
+      }
+      continue;
+    }
+
+    const auto lhsValue = columnValueAt(i);
+    const auto rhsValue = rhs.columnValueAt(i);
+    if (lhsValue.columnId != rhsValue.columnId)
     {
       throw DatabaseException(DatabaseException::Type::UnexpectedError,
         "Cannot compare primary keys due to incompatibility.");
     }
-    return qVariantsLess(lhs.value, rhs.value);
-  });
+    if (qVariantsLess(lhsValue.value, rhsValue.value))
+    {
+      return true;
+    }
+    if (qVariantsLess(rhsValue.value, lhsValue.value))
+    {
+      return false;
+    }
+  }
+
+  return false;
 }
 
 bool PrimaryKey::operator>(const PrimaryKey& rhs) const
@@ -117,22 +349,50 @@ bool PrimaryKey::operator>(const PrimaryKey& rhs) const
 
 bool PrimaryKey::operator<=(const PrimaryKey& rhs) const
 {
-  return (*this < rhs) || (*this == rhs);
+  return !(rhs < *this);
 }
 
 bool PrimaryKey::operator>=(const PrimaryKey& rhs) const
 {
-  return (*this > rhs) || (*this == rhs);
+  return !(*this < rhs);
 }
 
 bool PrimaryKey::operator==(const PrimaryKey& rhs) const
 {
-  return !(*this != rhs);
+  const auto size = numValues();
+  if (m_hash != rhs.m_hash || m_tableId != rhs.m_tableId || size != rhs.numValues())
+  {
+    return false;
+  }
+
+  if (isInline() && rhs.isInline())
+  {
+    for (size_t i=0; i<size; ++i)
+    {
+      if (m_inlineValues[i].columnId != rhs.m_inlineValues[i].columnId ||
+        m_inlineValues[i].value != rhs.m_inlineValues[i].value)
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  for (size_t i=0; i<size; ++i)
+  {
+    const auto lhsValue = columnValueAt(i);
+    const auto rhsValue = rhs.columnValueAt(i);
+    if (lhsValue.columnId != rhsValue.columnId || !qVariantsEqual(lhsValue.value, rhsValue.value))
+    {
+      return false;
+    }
+  }
+  return true;
 }
 
 bool PrimaryKey::operator!=(const PrimaryKey& rhs) const
 {
-  return (*this < rhs) || (rhs < *this);
+  return !(*this == rhs);
 }
 
-}
\ No newline at end of file
+}
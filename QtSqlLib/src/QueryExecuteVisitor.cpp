@@ -3,6 +3,9 @@
 #include "QtSqlLib/API/IQuerySequence.h"
 #include "QtSqlLib/API/IQuery.h"
 #include "QtSqlLib/DatabaseException.h"
+#include "QtSqlLib/StatementCache.h"
+
+#include "QueryPlanDiagnostics.h"
 
 #include <QSqlQuery>
 #include <QSqlError>
@@ -10,9 +13,35 @@
 namespace QtSqlLib
 {
 
-QueryExecuteVisitor::QueryExecuteVisitor(const QSqlDatabase& sqlDb, API::ISchema& schema) :
+using Clock = std::chrono::steady_clock;
+
+static std::chrono::nanoseconds takeDuration(Clock::time_point& startTime)
+{
+  const auto now = Clock::now();
+  const auto duration = std::chrono::duration_cast<std::chrono::nanoseconds>(now - startTime);
+  startTime = now;
+  return duration;
+}
+
+static QVariantList getBoundValues(const QSqlQuery& query)
+{
+  QVariantList values;
+  const auto numBoundValues = static_cast<int>(query.boundValues().size());
+  for (auto i=0; i<numBoundValues; ++i)
+  {
+    values.append(query.boundValue(i));
+  }
+  return values;
+}
+
+QueryExecuteVisitor::QueryExecuteVisitor(
+  const QSqlDatabase& sqlDb, API::ISchema& schema,
+  std::shared_ptr<const API::QueryObservers> observers,
+  QueryPlanDiagnostics* queryPlanDiagnostics) :
   m_sqlDb(sqlDb),
-  m_schema(schema)
+  m_schema(schema),
+  m_observers(std::move(observers)),
+  m_queryPlanDiagnostics(queryPlanDiagnostics)
 {
 }
 
@@ -20,20 +49,66 @@ QueryExecuteVisitor::~QueryExecuteVisitor() = default;
 
 void QueryExecuteVisitor::visit(API::IQuery& query)
 {
+  const auto isObserved = (m_observers != nullptr);
+  auto startTime = isObserved ? Clock::now() : Clock::time_point();
+  API::IQueryObserver::QueryExecution execution;
+
   auto q = query.getSqlQuery(m_sqlDb, m_schema, m_lastResults);
   const auto isBatch = (q.mode == API::IQuery::QueryMode::Batch);
 
+  if (m_queryPlanDiagnostics)
+  {
+    m_queryPlanDiagnostics->analyze(m_sqlDb, m_schema, q.qtQuery);
+  }
+
+  if (isObserved)
+  {
+    execution.prepareDuration = takeDuration(startTime);
+    execution.sqlQuery = q.qtQuery.lastQuery();
+    execution.boundValues = getBoundValues(q.qtQuery);
+    execution.isBatch = isBatch;
+  }
+
   if ((!isBatch && !q.qtQuery.exec()) || (isBatch && !q.qtQuery.execBatch()))
   {
+    const auto errorText = q.qtQuery.lastError().text();
+    if (isObserved)
+    {
+      execution.execDuration = takeDuration(startTime);
+      execution.errorText = errorText;
+      notifyQueryExecuted(execution);
+    }
+
     throw DatabaseException(DatabaseException::Type::QueryError,
-      QString("Could not execute query: %1").arg(q.qtQuery.lastError().text()));
+      QString("Could not execute query: %1").arg(errorText));
+  }
+
+  if (isObserved)
+  {
+    execution.execDuration = takeDuration(startTime);
+    execution.numRowsAffected = q.qtQuery.isSelect() ? -1 : q.qtQuery.numRowsAffected();
   }
 
   auto results = query.getQueryResults(m_schema, std::move(q.qtQuery));
+
+  if (isObserved)
+  {
+    execution.resultsDuration = takeDuration(startTime);
+    if (results.isValid())
+    {
+      results.observe(m_observers, execution.sqlQuery);
+    }
+    notifyQueryExecuted(execution);
+  }
+
   if (results.isValid())
   {
     m_lastResults = std::move(results);
   }
+  else
+  {
+    StatementCache::release(q.qtQuery);
+  }
 }
 
 void QueryExecuteVisitor::visit(API::IQuerySequence& query)
@@ -46,4 +121,12 @@ ResultSet QueryExecuteVisitor::takeLastQueryResults()
   return std::move(m_lastResults);
 }
 
+void QueryExecuteVisitor::notifyQueryExecuted(const API::IQueryObserver::QueryExecution& execution) const
+{
+  for (const auto& observer : *m_observers)
+  {
+    observer->onQueryExecuted(execution);
+  }
+}
+
 }
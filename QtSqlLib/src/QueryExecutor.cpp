@@ -0,0 +1,65 @@
+#include "QueryExecutor.h"
+
+namespace QtSqlLib
+{
+
+QueryExecutor::QueryExecutor(int numThreads) :
+  m_bIsStopping(false)
+{
+  for (auto i = 0; i < numThreads; i++)
+  {
+    m_threads.emplace_back(&QueryExecutor::run, this);
+  }
+}
+
+QueryExecutor::~QueryExecutor()
+{
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_bIsStopping = true;
+  }
+  m_taskAvailable.notify_all();
+
+  for (auto& thread : m_threads)
+  {
+    thread.join();
+  }
+}
+
+int QueryExecutor::getNumThreads() const
+{
+  return static_cast<int>(m_threads.size());
+}
+
+void QueryExecutor::enqueue(Task task)
+{
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_tasks.emplace_back(std::move(task));
+  }
+  m_taskAvailable.notify_one();
+}
+
+void QueryExecutor::run()
+{
+  while (true)
+  {
+    Task task;
+    {
+      std::unique_lock<std::mutex> lock(m_mutex);
+      m_taskAvailable.wait(lock, [this]() { return m_bIsStopping || !m_tasks.empty(); });
+
+      if (m_tasks.empty())
+      {
+        return;
+      }
+
+      task = std::move(m_tasks.front());
+      m_tasks.pop_front();
+    }
+
+    task();
+  }
+}
+
+}
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace QtSqlLib
+{
+
+class QueryExecutor
+{
+public:
+  using Task = std::function<void()>;
+
+  explicit QueryExecutor(int numThreads);
+  ~QueryExecutor();
+
+  QueryExecutor(const QueryExecutor& rhs) = delete;
+  QueryExecutor& operator=(const QueryExecutor& rhs) = delete;
+
+  int getNumThreads() const;
+
+  void enqueue(Task task);
+
+private:
+  std::mutex m_mutex;
+  std::condition_variable m_taskAvailable;
+  std::deque<Task> m_tasks;
+  std::vector<std::thread> m_threads;
+  bool m_bIsStopping;
+
+  void run();
+
+};
+
+}
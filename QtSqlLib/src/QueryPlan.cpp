@@ -0,0 +1,48 @@
+#include "QtSqlLib/QueryPlan.h"
+
+#include <functional>
+
+namespace QtSqlLib
+{
+
+static void collectNodes(
+  const std::vector<QueryPlan::Node>& nodes,
+  const std::function<bool(const QueryPlan::Node&)>& predicate,
+  std::vector<QueryPlan::Node>& nodesOut)
+{
+  for (const auto& node : nodes)
+  {
+    if (predicate(node))
+    {
+      nodesOut.emplace_back(node);
+    }
+    collectNodes(node.children, predicate, nodesOut);
+  }
+}
+
+std::vector<QueryPlan::Node> QueryPlan::findNodes(NodeType type) const
+{
+  std::vector<Node> result;
+  collectNodes(nodes, [type](const Node& node) { return node.type == type; }, result);
+  return result;
+}
+
+std::vector<QueryPlan::Node> QueryPlan::findFullTableScans() const
+{
+  std::vector<Node> result;
+  collectNodes(nodes, [](const Node& node)
+  {
+    return node.type == NodeType::Scan && node.tableId.has_value() && node.indexName.isEmpty() &&
+      !node.bIsAutomaticIndex;
+  }, result);
+  return result;
+}
+
+std::vector<QueryPlan::Node> QueryPlan::findAutomaticIndices() const
+{
+  std::vector<Node> result;
+  collectNodes(nodes, [](const Node& node) { return node.bIsAutomaticIndex; }, result);
+  return result;
+}
+
+}
@@ -0,0 +1,426 @@
+#include "QueryPlanDiagnostics.h"
+
+#include "QtSqlLib/API/ISchema.h"
+#include "QtSqlLib/DatabaseException.h"
+
+#include <QSqlError>
+#include <QStringList>
+
+#include <algorithm>
+#include <map>
+
+namespace QtSqlLib
+{
+
+using TableIdentifierMap = std::map<QString, API::IID::Type>;
+
+static const QString s_quote = "'";
+
+struct QuerySegment
+{
+  int begin = -1;
+  int end = -1;
+};
+
+static bool findQuotedIdentifier(const QString& sqlQuery, int from, int& beginOut, int& endOut, QString& identifierOut)
+{
+  const auto begin = sqlQuery.indexOf(s_quote, from);
+  if (begin < 0)
+  {
+    return false;
+  }
+
+  const auto end = sqlQuery.indexOf(s_quote, begin + 1);
+  if (end < 0)
+  {
+    return false;
+  }
+
+  identifierOut = sqlQuery.mid(begin + 1, end - begin - 1);
+  beginOut = begin;
+  endOut = end + 1;
+  return true;
+}
+
+static std::optional<API::IID::Type> findTableIdByName(API::ISchema& schema, const QString& tableName)
+{
+  for (const auto& table : schema.getTables())
+  {
+    if (table.second.name == tableName)
+    {
+      return table.first;
+    }
+  }
+  return std::nullopt;
+}
+
+static std::optional<API::IID::Type> findColumnIdByName(const API::Table& table, const QString& columnName)
+{
+  for (const auto& column : table.columns)
+  {
+    if (column.second.name == columnName)
+    {
+      return column.first;
+    }
+  }
+  return std::nullopt;
+}
+
+static TableIdentifierMap findTableIdentifiers(API::ISchema& schema, const QString& sqlQuery)
+{
+  static const QStringList keywords = { "FROM ", "JOIN ", "UPDATE " };
+  static const QString aliasKeyword = " AS '";
+
+  TableIdentifierMap tableIdentifiers;
+  for (const auto& keyword : keywords)
+  {
+    auto pos = sqlQuery.indexOf(keyword);
+    while (pos >= 0)
+    {
+      int begin = 0;
+      int end = 0;
+      QString tableName;
+      if (findQuotedIdentifier(sqlQuery, pos + keyword.length(), begin, end, tableName) &&
+        begin == pos + keyword.length())
+      {
+        const auto tableId = findTableIdByName(schema, tableName);
+        if (tableId.has_value())
+        {
+          QString alias;
+          if (sqlQuery.mid(end, aliasKeyword.length()) == aliasKeyword &&
+            findQuotedIdentifier(sqlQuery, end + 1, begin, end, alias))
+          {
+            tableIdentifiers[alias] = tableId.value();
+          }
+          else
+          {
+            tableIdentifiers[tableName] = tableId.value();
+          }
+        }
+      }
+
+      pos = sqlQuery.indexOf(keyword, pos + keyword.length());
+    }
+  }
+
+  return tableIdentifiers;
+}
+
+static std::vector<QueryPlan::ColumnReference> findColumnReferences(
+  API::ISchema& schema, const QString& sqlQuery, const QuerySegment& segment,
+  const TableIdentifierMap& tableIdentifiers, const std::optional<QString>& tableIdentifierFilter)
+{
+  std::vector<QueryPlan::ColumnReference> columns;
+  if (segment.begin < 0)
+  {
+    return columns;
+  }
+
+  auto pos = segment.begin;
+  int begin = 0;
+  int end = 0;
+  QString tableIdentifier;
+
+  while (findQuotedIdentifier(sqlQuery, pos, begin, end, tableIdentifier) && end <= segment.end)
+  {
+    pos = end;
+    if (sqlQuery.mid(end, 2) != ".'")
+    {
+      continue;
+    }
+
+    QString columnName;
+    if (!findQuotedIdentifier(sqlQuery, end + 1, begin, end, columnName) || end > segment.end)
+    {
+      break;
+    }
+    pos = end;
+
+    const auto it = tableIdentifiers.find(tableIdentifier);
+    if (it == tableIdentifiers.end() ||
+      (tableIdentifierFilter.has_value() && tableIdentifierFilter.value() != tableIdentifier))
+    {
+      continue;
+    }
+
+    const auto columnId = findColumnIdByName(schema.getTables().at(it->second), columnName);
+    if (!columnId.has_value())
+    {
+      continue;
+    }
+
+    if (std::none_of(columns.cbegin(), columns.cend(), [&it, &columnId](const QueryPlan::ColumnReference& column)
+      {
+        return column.tableId == it->second && column.columnId == columnId.value();
+      }))
+    {
+      columns.emplace_back(QueryPlan::ColumnReference { it->second, columnId.value() });
+    }
+  }
+
+  return columns;
+}
+
+static QuerySegment findSegment(const QString& sqlQuery, const QString& keyword, const QStringList& endKeywords)
+{
+  QuerySegment segment;
+  segment.begin = sqlQuery.indexOf(keyword);
+  if (segment.begin < 0)
+  {
+    return segment;
+  }
+
+  segment.end = sqlQuery.length();
+  for (const auto& endKeyword : endKeywords)
+  {
+    const auto end = sqlQuery.indexOf(endKeyword, segment.begin + keyword.length());
+    if (end >= 0)
+    {
+      segment.end = std::min(segment.end, end);
+    }
+  }
+  return segment;
+}
+
+static void parseScanOrSearchDetail(
+  const QString& detail, QString& tableIdentifierOut, QString& indexNameOut, bool& isAutomaticIndexOut)
+{
+  const auto words = detail.split(" ");
+
+  // SQLite < 3.36: "SCAN TABLE <name> AS <alias>", later versions: "SCAN <alias or name>"
+  auto i = 1;
+  if (words.size() > i && words.at(i) == "TABLE")
+  {
+    i++;
+  }
+  if (words.size() <= i)
+  {
+    return;
+  }
+
+  tableIdentifierOut = words.at(i);
+  if (words.size() > i + 2 && words.at(i + 1) == "AS")
+  {
+    tableIdentifierOut = words.at(i + 2);
+  }
+
+  for (auto j = i + 1; j < words.size(); ++j)
+  {
+    if (words.at(j) == "AUTOMATIC")
+    {
+      isAutomaticIndexOut = true;
+      return;
+    }
+    if (words.at(j) == "INDEX" && j + 1 < words.size())
+    {
+      indexNameOut = words.at(j + 1);
+      return;
+    }
+    if (words.at(j) == "PRIMARY")
+    {
+      indexNameOut = "PRIMARY KEY";
+      return;
+    }
+  }
+}
+
+static QueryPlan::Node createNode(
+  API::ISchema& schema, const QString& sqlQuery, const TableIdentifierMap& tableIdentifiers,
+  int id, const QString& detail)
+{
+  QueryPlan::Node node;
+  node.id = id;
+  node.detail = detail;
+
+  if (detail.startsWith("SCAN") || detail.startsWith("SEARCH"))
+  {
+    node.type = detail.startsWith("SCAN") ? QueryPlan::NodeType::Scan : QueryPlan::NodeType::Search;
+
+    QString tableIdentifier;
+    parseScanOrSearchDetail(detail, tableIdentifier, node.indexName, node.bIsAutomaticIndex);
+
+    const auto it = tableIdentifiers.find(tableIdentifier);
+    if (it != tableIdentifiers.end())
+    {
+      // columns of the scanned table used in join and where constraints
+      auto segment = findSegment(sqlQuery, " FROM ", { " GROUP BY ", " ORDER BY " });
+      if (segment.begin < 0)
+      {
+        segment = findSegment(sqlQuery, " WHERE ", {});
+      }
+
+      node.tableId = it->second;
+      node.columns = findColumnReferences(schema, sqlQuery, segment, tableIdentifiers, tableIdentifier);
+    }
+  }
+  else if (detail.startsWith("USE TEMP B-TREE"))
+  {
+    node.type = QueryPlan::NodeType::TempBTree;
+
+    QuerySegment segment;
+    if (detail.contains("ORDER BY"))
+    {
+      segment = findSegment(sqlQuery, " ORDER BY ", {});
+    }
+    else if (detail.contains("GROUP BY"))
+    {
+      segment = findSegment(sqlQuery, " GROUP BY ", { " HAVING ", " ORDER BY " });
+    }
+    else if (detail.contains("DISTINCT"))
+    {
+      segment = findSegment(sqlQuery, "SELECT ", { " FROM " });
+    }
+
+    node.columns = findColumnReferences(schema, sqlQuery, segment, tableIdentifiers, std::nullopt);
+    if (!node.columns.empty() &&
+      std::all_of(node.columns.cbegin(), node.columns.cend(), [&node](const QueryPlan::ColumnReference& column)
+      {
+        return column.tableId == node.columns.front().tableId;
+      }))
+    {
+      node.tableId = node.columns.front().tableId;
+    }
+  }
+
+  return node;
+}
+
+static std::vector<QueryPlan::Node> buildNodeTree(
+  std::vector<std::pair<int, QueryPlan::Node>>& parentNodes, int parentId)
+{
+  std::vector<QueryPlan::Node> nodes;
+  for (auto& parentNode : parentNodes)
+  {
+    if (parentNode.first == parentId)
+    {
+      nodes.emplace_back(std::move(parentNode.second));
+    }
+  }
+
+  for (auto& node : nodes)
+  {
+    node.children = buildNodeTree(parentNodes, node.id);
+  }
+
+  return nodes;
+}
+
+QueryPlanDiagnostics::QueryPlanDiagnostics() :
+  m_bIsEnabled(false)
+{
+}
+
+QueryPlanDiagnostics::~QueryPlanDiagnostics() = default;
+
+void QueryPlanDiagnostics::setEnabled(bool enabled)
+{
+  m_bIsEnabled = enabled;
+}
+
+bool QueryPlanDiagnostics::isEnabled() const
+{
+  return m_bIsEnabled;
+}
+
+void QueryPlanDiagnostics::analyze(const QSqlDatabase& db, API::ISchema& schema, const QSqlQuery& query)
+{
+  const auto sqlQuery = query.lastQuery();
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_analyzedQueries.count(sqlQuery) > 0)
+    {
+      return;
+    }
+  }
+
+  QVariantList boundValues;
+  const auto numBoundValues = static_cast<int>(query.boundValues().size());
+  for (auto i=0; i<numBoundValues; ++i)
+  {
+    // batch queries bind lists of values, the first one is representative for the plan
+    const auto value = query.boundValue(i);
+    if (value.userType() == QMetaType::QVariantList)
+    {
+      const auto values = value.toList();
+      boundValues.append(values.isEmpty() ? QVariant() : values.first());
+    }
+    else
+    {
+      boundValues.append(value);
+    }
+  }
+
+  // diagnostics must not fail the analyzed query, queries that cannot be explained are analyzed again next time
+  QueryPlan queryPlan;
+  try
+  {
+    queryPlan = explain(db, schema, sqlQuery, boundValues);
+  }
+  catch (const DatabaseException&)
+  {
+    return;
+  }
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+  if (!m_analyzedQueries.insert(sqlQuery).second || queryPlan.nodes.empty())
+  {
+    return;
+  }
+  m_queryPlans.emplace_back(std::move(queryPlan));
+}
+
+std::vector<QueryPlan> QueryPlanDiagnostics::getQueryPlans() const
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_queryPlans;
+}
+
+void QueryPlanDiagnostics::clear()
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_analyzedQueries.clear();
+  m_queryPlans.clear();
+}
+
+QueryPlan QueryPlanDiagnostics::explain(
+  const QSqlDatabase& db, API::ISchema& schema,
+  const QString& sqlQuery, const QVariantList& boundValues)
+{
+  QSqlQuery explainQuery(db);
+  if (!explainQuery.prepare(QString("EXPLAIN QUERY PLAN %1").arg(sqlQuery)))
+  {
+    throw DatabaseException(DatabaseException::Type::QueryError,
+      QString("Could not prepare query plan: %1").arg(explainQuery.lastError().text()));
+  }
+
+  for (const auto& value : boundValues)
+  {
+    explainQuery.addBindValue(value);
+  }
+
+  if (!explainQuery.exec())
+  {
+    throw DatabaseException(DatabaseException::Type::QueryError,
+      QString("Could not explain query plan: %1").arg(explainQuery.lastError().text()));
+  }
+
+  const auto tableIdentifiers = findTableIdentifiers(schema, sqlQuery);
+
+  std::vector<std::pair<int, QueryPlan::Node>> parentNodes;
+  while (explainQuery.next())
+  {
+    const auto id = explainQuery.value(0).toInt();
+    const auto parentId = explainQuery.value(1).toInt();
+    const auto detail = explainQuery.value(3).toString();
+
+    parentNodes.emplace_back(parentId, createNode(schema, sqlQuery, tableIdentifiers, id, detail));
+  }
+
+  QueryPlan queryPlan;
+  queryPlan.sqlQuery = sqlQuery;
+  queryPlan.nodes = buildNodeTree(parentNodes, 0);
+
+  return queryPlan;
+}
+
+}
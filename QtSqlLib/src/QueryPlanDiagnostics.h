@@ -0,0 +1,52 @@
+#pragma once
+
+#include <QtSqlLib/QueryPlan.h>
+
+#include <QSqlDatabase>
+#include <QSqlQuery>
+#include <QVariant>
+
+#include <atomic>
+#include <mutex>
+#include <set>
+#include <vector>
+
+namespace QtSqlLib::API
+{
+class ISchema;
+}
+
+namespace QtSqlLib
+{
+
+class QueryPlanDiagnostics
+{
+public:
+  QueryPlanDiagnostics();
+  ~QueryPlanDiagnostics();
+
+  QueryPlanDiagnostics(const QueryPlanDiagnostics& rhs) = delete;
+  QueryPlanDiagnostics& operator=(const QueryPlanDiagnostics& rhs) = delete;
+
+  void setEnabled(bool enabled);
+  bool isEnabled() const;
+
+  void analyze(const QSqlDatabase& db, API::ISchema& schema, const QSqlQuery& query);
+
+  std::vector<QueryPlan> getQueryPlans() const;
+  void clear();
+
+  static QueryPlan explain(
+    const QSqlDatabase& db, API::ISchema& schema,
+    const QString& sqlQuery, const QVariantList& boundValues);
+
+private:
+  std::atomic<bool> m_bIsEnabled;
+
+  mutable std::mutex m_mutex;
+  std::set<QString> m_analyzedQueries;
+  std::vector<QueryPlan> m_queryPlans;
+
+};
+
+}
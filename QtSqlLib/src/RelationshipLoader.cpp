@@ -0,0 +1,196 @@
+#include "QtSqlLib/RelationshipLoader.h"
+
+#include "QtSqlLib/API/IDatabase.h"
+#include "QtSqlLib/DatabaseException.h"
+#include "QtSqlLib/Expr.h"
+#include "QtSqlLib/ID.h"
+#include "QtSqlLib/Query/FromTable.h"
+#include "QtSqlLib/TupleArena.h"
+
+#include "SqliteLimits.h"
+
+#include <algorithm>
+
+namespace QtSqlLib
+{
+
+RelationshipLoader::RelationshipLoader(API::IDatabase& database, const API::IID& relationshipId) :
+  RelationshipLoader(database, relationshipId, {})
+{
+}
+
+RelationshipLoader::RelationshipLoader(
+    API::IDatabase& database,
+    const API::IID& relationshipId,
+    const ColumnHelper::SelectColumnList& columns) :
+  m_database(database),
+  m_relationshipId(relationshipId.get()),
+  m_columns(columns),
+  m_arena(std::make_shared<TupleArena>())
+{
+}
+
+RelationshipLoader::~RelationshipLoader() = default;
+
+void RelationshipLoader::request(const PrimaryKey& tupleKey)
+{
+  if (tupleKey.isNull())
+  {
+    throw DatabaseException(DatabaseException::Type::InvalidId, "Cannot load related tuples of a null key.");
+  }
+
+  if (m_tableId && m_tableId.value() != tupleKey.tableId())
+  {
+    throw DatabaseException(DatabaseException::Type::InvalidId,
+      QString("Keys of table with id %1 and %2 cannot be loaded by the same loader.")
+      .arg(m_tableId.value())
+      .arg(tupleKey.tableId()));
+  }
+
+  m_tableId = tupleKey.tableId();
+  if (m_relatedTuples.count(tupleKey) > 0 || !m_pendingKeySet.insert(tupleKey).second)
+  {
+    return;
+  }
+
+  m_pendingKeys.emplace_back(tupleKey);
+}
+
+size_t RelationshipLoader::numPendingKeys() const
+{
+  return m_pendingKeys.size();
+}
+
+void RelationshipLoader::load()
+{
+  if (m_pendingKeys.empty())
+  {
+    return;
+  }
+
+  const auto numKeyColumns = m_pendingKeys.front().numValues();
+  const auto maxKeysPerQuery = std::max<size_t>(1, static_cast<size_t>(s_maxBoundValuesPerQuery) / numKeyColumns);
+
+  try
+  {
+    for (size_t i=0; i<m_pendingKeys.size(); i += maxKeysPerQuery)
+    {
+      const auto begin = m_pendingKeys.cbegin() + i;
+      loadBatch(begin, begin + std::min(maxKeysPerQuery, m_pendingKeys.size() - i));
+    }
+  }
+  catch (const DatabaseException&)
+  {
+    // the keys of the failed batches stay pending
+    m_pendingKeys.erase(std::remove_if(m_pendingKeys.begin(), m_pendingKeys.end(),
+      [this](const PrimaryKey& tupleKey) { return isLoaded(tupleKey); }), m_pendingKeys.end());
+    m_pendingKeySet = std::unordered_set<PrimaryKey>(m_pendingKeys.cbegin(), m_pendingKeys.cend());
+    throw;
+  }
+
+  m_pendingKeys.clear();
+  m_pendingKeySet.clear();
+}
+
+bool RelationshipLoader::isLoaded(const PrimaryKey& tupleKey) const
+{
+  return m_relatedTuples.count(tupleKey) > 0;
+}
+
+const std::vector<Tuple>& RelationshipLoader::relatedTuples(const PrimaryKey& tupleKey)
+{
+  // loads all pending keys together with the requested one
+  if (!isLoaded(tupleKey))
+  {
+    request(tupleKey);
+    load();
+  }
+
+  return m_relatedTuples.at(tupleKey);
+}
+
+void RelationshipLoader::clear()
+{
+  m_tableId.reset();
+  m_pendingKeys.clear();
+  m_pendingKeySet.clear();
+  m_relatedTuples.clear();
+  m_arena = std::make_shared<TupleArena>();
+}
+
+void RelationshipLoader::loadBatch(
+  std::vector<PrimaryKey>::const_iterator begin, std::vector<PrimaryKey>::const_iterator end)
+{
+  const auto keyColumns = begin->values();
+
+  Expr whereExpr;
+  if (keyColumns.size() == 1)
+  {
+    QVariantList values;
+    for (auto it = begin; it != end; ++it)
+    {
+      values.append(it->values().front().value);
+    }
+    whereExpr.opIn(ColumnHelper::ColumnData(keyColumns.front().columnId), QVariant(values));
+  }
+  else
+  {
+    for (auto it = begin; it != end; ++it)
+    {
+      if (it != begin)
+      {
+        whereExpr.opOr();
+      }
+
+      Expr keyExpr;
+      for (const auto& columnValue : it->values())
+      {
+        if (!keyExpr.isEmpty())
+        {
+          keyExpr.opAnd();
+        }
+        keyExpr.equal(ColumnHelper::ColumnData(columnValue.columnId), columnValue.value);
+      }
+      whereExpr.braces(keyExpr);
+    }
+  }
+
+  ColumnHelper::SelectColumnList keySelection;
+  for (const auto& keyColumn : keyColumns)
+  {
+    keySelection.emplace_back(keyColumn.columnId);
+  }
+
+  Query::FromTable query(ID(m_tableId.value()));
+  query.select(keySelection).where(whereExpr);
+
+  if (m_columns.empty())
+  {
+    query.joinAll(ID(m_relationshipId));
+  }
+  else
+  {
+    query.join(ID(m_relationshipId), m_columns);
+  }
+
+  // the keys only count as loaded once the query succeeded, so that a failed batch is loaded again on request
+  std::unordered_map<PrimaryKey, std::vector<Tuple>> loadedTuples;
+  for (auto it = begin; it != end; ++it)
+  {
+    loadedTuples[*it];
+  }
+
+  auto results = m_database.execQuery(query);
+  while (results.hasNextTuple())
+  {
+    auto& relatedTuples = loadedTuples[results.nextTuple().primaryKey()];
+    while (results.hasNextJoinedTuple())
+    {
+      relatedTuples.emplace_back(results.nextJoinedTuple().detach(m_arena));
+    }
+  }
+
+  m_relatedTuples.merge(loadedTuples);
+}
+
+}
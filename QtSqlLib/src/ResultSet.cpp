@@ -1,6 +1,10 @@
 #include "QtSqlLib/ResultSet.h"
 
 #include "QtSqlLib/DatabaseException.h"
+#include "QtSqlLib/StatementCache.h"
+
+#include "ColumnIdIndices.h"
+#include "JoinParentRows.h"
 
 namespace QtSqlLib
 {
@@ -8,48 +12,88 @@ namespace QtSqlLib
 ResultSet::ResultSet(
     QSqlQuery&& query,
     API::QueryMetaInfo&& queryMetaInfo,
-    std::vector<API::QueryMetaInfo>&& joinMetaInfo) :
+    std::vector<API::QueryMetaInfo>&& joinMetaInfo,
+    bool isForwardOnly) :
   m_sqlQuery(std::move(query)),
   m_queryMetaInfo(std::move(queryMetaInfo)),
   m_joinMetaInfo(std::move(joinMetaInfo)),
   m_isValid(true),
-  m_nextTupleResult({ false, false, std::vector<bool>(m_joinMetaInfo.size(), false) })
+  m_isForwardOnly(isForwardOnly),
+  m_nextTupleResult({ false, false, std::vector<bool>(m_joinMetaInfo.size(), false) }),
+  m_isSplitJoinsIndexed(false)
 {
+  // tuple views fall back to a linear search for sparse ids
+  m_queryMetaInfo.columnIdQueryIndices = ColumnIdIndices::create(m_queryMetaInfo, ColumnIdIndices::IndexType::QueryIndex);
+  for (auto& joinMetaInfo : m_joinMetaInfo)
+  {
+    joinMetaInfo.columnIdQueryIndices = ColumnIdIndices::create(joinMetaInfo, ColumnIdIndices::IndexType::QueryIndex);
+  }
+  createJoinParentIndices();
 }
 
 ResultSet::ResultSet() :
-  m_isValid(false)
+  m_isValid(false),
+  m_isForwardOnly(false),
+  m_isSplitJoinsIndexed(false)
 {
 }
 
 ResultSet::ResultSet(ResultSet&& rhs) :
-  ResultSet(std::move(rhs.m_sqlQuery), std::move(rhs.m_queryMetaInfo), std::move(rhs.m_joinMetaInfo))
+  ResultSet(std::move(rhs.m_sqlQuery), std::move(rhs.m_queryMetaInfo), std::move(rhs.m_joinMetaInfo), rhs.m_isForwardOnly)
 {
-  m_isValid = std::move(rhs.m_isValid);
+  m_isValid = rhs.m_isValid;
   m_nextTupleResult = std::move(rhs.m_nextTupleResult);
+  m_currentTupleKey = std::move(rhs.m_currentTupleKey);
   m_retrievedResultKeys = std::move(rhs.m_retrievedResultKeys);
   m_retrievedJoinResultKeys = std::move(rhs.m_retrievedJoinResultKeys);
+  m_splitJoins = std::move(rhs.m_splitJoins);
+  m_isSplitJoinsIndexed = rhs.m_isSplitJoinsIndexed;
+  m_observation = std::move(rhs.m_observation);
+  m_sharedMetaInfos = std::move(rhs.m_sharedMetaInfos);
+  m_tupleArena = std::move(rhs.m_tupleArena);
+
+  rhs.m_isValid = false;
 }
 
 ResultSet& ResultSet::operator=(ResultSet&& rhs)
 {
+  releaseQuery();
+
   m_sqlQuery = std::move(rhs.m_sqlQuery);
   m_queryMetaInfo = std::move(rhs.m_queryMetaInfo);
   m_joinMetaInfo = std::move(rhs.m_joinMetaInfo);
-  m_isValid = std::move(rhs.m_isValid);
+  m_joinParentIndices = std::move(rhs.m_joinParentIndices);
+  m_isValid = rhs.m_isValid;
+  m_isForwardOnly = rhs.m_isForwardOnly;
   m_nextTupleResult = std::move(rhs.m_nextTupleResult);
+  m_currentTupleKey = std::move(rhs.m_currentTupleKey);
   m_retrievedResultKeys = std::move(rhs.m_retrievedResultKeys);
   m_retrievedJoinResultKeys = std::move(rhs.m_retrievedJoinResultKeys);
+  m_splitJoins = std::move(rhs.m_splitJoins);
+  m_isSplitJoinsIndexed = rhs.m_isSplitJoinsIndexed;
+  m_observation = std::move(rhs.m_observation);
+  m_sharedMetaInfos = std::move(rhs.m_sharedMetaInfos);
+  m_tupleArena = std::move(rhs.m_tupleArena);
+
+  rhs.m_isValid = false;
   return *this;
 }
 
-ResultSet::~ResultSet() = default;
+ResultSet::~ResultSet()
+{
+  releaseQuery();
+}
 
 bool ResultSet::isValid() const
 {
   return m_isValid;
 }
 
+bool ResultSet::isForwardOnly() const
+{
+  return m_isForwardOnly;
+}
+
 void ResultSet::resetIteration()
 {
   if (!m_isValid)
@@ -57,8 +101,20 @@ void ResultSet::resetIteration()
     return;
   }
 
+  if (m_isForwardOnly)
+  {
+    if (isAtBeginning())
+    {
+      return;
+    }
+
+    throw DatabaseException(DatabaseException::Type::UnexpectedError,
+      "Cannot reset the iteration of a forward-only result set.");
+  }
+
   m_sqlQuery.seek(QSql::BeforeFirstRow);
   resetNextTupleResult();
+  m_currentTupleKey.reset();
   m_retrievedResultKeys.clear();
   m_retrievedJoinResultKeys.clear();
 }
@@ -68,6 +124,30 @@ bool ResultSet::isAtBeginning() const
   return m_isValid && m_sqlQuery.at() == QSql::BeforeFirstRow;
 }
 
+void ResultSet::fetchAll()
+{
+  // forward-only results are never cached entirely
+  if (!m_isValid || m_isForwardOnly || !isAtBeginning())
+  {
+    return;
+  }
+
+  const auto startTime = m_observation ? std::chrono::steady_clock::now() : std::chrono::steady_clock::time_point();
+
+  m_sqlQuery.last();
+  m_sqlQuery.seek(QSql::BeforeFirstRow);
+
+  if (!m_splitJoins.empty() && !m_isSplitJoinsIndexed)
+  {
+    indexSplitJoins();
+  }
+
+  if (m_observation)
+  {
+    m_observation->iteration.iterationDuration += std::chrono::steady_clock::now() - startTime;
+  }
+}
+
 bool ResultSet::hasNextTuple()
 {
   searchNextTuple(SearchMode::MAIN_TUPLE);
@@ -89,7 +169,12 @@ TupleView ResultSet::nextTuple()
   }
 
   m_nextTupleResult.hasNext = false;
-  return TupleView(m_sqlQuery, m_queryMetaInfo);
+  if (m_observation)
+  {
+    m_observation->iteration.numTuplesReturned++;
+  }
+
+  return TupleView(m_sqlQuery, m_queryMetaInfo, *this, 0);
 }
 
 TupleView ResultSet::nextJoinedTuple()
@@ -105,6 +190,11 @@ TupleView ResultSet::nextJoinedTuple()
     throw DatabaseException(DatabaseException::Type::UnexpectedError, "No next join tuple found.");
   }
 
+  if (!m_splitJoins.empty())
+  {
+    return nextSplitJoinTuple();
+  }
+
   for (size_t i=0; i<m_joinMetaInfo.size(); ++i)
   {
     if (m_nextTupleResult.nextJoinsMask.at(i))
@@ -113,13 +203,68 @@ TupleView ResultSet::nextJoinedTuple()
       m_nextTupleResult.hasNextJoin = std::any_of(m_nextTupleResult.nextJoinsMask.cbegin()+i+1, m_nextTupleResult.nextJoinsMask.cend(),
         [](bool value) { return value; });
 
-      return TupleView(m_sqlQuery, m_joinMetaInfo.at(i));
+      if (m_observation)
+      {
+        m_observation->iteration.numJoinedTuplesReturned++;
+      }
+
+      return TupleView(m_sqlQuery, m_joinMetaInfo.at(i), *this, i + 1);
     }
   }
 
   throw DatabaseException(DatabaseException::Type::UnexpectedError, "Error due to inconsistent join data.");
 }
 
+size_t ResultSet::nextBlock(RowBlock& block, size_t maxNumTuples)
+{
+  block.reset(sharedMetaInfos());
+
+  JoinParentRows joinParentRows(m_joinParentIndices);
+  while (block.numTuples() < maxNumTuples && hasNextTuple())
+  {
+    joinParentRows.setQueriedRow(block.append(0, std::nullopt, nextTuple()));
+    while (hasNextJoinedTuple())
+    {
+      const auto joinedTuple = nextJoinedTuple();
+      const auto joinIndex = joinedTuple.m_metaInfoIndex - 1;
+
+      const auto row = block.append(joinedTuple.m_metaInfoIndex, joinParentRows.parentRow(joinIndex, joinedTuple),
+        joinedTuple);
+      joinParentRows.addJoinedRow(joinIndex, joinedTuple, row);
+    }
+  }
+
+  return block.numTuples();
+}
+
+ColumnarResult ResultSet::toColumnar()
+{
+  ColumnarResult result(m_queryMetaInfo, m_joinMetaInfo);
+  if (!m_isValid)
+  {
+    return result;
+  }
+
+  resetIteration();
+
+  JoinParentRows joinParentRows(m_joinParentIndices);
+  while (hasNextTuple())
+  {
+    joinParentRows.setQueriedRow(result.appendTuple(nextTuple()));
+    while (hasNextJoinedTuple())
+    {
+      const auto joinedTuple = nextJoinedTuple();
+      const auto joinIndex = joinedTuple.m_metaInfoIndex - 1;
+
+      const auto row = result.appendJoinedTuple(joinIndex, joinedTuple,
+        joinParentRows.parentRow(joinIndex, joinedTuple));
+      joinParentRows.addJoinedRow(joinIndex, joinedTuple, row);
+    }
+  }
+
+  return result;
+}
+
 const API::QueryMetaInfo& ResultSet::queryMetaInfo() const
 {
   return m_queryMetaInfo;
@@ -130,7 +275,154 @@ const std::vector<API::QueryMetaInfo>& ResultSet::joinQueryMetaInfos() const
   return m_joinMetaInfo;
 }
 
+const std::shared_ptr<const std::vector<API::QueryMetaInfo>>& ResultSet::sharedMetaInfos()
+{
+  if (!m_sharedMetaInfos)
+  {
+    auto metaInfos = std::make_shared<std::vector<API::QueryMetaInfo>>();
+    metaInfos->reserve(m_joinMetaInfo.size() + 1);
+    metaInfos->emplace_back(m_queryMetaInfo);
+    metaInfos->insert(metaInfos->end(), m_joinMetaInfo.cbegin(), m_joinMetaInfo.cend());
+    m_sharedMetaInfos = std::move(metaInfos);
+  }
+  return m_sharedMetaInfos;
+}
+
+const std::shared_ptr<TupleArena>& ResultSet::tupleArena()
+{
+  if (!m_tupleArena)
+  {
+    m_tupleArena = std::make_shared<TupleArena>();
+  }
+  return m_tupleArena;
+}
+
+const API::QueryMetaInfo& ResultSet::parentQueryMetaInfo(size_t metaInfoIndex) const
+{
+  const auto joinIndex = metaInfoIndex - 1;
+
+  // the parent keys of split joins are selected by the join queries
+  if (!m_splitJoins.empty())
+  {
+    return m_splitJoins.at(joinIndex).parentKeyMetaInfo;
+  }
+
+  const auto parentIndex = m_joinParentIndices.at(joinIndex);
+  return (parentIndex < 0) ? m_queryMetaInfo : m_joinMetaInfo.at(parentIndex);
+}
+
+void ResultSet::addSplitJoinQuery(QSqlQuery&& query, API::QueryMetaInfo&& parentKeyMetaInfo)
+{
+  SplitJoin splitJoin;
+  splitJoin.sqlQuery = std::move(query);
+  splitJoin.parentKeyMetaInfo = std::move(parentKeyMetaInfo);
+  m_splitJoins.emplace_back(std::move(splitJoin));
+}
+
+void ResultSet::indexSplitJoins()
+{
+  for (size_t i=0; i<m_splitJoins.size(); ++i)
+  {
+    auto& splitJoin = m_splitJoins.at(i);
+    while (splitJoin.sqlQuery.next())
+    {
+      if (m_observation)
+      {
+        m_observation->iteration.numRowsFetched++;
+      }
+
+      const auto parentKey = TupleView(splitJoin.sqlQuery, splitJoin.parentKeyMetaInfo).primaryKey();
+      splitJoin.rowsByParentKey[parentKey].emplace_back(splitJoin.sqlQuery.at());
+    }
+  }
+
+  m_isSplitJoinsIndexed = true;
+}
+
+void ResultSet::selectSplitJoinRows(const PrimaryKey& tupleKey)
+{
+  clearNextJoinsMask();
+  for (size_t i=0; i<m_splitJoins.size(); ++i)
+  {
+    auto& splitJoin = m_splitJoins.at(i);
+    const auto it = splitJoin.rowsByParentKey.find(tupleKey);
+
+    splitJoin.currentRows = (it != splitJoin.rowsByParentKey.cend()) ? &it->second : nullptr;
+    splitJoin.currentRowIndex = 0;
+
+    if (splitJoin.currentRows)
+    {
+      m_nextTupleResult.hasNextJoin = true;
+      m_nextTupleResult.nextJoinsMask[i] = true;
+    }
+  }
+}
+
+TupleView ResultSet::nextSplitJoinTuple()
+{
+  for (size_t i=0; i<m_splitJoins.size(); ++i)
+  {
+    if (!m_nextTupleResult.nextJoinsMask.at(i))
+    {
+      continue;
+    }
+
+    auto& splitJoin = m_splitJoins.at(i);
+    splitJoin.sqlQuery.seek(splitJoin.currentRows->at(splitJoin.currentRowIndex++));
+
+    if (splitJoin.currentRowIndex >= splitJoin.currentRows->size())
+    {
+      m_nextTupleResult.nextJoinsMask[i] = false;
+      m_nextTupleResult.hasNextJoin = std::any_of(m_nextTupleResult.nextJoinsMask.cbegin()+i+1, m_nextTupleResult.nextJoinsMask.cend(),
+        [](bool value) { return value; });
+    }
+
+    if (m_observation)
+    {
+      m_observation->iteration.numJoinedTuplesReturned++;
+    }
+
+    return TupleView(splitJoin.sqlQuery, m_joinMetaInfo.at(i), *this, i + 1);
+  }
+
+  throw DatabaseException(DatabaseException::Type::UnexpectedError, "Error due to inconsistent join data.");
+}
+
+void ResultSet::observe(std::shared_ptr<const API::QueryObservers> observers, const QString& sqlQuery)
+{
+  m_observation = std::make_unique<Observation>();
+  m_observation->observers = std::move(observers);
+  m_observation->iteration.sqlQuery = sqlQuery;
+}
+
+void ResultSet::notifyIterationFinished()
+{
+  if (!m_observation)
+  {
+    return;
+  }
+
+  for (const auto& observer : *m_observation->observers)
+  {
+    observer->onResultIterationFinished(m_observation->iteration);
+  }
+  m_observation.reset();
+}
+
 void ResultSet::searchNextTuple(SearchMode searchMode)
+{
+  if (!m_observation)
+  {
+    findNextTuple(searchMode);
+    return;
+  }
+
+  const auto startTime = std::chrono::steady_clock::now();
+  findNextTuple(searchMode);
+  m_observation->iteration.iterationDuration += std::chrono::steady_clock::now() - startTime;
+}
+
+void ResultSet::findNextTuple(SearchMode searchMode)
 {
   if (!m_isValid || m_nextTupleResult.hasNext ||
     (searchMode == SearchMode::JOIN_TUPLE && m_nextTupleResult.hasNextJoin))
@@ -138,20 +430,36 @@ void ResultSet::searchNextTuple(SearchMode searchMode)
     return;
   }
 
+  if (!m_splitJoins.empty() && !m_isSplitJoinsIndexed)
+  {
+    indexSplitJoins();
+  }
+
   while (m_sqlQuery.next())
   {
+    if (m_observation)
+    {
+      m_observation->iteration.numRowsFetched++;
+    }
+
     if (m_joinMetaInfo.empty())
     {
       m_nextTupleResult.hasNext = true;
       return;
     }
 
+    if (!m_splitJoins.empty())
+    {
+      m_nextTupleResult.hasNext = true;
+      selectSplitJoinRows(TupleView(m_sqlQuery, m_queryMetaInfo).primaryKey());
+      return;
+    }
+
     TupleView tuple(m_sqlQuery, m_queryMetaInfo);
     const auto tupleKey = tuple.primaryKey();
 
-    if (m_retrievedResultKeys.count(tupleKey) == 0)
+    if (isNewTupleKey(tupleKey))
     {
-      m_retrievedResultKeys.emplace(tupleKey);
       m_nextTupleResult.hasNext = true;
       clearNextJoinsMask();
     }
@@ -170,31 +478,103 @@ void ResultSet::searchNextTuple(SearchMode searchMode)
   resetNextTupleResult();
 }
 
+bool ResultSet::isNewTupleKey(const PrimaryKey& tupleKey)
+{
+  if (!m_isForwardOnly)
+  {
+    return m_retrievedResultKeys.emplace(tupleKey).second;
+  }
+
+  if (m_currentTupleKey && *m_currentTupleKey == tupleKey)
+  {
+    return false;
+  }
+
+  m_currentTupleKey = tupleKey;
+  m_retrievedJoinResultKeys.clear();
+  return true;
+}
+
 void ResultSet::findNextJoinTuple(const PrimaryKey& tupleKey)
 {
   for (size_t i=0; i<m_joinMetaInfo.size(); ++i)
   {
     const auto& join = m_joinMetaInfo.at(i);
-    const auto key = std::make_pair(join.relationshipId.value(), tupleKey);
-    auto& retreivedJoinResultKeys = m_retrievedJoinResultKeys[key];
 
     TupleView joinTuple(m_sqlQuery, join);
-    const auto joinKeyTuple = joinTuple.primaryKey();
+    auto joinKeyTuple = joinTuple.primaryKey();
 
     if (joinKeyTuple.isNull())
     {
       continue;
     }
 
-    if (retreivedJoinResultKeys.count(joinKeyTuple) == 0)
+    const auto parentIndex = m_joinParentIndices.at(i);
+    auto parentKey = (parentIndex < 0)
+      ? tupleKey
+      : TupleView(m_sqlQuery, m_joinMetaInfo.at(parentIndex)).primaryKey();
+
+    if (m_retrievedJoinResultKeys.emplace(
+      JoinResultKey { join.relationshipId.value(), tupleKey, std::move(parentKey), std::move(joinKeyTuple) }).second)
     {
-      retreivedJoinResultKeys.emplace(joinKeyTuple);
       m_nextTupleResult.hasNextJoin = true;
       m_nextTupleResult.nextJoinsMask[i] = true;
     }
   }
 }
 
+void ResultSet::createJoinParentIndices()
+{
+  m_joinParentIndices.assign(m_joinMetaInfo.size(), -1);
+  for (size_t i=0; i<m_joinMetaInfo.size(); ++i)
+  {
+    const auto& parentRelationshipId = m_joinMetaInfo.at(i).parentRelationshipId;
+    if (!parentRelationshipId)
+    {
+      continue;
+    }
+
+    for (size_t j=0; j<m_joinMetaInfo.size(); ++j)
+    {
+      if (m_joinMetaInfo.at(j).relationshipId == parentRelationshipId)
+      {
+        m_joinParentIndices[i] = static_cast<int>(j);
+        break;
+      }
+    }
+  }
+}
+
+bool ResultSet::JoinResultKey::operator==(const JoinResultKey& rhs) const
+{
+  return relationshipId == rhs.relationshipId && tupleKey == rhs.tupleKey && parentTupleKey == rhs.parentTupleKey &&
+    joinTupleKey == rhs.joinTupleKey;
+}
+
+size_t ResultSet::JoinResultKeyHash::operator()(const JoinResultKey& key) const noexcept
+{
+  auto hash = static_cast<size_t>(key.tupleKey.hash());
+  hash ^= static_cast<size_t>(key.parentTupleKey.hash()) + 0x9E3779B97F4A7C15ULL + (hash << 6) + (hash >> 2);
+  hash ^= static_cast<size_t>(key.joinTupleKey.hash()) + 0x9E3779B97F4A7C15ULL + (hash << 6) + (hash >> 2);
+  hash ^= static_cast<size_t>(key.relationshipId) + 0x9E3779B97F4A7C15ULL + (hash << 6) + (hash >> 2);
+  return hash;
+}
+
+void ResultSet::releaseQuery()
+{
+  if (m_isValid)
+  {
+    notifyIterationFinished();
+
+    StatementCache::release(m_sqlQuery);
+    for (auto& splitJoin : m_splitJoins)
+    {
+      StatementCache::release(splitJoin.sqlQuery);
+    }
+    m_isValid = false;
+  }
+}
+
 void ResultSet::resetNextTupleResult()
 {
   m_nextTupleResult.hasNext = false;
@@ -0,0 +1,102 @@
+#include "ReturningClause.h"
+
+#include "QtSqlLib/DatabaseException.h"
+
+#include <QStringList>
+
+#include <algorithm>
+#include <array>
+#include <mutex>
+#include <numeric>
+#include <optional>
+
+namespace QtSqlLib::Query
+{
+
+static const std::array<int, 3> s_minReturningVersion = { 3, 35, 0 };
+
+static std::optional<std::array<int, 3>> querySqliteVersion(const QSqlDatabase& db)
+{
+  QSqlQuery query(db);
+  if (!query.exec("SELECT sqlite_version();") || !query.next())
+  {
+    return std::nullopt;
+  }
+
+  std::array<int, 3> version = { 0, 0, 0 };
+  const auto numbers = query.value(0).toString().split(".");
+  for (size_t i=0; i<version.size() && static_cast<int>(i)<numbers.size(); ++i)
+  {
+    version[i] = numbers.at(static_cast<int>(i)).toInt();
+  }
+  return version;
+}
+
+bool ReturningClause::isSupported(const QSqlDatabase& db)
+{
+  // all connections use the same SQLite library, so the version is only queried until the query succeeded once
+  static std::mutex s_mutex;
+  static std::optional<bool> s_isSupported;
+
+  std::lock_guard<std::mutex> lock(s_mutex);
+  if (!s_isSupported)
+  {
+    const auto version = querySqliteVersion(db);
+    if (!version)
+    {
+      return false;
+    }
+
+    s_isSupported = (version.value() >= s_minReturningVersion);
+  }
+
+  return s_isSupported.value();
+}
+
+void ReturningClause::throwIfNotSupported(const QSqlDatabase& db)
+{
+  if (!isSupported(db))
+  {
+    throw DatabaseException(DatabaseException::Type::QueryError,
+      QString("RETURNING clauses require SQLite %1.%2 or newer.")
+      .arg(s_minReturningVersion[0])
+      .arg(s_minReturningVersion[1]));
+  }
+}
+
+QString ReturningClause::createPrimaryKeysString(const API::Table& table)
+{
+  QString keyColumns;
+  for (const auto& columnId : table.primaryKeys)
+  {
+    keyColumns += QString("'%1'.'%2', ").arg(table.name).arg(table.columns.at(columnId).name);
+  }
+  return keyColumns.left(keyColumns.length() - 2);
+}
+
+ResultSet ReturningClause::createPrimaryKeysResults(API::IID::Type tableId, const API::Table& table, QSqlQuery&& query)
+{
+  std::vector<size_t> columnQueryIndices(table.primaryKeys.size());
+  std::vector<size_t> primaryKeyColumnIndices(table.primaryKeys.size());
+
+  std::iota(columnQueryIndices.begin(), columnQueryIndices.end(), 0);
+  std::iota(primaryKeyColumnIndices.begin(), primaryKeyColumnIndices.end(), 0);
+
+  API::QueryMetaInfo queryMetaInfo {
+    tableId,
+    std::nullopt,
+    std::nullopt,
+    ColumnHelper::SelectColumnList(table.primaryKeys.size()),
+    columnQueryIndices,
+    primaryKeyColumnIndices,
+    {}
+  };
+
+  std::transform(table.primaryKeys.cbegin(), table.primaryKeys.cend(), queryMetaInfo.columns.begin(), [](const API::IID::Type columnId) {
+    return ColumnHelper::SelectColumn(columnId);
+  });
+
+  return ResultSet(std::move(query), std::move(queryMetaInfo), {});
+}
+
+}
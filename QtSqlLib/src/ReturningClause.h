@@ -0,0 +1,26 @@
+#pragma once
+
+#include "QtSqlLib/API/SchemaTypes.h"
+#include "QtSqlLib/ResultSet.h"
+
+#include <QSqlDatabase>
+#include <QSqlQuery>
+#include <QString>
+
+namespace QtSqlLib::Query
+{
+
+class ReturningClause
+{
+public:
+  ReturningClause() = delete;
+
+  static bool isSupported(const QSqlDatabase& db);
+  static void throwIfNotSupported(const QSqlDatabase& db);
+
+  static QString createPrimaryKeysString(const API::Table& table);
+  static ResultSet createPrimaryKeysResults(API::IID::Type tableId, const API::Table& table, QSqlQuery&& query);
+
+};
+
+}
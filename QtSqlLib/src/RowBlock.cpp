@@ -0,0 +1,194 @@
+#include "QtSqlLib/RowBlock.h"
+
+#include "QtSqlLib/DatabaseException.h"
+#include "QtSqlLib/TupleView.h"
+
+#include "ColumnIdIndices.h"
+
+namespace QtSqlLib
+{
+
+RowBlock::Row::Row(const RowBlock& block, size_t index) :
+  m_block(block),
+  m_index(index)
+{
+}
+
+API::IID::Type RowBlock::Row::tableId() const
+{
+  return m_block.m_metaInfos->at(m_block.m_rows[m_index].metaInfoIndex).tableId;
+}
+
+std::optional<API::IID::Type> RowBlock::Row::relationshipId() const
+{
+  return m_block.m_metaInfos->at(m_block.m_rows[m_index].metaInfoIndex).relationshipId;
+}
+
+std::optional<API::IID::Type> RowBlock::Row::parentRelationshipId() const
+{
+  return m_block.m_metaInfos->at(m_block.m_rows[m_index].metaInfoIndex).parentRelationshipId;
+}
+
+bool RowBlock::Row::isJoinedTuple() const
+{
+  return m_block.m_rows[m_index].metaInfoIndex > 0;
+}
+
+size_t RowBlock::Row::parentRow() const
+{
+  return m_block.m_rows[m_index].parentRow;
+}
+
+PrimaryKey RowBlock::Row::primaryKey() const
+{
+  const auto& rowData = m_block.m_rows[m_index];
+  const auto& queryMetaInfo = m_block.m_metaInfos->at(rowData.metaInfoIndex);
+  const auto& primaryKeyIndices = queryMetaInfo.primaryKeyColumnIndices;
+  if (primaryKeyIndices.empty())
+  {
+    return PrimaryKey();
+  }
+
+  return PrimaryKey(queryMetaInfo.tableId, primaryKeyIndices.size(), [this, &queryMetaInfo, &primaryKeyIndices](size_t i)
+  {
+    const auto columnIndex = primaryKeyIndices.at(i);
+    return PrimaryKey::ColumnValue {
+      queryMetaInfo.columns.at(columnIndex).column.value<API::IID::Type>(),
+      columnValueAtIndex(columnIndex) };
+  });
+}
+
+PrimaryKey RowBlock::Row::parentPrimaryKey() const
+{
+  if (!isJoinedTuple())
+  {
+    return PrimaryKey();
+  }
+  return m_block.row(parentRow()).primaryKey();
+}
+
+const QVariant& RowBlock::Row::columnValueAtIndex(size_t index) const
+{
+  const auto& rowData = m_block.m_rows[m_index];
+  if (index >= m_block.m_metaInfos->at(rowData.metaInfoIndex).columns.size())
+  {
+    throw DatabaseException(DatabaseException::Type::UnexpectedError,
+      QString("Column index %1 out of range.").arg(index));
+  }
+
+  return m_block.m_values[rowData.valuesOffset + index];
+}
+
+int RowBlock::Row::columnIndexOf(const API::IID& columnId) const
+{
+  const auto metaInfoIndex = m_block.m_rows[m_index].metaInfoIndex;
+  const auto& columnIdIndices = m_block.m_columnIdIndices.at(metaInfoIndex);
+  if (!columnIdIndices.empty())
+  {
+    const auto id = columnId.get();
+    return (id >= 0 && static_cast<size_t>(id) < columnIdIndices.size()) ? columnIdIndices[id] : -1;
+  }
+
+  const auto& columns = m_block.m_metaInfos->at(metaInfoIndex).columns;
+  for (size_t i=0; i<columns.size(); ++i)
+  {
+    if (columns.at(i).isColumnId(columnId.get()))
+    {
+      return static_cast<int>(i);
+    }
+  }
+  return -1;
+}
+
+const QVariant& RowBlock::Row::columnValueIntern(const API::IID& columnId) const
+{
+  static const QVariant s_nullValue;
+
+  const auto columnIndex = columnIndexOf(columnId);
+  if (columnIndex < 0)
+  {
+    return s_nullValue;
+  }
+  return m_block.m_values[m_block.m_rows[m_index].valuesOffset + columnIndex];
+}
+
+RowBlock::RowBlock() :
+  m_numTuples(0)
+{
+}
+
+RowBlock::~RowBlock() = default;
+
+RowBlock::RowBlock(RowBlock&& rhs) = default;
+
+RowBlock& RowBlock::operator=(RowBlock&& rhs) = default;
+
+size_t RowBlock::size() const
+{
+  return m_rows.size();
+}
+
+bool RowBlock::isEmpty() const
+{
+  return m_rows.empty();
+}
+
+size_t RowBlock::numTuples() const
+{
+  return m_numTuples;
+}
+
+RowBlock::Row RowBlock::row(size_t index) const
+{
+  if (index >= m_rows.size())
+  {
+    throw DatabaseException(DatabaseException::Type::UnexpectedError,
+      QString("Row %1 out of range.").arg(index));
+  }
+  return Row(*this, index);
+}
+
+void RowBlock::clear()
+{
+  // keeps the allocated capacity for the next block
+  m_rows.clear();
+  m_values.clear();
+  m_numTuples = 0;
+}
+
+void RowBlock::reset(const std::shared_ptr<const MetaInfos>& metaInfos)
+{
+  clear();
+  if (m_metaInfos == metaInfos)
+  {
+    return;
+  }
+
+  m_metaInfos = metaInfos;
+  m_columnIdIndices.clear();
+  for (const auto& queryMetaInfo : *m_metaInfos)
+  {
+    // rows fall back to a linear search for sparse ids
+    m_columnIdIndices.emplace_back(ColumnIdIndices::create(queryMetaInfo, ColumnIdIndices::IndexType::ColumnIndex));
+  }
+}
+
+size_t RowBlock::append(size_t metaInfoIndex, const std::optional<size_t>& parentRow, const TupleView& tuple)
+{
+  const auto index = m_rows.size();
+  const auto numColumns = m_metaInfos->at(metaInfoIndex).columns.size();
+
+  m_rows.emplace_back(RowData { metaInfoIndex, parentRow.value_or(index), m_values.size() });
+  for (size_t i=0; i<numColumns; ++i)
+  {
+    m_values.emplace_back(tuple.columnValueAtIndex(i));
+  }
+
+  if (!parentRow)
+  {
+    m_numTuples++;
+  }
+  return index;
+}
+
+}
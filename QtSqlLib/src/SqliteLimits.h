@@ -0,0 +1,9 @@
+#pragma once
+
+namespace QtSqlLib
+{
+
+// default limit of bound parameters per statement of SQLite since version 3.32.0
+static constexpr int s_maxBoundValuesPerQuery = 32766;
+
+}
@@ -0,0 +1,287 @@
+#include "QtSqlLib/StatementCache.h"
+
+#include <QSqlDriver>
+
+#include <algorithm>
+
+namespace QtSqlLib
+{
+
+std::mutex StatementCache::s_registryMutex;
+std::map<const QSqlDriver*, std::shared_ptr<StatementCache::Cache>> StatementCache::s_registry;
+std::map<QString, StatementCache::Statistics> StatementCache::s_retiredStatistics;
+std::atomic<uint64_t> StatementCache::s_generation(0);
+
+void StatementCache::registerConnection(const QSqlDatabase& db, const QString& groupName, int capacity)
+{
+  std::lock_guard<std::mutex> lock(s_registryMutex);
+  s_registry[db.driver()] = std::make_shared<Cache>(groupName, capacity);
+}
+
+void StatementCache::unregisterConnection(const QSqlDatabase& db)
+{
+  std::lock_guard<std::mutex> lock(s_registryMutex);
+  const auto it = s_registry.find(db.driver());
+  if (it == s_registry.end())
+  {
+    return;
+  }
+
+  const auto groupName = it->second->getGroupName();
+  const auto statistics = it->second->getStatistics();
+
+  it->second->clear();
+  s_registry.erase(it);
+
+  // the statistics of a group are reset with its last connection, so a database reusing the name starts from zero
+  const auto isGroupRegistered = std::any_of(s_registry.cbegin(), s_registry.cend(),
+    [&groupName](const auto& cache) { return cache.second->getGroupName() == groupName; });
+
+  if (!isGroupRegistered)
+  {
+    s_retiredStatistics.erase(groupName);
+    return;
+  }
+
+  auto& retiredStatistics = s_retiredStatistics[groupName];
+  retiredStatistics.hits += statistics.hits;
+  retiredStatistics.misses += statistics.misses;
+}
+
+void StatementCache::setCapacity(const QString& groupName, int capacity)
+{
+  std::lock_guard<std::mutex> lock(s_registryMutex);
+  for (const auto& cache : s_registry)
+  {
+    if (cache.second->getGroupName() == groupName)
+    {
+      cache.second->setCapacity(capacity);
+    }
+  }
+}
+
+StatementCache::Statistics StatementCache::getStatistics(const QString& groupName)
+{
+  std::lock_guard<std::mutex> lock(s_registryMutex);
+
+  Statistics result;
+  const auto retiredIt = s_retiredStatistics.find(groupName);
+  if (retiredIt != s_retiredStatistics.end())
+  {
+    result = retiredIt->second;
+  }
+
+  for (const auto& cache : s_registry)
+  {
+    if (cache.second->getGroupName() == groupName)
+    {
+      const auto statistics = cache.second->getStatistics();
+      result.hits += statistics.hits;
+      result.misses += statistics.misses;
+      result.numCachedStatements += statistics.numCachedStatements;
+    }
+  }
+
+  return result;
+}
+
+void StatementCache::invalidateAll()
+{
+  // the statements belong to the threads owning the connections, so they are dropped by their next acquisition
+  s_generation++;
+}
+
+QSqlQuery StatementCache::prepare(const QSqlDatabase& db, const QString& queryString)
+{
+  const auto cache = findCache(db.driver());
+  if (isSchemaStatement(queryString))
+  {
+    // objects of the temp schema are only visible to the own connection and never referenced by cached statements
+    // of other connections
+    if (cache && !isTempSchemaStatement(queryString))
+    {
+      cache->invalidate();
+    }
+  }
+  else if (cache)
+  {
+    return cache->acquire(db, queryString);
+  }
+
+  QSqlQuery query(db);
+  query.prepare(queryString);
+  return query;
+}
+
+void StatementCache::release(QSqlQuery& query)
+{
+  if (const auto cache = findCache(query.driver()))
+  {
+    cache->release(query);
+  }
+}
+
+std::shared_ptr<StatementCache::Cache> StatementCache::findCache(const QSqlDriver* driver)
+{
+  std::lock_guard<std::mutex> lock(s_registryMutex);
+  const auto it = s_registry.find(driver);
+  if (it == s_registry.end())
+  {
+    return nullptr;
+  }
+
+  return it->second;
+}
+
+bool StatementCache::isSchemaStatement(const QString& queryString)
+{
+  const auto trimmed = queryString.trimmed();
+  return trimmed.startsWith("CREATE", Qt::CaseInsensitive) ||
+    trimmed.startsWith("DROP", Qt::CaseInsensitive) ||
+    trimmed.startsWith("ALTER", Qt::CaseInsensitive);
+}
+
+bool StatementCache::isTempSchemaStatement(const QString& queryString)
+{
+  const auto words = queryString.simplified().toUpper().split(" ");
+  if (words.size() > 1 && words[0] == "CREATE" && (words[1] == "TEMP" || words[1] == "TEMPORARY"))
+  {
+    return true;
+  }
+
+  // object names qualified by the temp schema, e.g. DROP TABLE IF EXISTS temp.'name'
+  for (const auto& word : words)
+  {
+    if (word == "ON" || word == "AS" || word.contains("("))
+    {
+      return false;
+    }
+    if (word.startsWith("TEMP.") || word.startsWith("'TEMP'.") || word.startsWith("\"TEMP\"."))
+    {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+StatementCache::Cache::Cache(const QString& groupName, int capacity) :
+  m_groupName(groupName),
+  m_capacity(static_cast<size_t>(std::max(capacity, 0))),
+  m_generation(s_generation.load())
+{
+}
+
+const QString& StatementCache::Cache::getGroupName() const
+{
+  return m_groupName;
+}
+
+void StatementCache::Cache::setCapacity(int capacity)
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_capacity = static_cast<size_t>(std::max(capacity, 0));
+  evictExceedingStatements();
+}
+
+StatementCache::Statistics StatementCache::Cache::getStatistics() const
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+
+  auto statistics = m_statistics;
+  statistics.numCachedStatements = m_idleStatements.size();
+  return statistics;
+}
+
+QSqlQuery StatementCache::Cache::acquire(const QSqlDatabase& db, const QString& queryString)
+{
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    dropStaleStatements();
+    m_numCheckedOutStatements[queryString]++;
+
+    const auto it = m_idleStatementsIndex.find(queryString);
+    if (it != m_idleStatementsIndex.end())
+    {
+      auto query = std::move(it->second->second);
+      m_idleStatements.erase(it->second);
+      m_idleStatementsIndex.erase(it);
+
+      m_statistics.hits++;
+      return query;
+    }
+
+    m_statistics.misses++;
+  }
+
+  QSqlQuery query(db);
+  query.prepare(queryString);
+  return query;
+}
+
+void StatementCache::Cache::release(QSqlQuery& query)
+{
+  const auto queryString = query.lastQuery();
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+  const auto checkedOutIt = m_numCheckedOutStatements.find(queryString);
+  if (checkedOutIt == m_numCheckedOutStatements.end())
+  {
+    return;
+  }
+
+  if (--checkedOutIt->second == 0)
+  {
+    m_numCheckedOutStatements.erase(checkedOutIt);
+  }
+
+  dropStaleStatements();
+  if (m_capacity == 0 || m_idleStatementsIndex.count(queryString) > 0)
+  {
+    return;
+  }
+
+  query.finish();
+
+  m_idleStatements.emplace_front(queryString, query);
+  m_idleStatementsIndex[queryString] = m_idleStatements.begin();
+
+  evictExceedingStatements();
+}
+
+void StatementCache::Cache::invalidate()
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_generation = ++s_generation;
+  m_idleStatements.clear();
+  m_idleStatementsIndex.clear();
+}
+
+void StatementCache::Cache::clear()
+{
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_idleStatements.clear();
+  m_idleStatementsIndex.clear();
+}
+
+void StatementCache::Cache::dropStaleStatements()
+{
+  const auto generation = s_generation.load();
+  if (generation != m_generation)
+  {
+    m_generation = generation;
+    m_idleStatements.clear();
+    m_idleStatementsIndex.clear();
+  }
+}
+
+void StatementCache::Cache::evictExceedingStatements()
+{
+  while (m_idleStatements.size() > m_capacity)
+  {
+    m_idleStatementsIndex.erase(m_idleStatements.back().first);
+    m_idleStatements.pop_back();
+  }
+}
+
+}
@@ -0,0 +1,34 @@
+#include "StatementQuery.h"
+
+#include "QtSqlLib/StatementCache.h"
+
+namespace QtSqlLib::Query
+{
+
+StatementQuery::StatementQuery(const QString& queryString, QueryMode mode)
+  : Query()
+  , m_queryString(queryString)
+  , m_mode(mode)
+{
+}
+
+StatementQuery::~StatementQuery() = default;
+
+void StatementQuery::addBindValue(const QVariant& value)
+{
+  m_boundValues.emplace_back(value);
+}
+
+API::IQuery::SqlQuery StatementQuery::getSqlQuery(const QSqlDatabase& db, API::ISchema& /*schema*/,
+  ResultSet& /*previousQueryResults*/)
+{
+  auto query = StatementCache::prepare(db, m_queryString);
+  for (const auto& value : m_boundValues)
+  {
+    query.addBindValue(value);
+  }
+
+  return { std::move(query), m_mode };
+}
+
+}
@@ -0,0 +1,34 @@
+#pragma once
+
+#include "QtSqlLib/Query/Query.h"
+
+#include <QString>
+#include <QVariant>
+
+#include <vector>
+
+namespace QtSqlLib::Query
+{
+
+/**
+ * Executes a fixed statement prepared by the StatementCache. In batch mode each bound value is a list with one
+ * value per execution.
+ */
+class StatementQuery : public Query
+{
+public:
+  StatementQuery(const QString& queryString, QueryMode mode = QueryMode::Single);
+  ~StatementQuery() override;
+
+  void addBindValue(const QVariant& value);
+
+  SqlQuery getSqlQuery(const QSqlDatabase& db, API::ISchema& schema, ResultSet& previousQueryResults) override;
+
+private:
+  QString m_queryString;
+  QueryMode m_mode;
+  std::vector<QVariant> m_boundValues;
+
+};
+
+}
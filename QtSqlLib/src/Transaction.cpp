@@ -0,0 +1,164 @@
+#include "QtSqlLib/Transaction.h"
+
+#include "QtSqlLib/DatabaseException.h"
+
+#include <QSqlError>
+#include <QSqlQuery>
+
+namespace QtSqlLib
+{
+
+std::mutex Transaction::s_depthsMutex;
+std::map<QString, int> Transaction::s_depths;
+
+Transaction::Transaction(const QSqlDatabase& db) :
+  m_db(db),
+  m_level(getDepth(db)),
+  m_bIsActive(false)
+{
+  if (m_level == 0)
+  {
+    if (!m_db.transaction())
+    {
+      throw DatabaseException(DatabaseException::Type::QueryError,
+        QString("Could not begin transaction: %1").arg(m_db.lastError().text()));
+    }
+  }
+  else
+  {
+    execSavepointStatement(QString("SAVEPOINT %1;").arg(savepointName()));
+  }
+
+  std::lock_guard<std::mutex> lock(s_depthsMutex);
+  s_depths[m_db.connectionName()] = m_level + 1;
+  m_bIsActive = true;
+}
+
+Transaction::~Transaction()
+{
+  if (!m_bIsActive)
+  {
+    return;
+  }
+
+  try
+  {
+    rollback();
+  }
+  catch (const DatabaseException&)
+  {
+    finish();
+  }
+}
+
+Transaction::Transaction(Transaction&& rhs) :
+  m_db(rhs.m_db),
+  m_level(rhs.m_level),
+  m_bIsActive(rhs.m_bIsActive)
+{
+  rhs.m_bIsActive = false;
+}
+
+bool Transaction::isActive() const
+{
+  return m_bIsActive;
+}
+
+bool Transaction::isNested() const
+{
+  return m_level > 0;
+}
+
+void Transaction::commit()
+{
+  throwIfNotInnermost();
+
+  if (m_level == 0)
+  {
+    if (!m_db.commit())
+    {
+      throw DatabaseException(DatabaseException::Type::QueryError,
+        QString("Could not commit transaction: %1").arg(m_db.lastError().text()));
+    }
+  }
+  else
+  {
+    execSavepointStatement(QString("RELEASE SAVEPOINT %1;").arg(savepointName()));
+  }
+
+  finish();
+}
+
+void Transaction::rollback()
+{
+  throwIfNotInnermost();
+
+  if (m_level == 0)
+  {
+    if (!m_db.rollback())
+    {
+      finish();
+      throw DatabaseException(DatabaseException::Type::QueryError,
+        QString("Could not roll back transaction: %1").arg(m_db.lastError().text()));
+    }
+  }
+  else
+  {
+    execSavepointStatement(QString("ROLLBACK TO SAVEPOINT %1;").arg(savepointName()));
+    execSavepointStatement(QString("RELEASE SAVEPOINT %1;").arg(savepointName()));
+  }
+
+  finish();
+}
+
+int Transaction::getDepth(const QSqlDatabase& db)
+{
+  std::lock_guard<std::mutex> lock(s_depthsMutex);
+  const auto it = s_depths.find(db.connectionName());
+  return it != s_depths.end() ? it->second : 0;
+}
+
+void Transaction::throwIfNotInnermost() const
+{
+  if (!m_bIsActive)
+  {
+    throw DatabaseException(DatabaseException::Type::UnexpectedError, "Transaction is not active.");
+  }
+
+  if (getDepth(m_db) != m_level + 1)
+  {
+    throw DatabaseException(DatabaseException::Type::UnexpectedError,
+      "Nested transactions must be finished first.");
+  }
+}
+
+void Transaction::execSavepointStatement(const QString& statement) const
+{
+  QSqlQuery query(m_db);
+  if (!query.exec(statement))
+  {
+    throw DatabaseException(DatabaseException::Type::QueryError,
+      QString("Could not execute '%1': %2").arg(statement).arg(query.lastError().text()));
+  }
+}
+
+void Transaction::finish()
+{
+  std::lock_guard<std::mutex> lock(s_depthsMutex);
+  if (m_level == 0)
+  {
+    s_depths.erase(m_db.connectionName());
+  }
+  else
+  {
+    s_depths[m_db.connectionName()] = m_level;
+  }
+  m_bIsActive = false;
+}
+
+QString Transaction::savepointName() const
+{
+  return QString("qtsqllib_savepoint_%1").arg(m_level);
+}
+
+}
@@ -0,0 +1,103 @@
+#include "QtSqlLib/Tuple.h"
+
+#include "QtSqlLib/DatabaseException.h"
+#include "QtSqlLib/TupleArena.h"
+
+namespace QtSqlLib
+{
+
+Tuple::Tuple(
+    std::shared_ptr<const MetaInfos> metaInfos,
+    size_t metaInfoIndex,
+    std::shared_ptr<TupleArena> arena,
+    const QVariant* values,
+    PrimaryKey parentPrimaryKey) :
+  m_metaInfos(std::move(metaInfos)),
+  m_queryMetaInfo(&m_metaInfos->at(metaInfoIndex)),
+  m_arena(std::move(arena)),
+  m_values(values),
+  m_parentPrimaryKey(std::move(parentPrimaryKey))
+{
+}
+
+Tuple::~Tuple() = default;
+
+API::IID::Type Tuple::tableId() const
+{
+  return m_queryMetaInfo->tableId;
+}
+
+std::optional<API::IID::Type> Tuple::relationshipId() const
+{
+  return m_queryMetaInfo->relationshipId;
+}
+
+std::optional<API::IID::Type> Tuple::parentRelationshipId() const
+{
+  return m_queryMetaInfo->parentRelationshipId;
+}
+
+PrimaryKey Tuple::primaryKey() const
+{
+  const auto& primaryKeyIndices = m_queryMetaInfo->primaryKeyColumnIndices;
+  if (primaryKeyIndices.empty())
+  {
+    return PrimaryKey();
+  }
+
+  return PrimaryKey(m_queryMetaInfo->tableId, primaryKeyIndices.size(), [this, &primaryKeyIndices](size_t i)
+  {
+    const auto columnIndex = primaryKeyIndices.at(i);
+    return PrimaryKey::ColumnValue {
+      m_queryMetaInfo->columns.at(columnIndex).column.value<API::IID::Type>(),
+      m_values[columnIndex] };
+  });
+}
+
+PrimaryKey Tuple::parentPrimaryKey() const
+{
+  return m_parentPrimaryKey;
+}
+
+size_t Tuple::numColumns() const
+{
+  return m_queryMetaInfo->columns.size();
+}
+
+const QVariant& Tuple::columnValueAtIndex(size_t index) const
+{
+  if (index >= m_queryMetaInfo->columns.size())
+  {
+    throw DatabaseException(DatabaseException::Type::UnexpectedError,
+      QString("Column index %1 out of range.").arg(index));
+  }
+
+  return m_values[index];
+}
+
+int Tuple::columnIndexOf(const API::IID& columnId) const
+{
+  const auto& columns = m_queryMetaInfo->columns;
+  for (size_t i=0; i<columns.size(); ++i)
+  {
+    if (columns.at(i).isColumnId(columnId.get()))
+    {
+      return static_cast<int>(i);
+    }
+  }
+  return -1;
+}
+
+const QVariant& Tuple::columnValueIntern(const API::IID& columnId) const
+{
+  static const QVariant s_nullValue;
+
+  const auto columnIndex = columnIndexOf(columnId);
+  if (columnIndex < 0)
+  {
+    return s_nullValue;
+  }
+  return m_values[columnIndex];
+}
+
+}
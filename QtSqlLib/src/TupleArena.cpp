@@ -0,0 +1,53 @@
+#include "QtSqlLib/TupleArena.h"
+
+#include <algorithm>
+
+namespace QtSqlLib
+{
+
+static const size_t s_initialChunkCapacity = 1024;
+static const size_t s_maxChunkCapacity = 262144;
+
+TupleArena::TupleArena() :
+  m_numUsedInChunk(0),
+  m_numValues(0)
+{
+}
+
+TupleArena::~TupleArena() = default;
+
+size_t TupleArena::numChunks() const
+{
+  return m_chunks.size();
+}
+
+size_t TupleArena::numValues() const
+{
+  return m_numValues;
+}
+
+QVariant* TupleArena::allocate(size_t numValues)
+{
+  if (numValues == 0)
+  {
+    return nullptr;
+  }
+
+  if (m_chunks.empty() || m_numUsedInChunk + numValues > m_chunks.back().capacity)
+  {
+    // chunks double in size, so retaining many tuples only takes a few allocations
+    const auto capacity = std::max(numValues, m_chunks.empty()
+      ? s_initialChunkCapacity
+      : std::min(m_chunks.back().capacity * 2, s_maxChunkCapacity));
+
+    m_chunks.emplace_back(Chunk { std::make_unique<QVariant[]>(capacity), capacity });
+    m_numUsedInChunk = 0;
+  }
+
+  auto* values = m_chunks.back().values.get() + m_numUsedInChunk;
+  m_numUsedInChunk += numValues;
+  m_numValues += numValues;
+  return values;
+}
+
+}
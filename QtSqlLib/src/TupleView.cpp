@@ -1,6 +1,8 @@
 #include "QtSqlLib/TupleView.h"
 
 #include "QtSqlLib/DatabaseException.h"
+#include "QtSqlLib/ResultSet.h"
+#include "QtSqlLib/TupleArena.h"
 
 namespace QtSqlLib
 {
@@ -10,7 +12,22 @@ TupleView::TupleView(
     const API::QueryMetaInfo& queryMetaInfo) :
   m_queryPos(sqlQuery.at()),
   m_sqlQuery(sqlQuery),
-  m_queryMetaInfo(queryMetaInfo)
+  m_queryMetaInfo(queryMetaInfo),
+  m_resultSet(nullptr),
+  m_metaInfoIndex(0)
+{
+}
+
+TupleView::TupleView(
+    const QSqlQuery& sqlQuery,
+    const API::QueryMetaInfo& queryMetaInfo,
+    ResultSet& resultSet,
+    size_t metaInfoIndex) :
+  m_queryPos(sqlQuery.at()),
+  m_sqlQuery(sqlQuery),
+  m_queryMetaInfo(queryMetaInfo),
+  m_resultSet(&resultSet),
+  m_metaInfoIndex(metaInfoIndex)
 {
 }
 
@@ -26,6 +43,11 @@ std::optional<API::IID::Type> TupleView::relationshipId() const
   return m_queryMetaInfo.relationshipId;
 }
 
+std::optional<API::IID::Type> TupleView::parentRelationshipId() const
+{
+  return m_queryMetaInfo.parentRelationshipId;
+}
+
 PrimaryKey TupleView::primaryKey() const
 {
   throwIfInvalidated();
@@ -36,17 +58,26 @@ PrimaryKey TupleView::primaryKey() const
     return PrimaryKey();
   }
 
-  std::vector<PrimaryKey::ColumnValue> values(primaryKeyIndices.size());
-  for (size_t i=0; i<primaryKeyIndices.size(); ++i)
+  return PrimaryKey(m_queryMetaInfo.tableId, primaryKeyIndices.size(), [this, &primaryKeyIndices](size_t i)
   {
-    auto& primaryKeyValue = values.at(i);
     const auto columnIndex = primaryKeyIndices.at(i);
     const auto queryIndex = m_queryMetaInfo.columnQueryIndices.at(columnIndex);
-    primaryKeyValue.columnId = m_queryMetaInfo.columns.at(columnIndex).column.value<API::IID::Type>();
-    primaryKeyValue.value = m_sqlQuery.value(static_cast<int>(queryIndex));
+    return PrimaryKey::ColumnValue {
+      m_queryMetaInfo.columns.at(columnIndex).column.value<API::IID::Type>(),
+      m_sqlQuery.value(static_cast<int>(queryIndex)) };
+  });
+}
+
+PrimaryKey TupleView::parentPrimaryKey() const
+{
+  throwIfInvalidated();
+
+  if (!m_resultSet || m_metaInfoIndex == 0)
+  {
+    return PrimaryKey();
   }
 
-  return PrimaryKey(m_queryMetaInfo.tableId, std::move(values));
+  return TupleView(m_sqlQuery, m_resultSet->parentQueryMetaInfo(m_metaInfoIndex)).primaryKey();
 }
 
 QVariant TupleView::columnValueAtIndex(size_t index) const
@@ -55,32 +86,100 @@ QVariant TupleView::columnValueAtIndex(size_t index) const
   return m_sqlQuery.value(static_cast<int>(m_queryMetaInfo.columnQueryIndices.at(index)));
 }
 
-bool TupleView::hasColumnValueIntern(const API::IID& columnId) const
+Tuple TupleView::detach() const
+{
+  if (!m_resultSet)
+  {
+    throw DatabaseException(DatabaseException::Type::UnexpectedError, "Tuple does not belong to a result set.");
+  }
+  return detach(m_resultSet->tupleArena());
+}
+
+Tuple TupleView::detach(const std::shared_ptr<TupleArena>& arena) const
 {
+  throwIfInvalidated();
+
+  if (!m_resultSet)
+  {
+    throw DatabaseException(DatabaseException::Type::UnexpectedError, "Tuple does not belong to a result set.");
+  }
+
+  if (!arena)
+  {
+    throw DatabaseException(DatabaseException::Type::UnexpectedError, "No arena provided.");
+  }
+
+  const auto& columnQueryIndices = m_queryMetaInfo.columnQueryIndices;
+  auto* values = arena->allocate(columnQueryIndices.size());
+  for (size_t i=0; i<columnQueryIndices.size(); ++i)
+  {
+    values[i] = m_sqlQuery.value(static_cast<int>(columnQueryIndices[i]));
+  }
+
+  return Tuple(m_resultSet->sharedMetaInfos(), m_metaInfoIndex, arena, values, parentPrimaryKey());
+}
+
+int TupleView::queryIndexOf(const API::IID& columnId) const
+{
+  const auto& columnIdQueryIndices = m_queryMetaInfo.columnIdQueryIndices;
+  if (!columnIdQueryIndices.empty())
+  {
+    const auto id = columnId.get();
+    return (id >= 0 && static_cast<size_t>(id) < columnIdQueryIndices.size()) ? columnIdQueryIndices[id] : -1;
+  }
+
   auto& columns = m_queryMetaInfo.columns;
   for (size_t i=0; i<columns.size(); ++i)
   {
     if (columns.at(i).isColumnId(columnId.get()))
     {
-      return true;
+      return static_cast<int>(m_queryMetaInfo.columnQueryIndices.at(i));
     }
   }
-  return false;
+  return -1;
+}
+
+QVariant TupleView::valueAtQueryIndex(int queryIndex) const
+{
+  throwIfInvalidated();
+  return m_sqlQuery.value(queryIndex);
+}
+
+bool TupleView::hasColumnValueIntern(const API::IID& columnId) const
+{
+  return queryIndexOf(columnId) >= 0;
 }
 
 QVariant TupleView::columnValueIntern(const API::IID& columnId) const
 {
   throwIfInvalidated();
 
-  auto& columns = m_queryMetaInfo.columns;
-  for (size_t i=0; i<columns.size(); ++i)
+  const auto queryIndex = queryIndexOf(columnId);
+  if (queryIndex < 0)
   {
-    if (columns.at(i).isColumnId(columnId.get()))
-    {
-      return m_sqlQuery.value(static_cast<int>(m_queryMetaInfo.columnQueryIndices.at(i)));
-    }
+    return {};
   }
-  return {};
+  return m_sqlQuery.value(queryIndex);
+}
+
+int64_t TupleView::int64AtIntern(const API::IID& columnId) const
+{
+  return static_cast<int64_t>(columnValueIntern(columnId).toLongLong());
+}
+
+double TupleView::doubleAtIntern(const API::IID& columnId) const
+{
+  return columnValueIntern(columnId).toDouble();
+}
+
+QString TupleView::textAtIntern(const API::IID& columnId) const
+{
+  return columnValueIntern(columnId).toString();
+}
+
+QByteArray TupleView::blobAtIntern(const API::IID& columnId) const
+{
+  return columnValueIntern(columnId).toByteArray();
 }
 
 void TupleView::throwIfInvalidated() const
@@ -1,27 +1,11 @@
 #include "QtSqlLib/Query/UnlinkTuples.h"
 
-#include "QtSqlLib/Expr.h"
-#include "QtSqlLib/ID.h"
-#include "QtSqlLib/Query/DeleteFrom.h"
-#include "QtSqlLib/Query/UpdateTable.h"
+#include "BatchDeleteTuples.h"
+#include "BatchUpdateForeignKeys.h"
 
 namespace QtSqlLib::Query
 {
 
-static Expr createWhereExpression(const PrimaryKey& childKeyValues)
-{
-  Expr whereExpr;
-  for (const auto& col : childKeyValues.values())
-  {
-    if (col.columnId != childKeyValues.values().begin()->columnId)
-    {
-      whereExpr.opAnd();
-    }
-    whereExpr.equal(col.columnId, col.value);
-  }
-  return whereExpr;
-}
-
 UnlinkTuples::UnlinkTuples(const API::IID& relationshipId) :
   QuerySequence(),
   m_relationshipPreparationData(relationshipId)
@@ -51,33 +35,31 @@ UnlinkTuples& UnlinkTuples::toMany(const std::vector<PrimaryKey>& tupleKeyValues
 void UnlinkTuples::prepare(API::ISchema& schema)
 {
   const auto affectedData = m_relationshipPreparationData.resolveAffectedTableData(schema);
+  if (affectedData.affectedTuples.empty())
+  {
+    return;
+  }
+
   if (affectedData.isLinkTable)
   {
+    auto deleteQuery = std::make_unique<BatchDeleteTuples>(affectedData.tableId);
     for (const auto& tuple : affectedData.affectedTuples)
     {
-      auto deleteQuery = std::make_unique<DeleteFrom>(ID(affectedData.tableId));
-      auto expr = createWhereExpression(tuple.childKeyValues);
-      deleteQuery->where(expr);
-
-      addQuery(std::move(deleteQuery));
+      deleteQuery->addKeyValues(tuple.childKeyValues);
     }
+
+    addQuery(std::move(deleteQuery));
   }
   else
   {
+    auto updateQuery = std::make_unique<BatchUpdateForeignKeys>(affectedData.tableId, affectedData.primaryForeignKeyColIdMap);
     for (const auto& tuple : affectedData.affectedTuples)
     {
-      auto updateQuery = std::make_unique<UpdateTable>(ID(affectedData.tableId));
-      for (const auto& col : tuple.foreignKeyValues.values())
-      {
-        const auto childColId = affectedData.primaryForeignKeyColIdMap.at(col.columnId);
-        updateQuery->set(ID(childColId), QVariant());
-
-        auto expr = createWhereExpression(tuple.childKeyValues);
-        updateQuery->where(expr);
-      }
-
-      addQuery(std::move(updateQuery));
+      updateQuery->addNullForeignKeyValues();
+      updateQuery->addChildKeyValues(tuple.childKeyValues);
     }
+
+    addQuery(std::move(updateQuery));
   }
 }
 
@@ -6,11 +6,15 @@
 #include "QtSqlLib/Expr.h"
 #include "QtSqlLib/ID.h"
 #include "QtSqlLib/QueryIdentifiers.h"
+#include "QtSqlLib/StatementCache.h"
+
+#include "ReturningClause.h"
 
 namespace QtSqlLib::Query
 {
 UpdateTable::UpdateTable(const API::IID& tableId)
   : m_tableId(tableId.get())
+  , m_bIsReturningIds(false)
 {
 }
 
@@ -40,6 +44,18 @@ UpdateTable& UpdateTable::where(Expr& expr)
   return *this;
 }
 
+UpdateTable& UpdateTable::returnIds()
+{
+  if (m_bIsReturningIds)
+  {
+    throw DatabaseException(DatabaseException::Type::InvalidSyntax,
+      "returnIds() can only be called once per query.");
+  }
+
+  m_bIsReturningIds = true;
+  return *this;
+}
+
 API::IQuery::SqlQuery UpdateTable::getSqlQuery(const QSqlDatabase& db, API::ISchema& schema, ResultSet& /*previousQueryResults*/)
 {
   schema.getSanityChecker().throwIfTableIdNotExisting(m_tableId);
@@ -75,10 +91,20 @@ API::IQuery::SqlQuery UpdateTable::getSqlQuery(const QSqlDatabase& db, API::ISch
     queryStr.append(QString(" WHERE %1").arg(m_whereExpr->toQueryString(schema, identifiers, boundValues)));
   }
 
+  if (m_bIsReturningIds)
+  {
+    ReturningClause::throwIfNotSupported(db);
+    queryStr.append(QString(" RETURNING %1").arg(ReturningClause::createPrimaryKeysString(table)));
+  }
+
   queryStr.append(";");
 
-  QSqlQuery query(db);
-  query.prepare(queryStr);
+  auto query = StatementCache::prepare(db, queryStr);
+  if (m_bIsReturningIds)
+  {
+    query.setForwardOnly(false);
+  }
+
   for (const auto& colValue : m_colIdNewValueMap)
   {
     query.addBindValue(colValue.second);
@@ -91,4 +117,14 @@ API::IQuery::SqlQuery UpdateTable::getSqlQuery(const QSqlDatabase& db, API::ISch
   return { std::move(query) };
 }
 
+ResultSet UpdateTable::getQueryResults(API::ISchema& schema, QSqlQuery&& query)
+{
+  if (!m_bIsReturningIds)
+  {
+    return {};
+  }
+
+  return ReturningClause::createPrimaryKeysResults(m_tableId, schema.getTables().at(m_tableId), std::move(query));
+}
+
 }
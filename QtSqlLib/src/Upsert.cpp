@@ -0,0 +1,80 @@
+#include "QtSqlLib/Query/Upsert.h"
+
+#include "ReturningClause.h"
+
+namespace QtSqlLib::Query
+{
+
+Upsert::Upsert(const API::IID& tableId)
+  : InsertInto(tableId)
+{
+}
+
+Upsert::~Upsert() = default;
+
+Upsert& Upsert::value(const API::IID& columnId, const QVariant& value)
+{
+  InsertInto::value(columnId, value);
+  return *this;
+}
+
+Upsert& Upsert::returnIds()
+{
+  setReturningIds();
+  return *this;
+}
+
+Upsert& Upsert::onConflictPrimaryKey()
+{
+  m_conflictClause.setTarget(ConflictClause::Target::PrimaryKey);
+  return *this;
+}
+
+Upsert& Upsert::onConflictUniqueCols()
+{
+  m_conflictClause.setTarget(ConflictClause::Target::UniqueColumns);
+  return *this;
+}
+
+Upsert& Upsert::keep(const API::IID& columnId)
+{
+  m_conflictClause.setColumnAction(columnId.get(), ConflictClause::Action::Keep);
+  return *this;
+}
+
+Upsert& Upsert::overwrite(const API::IID& columnId)
+{
+  m_conflictClause.setColumnAction(columnId.get(), ConflictClause::Action::Overwrite);
+  return *this;
+}
+
+Upsert& Upsert::overwriteIf(const API::IID& columnId, Expr& condition)
+{
+  m_conflictClause.setColumnOverwriteCondition(columnId.get(), condition);
+  return *this;
+}
+
+Upsert& Upsert::doNothing()
+{
+  m_conflictClause.setDoNothing();
+  return *this;
+}
+
+API::IQuery::SqlQuery Upsert::getSqlQuery(const QSqlDatabase& db, API::ISchema& schema, ResultSet& previousQueryResults)
+{
+  if (isReturningIds())
+  {
+    // the key of an updated row cannot be queried by its rowid
+    ReturningClause::throwIfNotSupported(db);
+  }
+
+  return InsertInto::getSqlQuery(db, schema, previousQueryResults);
+}
+
+QString Upsert::createConflictString(API::ISchema& schema, API::IID::Type tableId,
+  const ColumnHelper::ColumnList& columns, std::vector<QVariant>& boundValuesOut) const
+{
+  return m_conflictClause.toQueryString(schema, tableId, columns, boundValuesOut);
+}
+
+}
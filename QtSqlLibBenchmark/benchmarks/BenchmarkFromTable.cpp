@@ -0,0 +1,120 @@
+#include <benchmark/benchmark.h>
+
+#include <BenchmarkCommon.h>
+
+namespace QtSqlLibBenchmark
+{
+
+static const int s_numAlbums = 200;
+static const int s_numTracksPerAlbum = 10;
+static const int s_numArtistsPerAlbum = 3;
+
+static QtSqlLib::ResultSet execAlbumsQuery(QtSqlLib::Database& db, int numJoins)
+{
+  QtSqlLib::Query::FromTable query(QtSqlLib::ID(TableIds::Albums));
+  query.SELECT_ALL;
+
+  if (numJoins > 0)
+  {
+    query.JOIN_ALL(Relationships::AlbumTracks);
+  }
+  if (numJoins > 1)
+  {
+    query.JOIN_ALL(Relationships::AlbumArtists);
+  }
+
+  return db.execQuery(query);
+}
+
+/**
+ * @benchmark: Executes a FromTable query with 0, 1 or 2 joined relationships and iterates all results.
+ */
+static void BM_FromTableJoins(benchmark::State& state)
+{
+  const auto numJoins = static_cast<int>(state.range(0));
+
+  QtSqlLib::Database db;
+  BenchmarkDatabase::setup(db);
+  BenchmarkDatabase::populate(db, s_numAlbums, s_numTracksPerAlbum, s_numArtistsPerAlbum);
+
+  size_t numTuples = 0;
+  for (auto _ : state)
+  {
+    auto results = execAlbumsQuery(db, numJoins);
+    numTuples += BenchmarkDatabase::iterateResults(results);
+  }
+
+  state.SetItemsProcessed(static_cast<int64_t>(numTuples));
+  db.close();
+}
+
+/**
+ * @benchmark: Iterates an already executed result set with two joined relationships. The joined rows are
+ *             deduplicated by the result set, the query execution is not measured.
+ */
+static void BM_ResultSetJoinIteration(benchmark::State& state)
+{
+  QtSqlLib::Database db;
+  BenchmarkDatabase::setup(db);
+  BenchmarkDatabase::populate(db, s_numAlbums, s_numTracksPerAlbum, s_numArtistsPerAlbum);
+
+  auto results = execAlbumsQuery(db, 2);
+  results.fetchAll();
+
+  size_t numTuples = 0;
+  for (auto _ : state)
+  {
+    results.resetIteration();
+    numTuples += BenchmarkDatabase::iterateResults(results);
+  }
+
+  state.SetItemsProcessed(static_cast<int64_t>(numTuples));
+  db.close();
+}
+
+/**
+ * @benchmark: Reads the columns of all tracks, either via columnValue() or via the typed column accessors.
+ */
+static void BM_TupleColumnAccess(benchmark::State& state)
+{
+  const auto useTypedAccessors = (state.range(0) != 0);
+
+  QtSqlLib::Database db;
+  BenchmarkDatabase::setup(db);
+  BenchmarkDatabase::populate(db, s_numAlbums, s_numTracksPerAlbum, 0);
+
+  auto results = db.execQuery(FROM_TABLE(TableIds::Tracks).SELECT_ALL);
+  results.fetchAll();
+
+  size_t numTuples = 0;
+  int64_t checksum = 0;
+  for (auto _ : state)
+  {
+    results.resetIteration();
+    while (results.hasNextTuple())
+    {
+      const auto tuple = results.nextTuple();
+      if (useTypedAccessors)
+      {
+        checksum += tuple.int64At(TracksCols::Length) + tuple.int64At(TracksCols::Rating) +
+          tuple.textAt(TracksCols::Name).size();
+      }
+      else
+      {
+        checksum += tuple.columnValue(TracksCols::Length).toLongLong() + tuple.columnValue(TracksCols::Rating).toLongLong() +
+          tuple.columnValue(TracksCols::Name).toString().size();
+      }
+      numTuples++;
+    }
+  }
+
+  benchmark::DoNotOptimize(checksum);
+  state.SetItemsProcessed(static_cast<int64_t>(numTuples));
+  db.close();
+}
+
+BENCHMARK(BM_FromTableJoins)->Arg(0)->Arg(1)->Arg(2)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_ResultSetJoinIteration)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_TupleColumnAccess)->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond);
+
+}
@@ -0,0 +1,66 @@
+#include <benchmark/benchmark.h>
+
+#include <BenchmarkCommon.h>
+
+namespace QtSqlLibBenchmark
+{
+
+/**
+ * @benchmark: Inserts rows one by one with InsertInto queries within one transaction.
+ */
+static void BM_InsertInto(benchmark::State& state)
+{
+  const auto numRows = static_cast<int>(state.range(0));
+
+  QtSqlLib::Database db;
+  BenchmarkDatabase::setup(db);
+
+  DataGenerator generator;
+  const auto names = generator.texts(numRows, 16);
+  const auto lengths = generator.numbers(numRows, 60, 600);
+
+  for (auto _ : state)
+  {
+    auto transaction = db.beginTransaction();
+    for (auto i=0; i<numRows; ++i)
+    {
+      db.execQuery(INSERT_INTO(TableIds::Tracks)
+        .VALUE(TracksCols::Name, names.at(i))
+        .VALUE(TracksCols::Length, lengths.at(i)));
+    }
+    transaction.commit();
+  }
+
+  state.SetItemsProcessed(state.iterations() * numRows);
+  db.close();
+}
+
+/**
+ * @benchmark: Inserts rows with a single BatchInsertInto query.
+ */
+static void BM_BatchInsertInto(benchmark::State& state)
+{
+  const auto numRows = static_cast<int>(state.range(0));
+
+  QtSqlLib::Database db;
+  BenchmarkDatabase::setup(db);
+
+  DataGenerator generator;
+  const auto names = generator.texts(numRows, 16);
+  const auto lengths = generator.numbers(numRows, 60, 600);
+
+  for (auto _ : state)
+  {
+    db.execQuery(BATCH_INSERT_INTO(TableIds::Tracks)
+      .VALUES(TracksCols::Name, names)
+      .VALUES(TracksCols::Length, lengths));
+  }
+
+  state.SetItemsProcessed(state.iterations() * numRows);
+  db.close();
+}
+
+BENCHMARK(BM_InsertInto)->Arg(100)->Arg(1000)->Arg(10000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_BatchInsertInto)->Arg(100)->Arg(1000)->Arg(10000)->Unit(benchmark::kMillisecond);
+
+}
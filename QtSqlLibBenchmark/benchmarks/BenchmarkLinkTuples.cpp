@@ -0,0 +1,38 @@
+#include <benchmark/benchmark.h>
+
+#include <BenchmarkCommon.h>
+
+namespace QtSqlLibBenchmark
+{
+
+/**
+ * @benchmark: Links one album to a large number of tracks with LinkTuples::toMany().
+ *             The links are removed again between the iterations without being measured.
+ */
+static void BM_LinkTuplesToMany(benchmark::State& state)
+{
+  const auto numKeys = static_cast<int>(state.range(0));
+
+  QtSqlLib::Database db;
+  BenchmarkDatabase::setup(db);
+
+  DataGenerator generator;
+  const auto album = BenchmarkDatabase::insertAlbum(db, generator.nextText(32));
+  const auto tracks = BenchmarkDatabase::insertTracks(db, generator, numKeys);
+
+  for (auto _ : state)
+  {
+    db.execQuery(LINK_TUPLES(Relationships::AlbumTracks).FROM_ONE(album).TO_MANY(tracks));
+
+    state.PauseTiming();
+    db.execQuery(UNLINK_TUPLES(Relationships::AlbumTracks).FROM_ONE(album).TO_MANY(tracks));
+    state.ResumeTiming();
+  }
+
+  state.SetItemsProcessed(state.iterations() * numKeys);
+  db.close();
+}
+
+BENCHMARK(BM_LinkTuplesToMany)->Arg(10000)->Unit(benchmark::kMillisecond);
+
+}
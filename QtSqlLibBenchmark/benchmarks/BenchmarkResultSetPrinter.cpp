@@ -0,0 +1,40 @@
+#include <benchmark/benchmark.h>
+
+#include <BenchmarkCommon.h>
+
+namespace QtSqlLibBenchmark
+{
+
+/**
+ * @benchmark: Prints all lines of a large result set with the ResultSetPrinter.
+ */
+static void BM_ResultSetPrinter(benchmark::State& state)
+{
+  const auto numRows = static_cast<int>(state.range(0));
+
+  QtSqlLib::Database db;
+  BenchmarkDatabase::setup(db);
+
+  DataGenerator generator;
+  static_cast<void>(BenchmarkDatabase::insertTracks(db, generator, numRows));
+
+  size_t numLines = 0;
+  for (auto _ : state)
+  {
+    auto results = db.execQuery(FROM_TABLE(TableIds::Tracks).SELECT_ALL);
+    auto printer = db.createResultSetPrinter(results, 24);
+
+    while (!printer.isEndOfTable())
+    {
+      benchmark::DoNotOptimize(printer.nextPrinterLine());
+      numLines++;
+    }
+  }
+
+  state.SetItemsProcessed(static_cast<int64_t>(numLines));
+  db.close();
+}
+
+BENCHMARK(BM_ResultSetPrinter)->Arg(1000)->Arg(10000)->Unit(benchmark::kMillisecond);
+
+}
@@ -0,0 +1,54 @@
+#pragma once
+
+#include <Common.h>
+
+#include <QString>
+#include <QVariant>
+
+#include <random>
+#include <vector>
+
+namespace QtSqlLibBenchmark
+{
+
+using namespace QtSqlLibTest;
+
+class DataGenerator
+{
+public:
+  explicit DataGenerator(unsigned int seed = 42U);
+
+  QString nextText(int length);
+  int nextNumber(int min, int max);
+
+  QVariantList texts(int count, int length);
+  QVariantList numbers(int count, int min, int max);
+
+private:
+  std::mt19937 m_engine;
+
+};
+
+class BenchmarkDatabase
+{
+public:
+  BenchmarkDatabase() = delete;
+
+  static QString getDefaultDatabaseFilename();
+
+  static void setup(QtSqlLib::Database& db);
+
+  static QtSqlLib::PrimaryKey insertAlbum(QtSqlLib::Database& db, const QString& name);
+  static std::vector<QtSqlLib::PrimaryKey> insertTracks(QtSqlLib::Database& db, DataGenerator& generator, int count);
+  static std::vector<QtSqlLib::PrimaryKey> insertArtists(QtSqlLib::Database& db, DataGenerator& generator, int count);
+
+  static void populate(QtSqlLib::Database& db, int numAlbums, int numTracksPerAlbum, int numArtistsPerAlbum);
+
+  static size_t iterateResults(QtSqlLib::ResultSet& results);
+
+private:
+  static std::vector<QtSqlLib::PrimaryKey> takeLastPrimaryKeys(QtSqlLib::ResultSet& results, int count);
+
+};
+
+}
@@ -0,0 +1,183 @@
+#include "BenchmarkCommon.h"
+
+#include <QFile>
+
+namespace QtSqlLibBenchmark
+{
+
+static const QString s_characters = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789";
+
+DataGenerator::DataGenerator(unsigned int seed) :
+  m_engine(seed)
+{
+}
+
+QString DataGenerator::nextText(int length)
+{
+  std::uniform_int_distribution<int> distribution(0, s_characters.length() - 1);
+
+  QString text;
+  text.reserve(length);
+  for (auto i=0; i<length; ++i)
+  {
+    text.append(s_characters.at(distribution(m_engine)));
+  }
+  return text;
+}
+
+int DataGenerator::nextNumber(int min, int max)
+{
+  std::uniform_int_distribution<int> distribution(min, max);
+  return distribution(m_engine);
+}
+
+QVariantList DataGenerator::texts(int count, int length)
+{
+  QVariantList values;
+  values.reserve(count);
+  for (auto i=0; i<count; ++i)
+  {
+    values.append(nextText(length));
+  }
+  return values;
+}
+
+QVariantList DataGenerator::numbers(int count, int min, int max)
+{
+  QVariantList values;
+  values.reserve(count);
+  for (auto i=0; i<count; ++i)
+  {
+    values.append(nextNumber(min, max));
+  }
+  return values;
+}
+
+QString BenchmarkDatabase::getDefaultDatabaseFilename()
+{
+  return "benchmark.db";
+}
+
+void BenchmarkDatabase::setup(QtSqlLib::Database& db)
+{
+  QFile::remove(getDefaultDatabaseFilename());
+
+  SchemaConfigurator configurator;
+  configurator.CONFIGURE_TABLE(TableIds::Albums, "albums")
+    .COLUMN(AlbumsCols::Id, "id", DataType::Integer).PRIMARY_KEY.AUTO_INCREMENT.NOT_NULL
+    .COLUMN_VARCHAR(AlbumsCols::Name, "name", 128).NOT_NULL;
+
+  configurator.CONFIGURE_TABLE(TableIds::Artists, "artists")
+    .COLUMN(ArtistsCols::Id, "id", DataType::Integer).PRIMARY_KEY.AUTO_INCREMENT.NOT_NULL
+    .COLUMN_VARCHAR(ArtistsCols::Name, "name", 128).NOT_NULL;
+
+  configurator.CONFIGURE_TABLE(TableIds::Tracks, "tracks")
+    .COLUMN(TracksCols::Id, "id", DataType::Integer).PRIMARY_KEY.AUTO_INCREMENT.NOT_NULL
+    .COLUMN_VARCHAR(TracksCols::Name, "name", 128).NOT_NULL
+    .COLUMN(TracksCols::Length, "length", DataType::Integer).NOT_NULL
+    .COLUMN(TracksCols::Rating, "rating", DataType::Integer);
+
+  configurator.CONFIGURE_RELATIONSHIP(Relationships::AlbumTracks, TableIds::Albums, TableIds::Tracks,
+    QtSqlLib::API::RelationshipType::OneToMany).ENABLE_FOREIGN_KEY_INDEXING;
+
+  configurator.CONFIGURE_RELATIONSHIP(Relationships::AlbumArtists, TableIds::Albums, TableIds::Artists,
+    QtSqlLib::API::RelationshipType::ManyToMany).ENABLE_FOREIGN_KEY_INDEXING;
+
+  db.initialize(configurator, getDefaultDatabaseFilename());
+}
+
+QtSqlLib::PrimaryKey BenchmarkDatabase::insertAlbum(QtSqlLib::Database& db, const QString& name)
+{
+  return db.execQuery(INSERT_INTO_EXT(TableIds::Albums)
+    .VALUE(AlbumsCols::Name, name)
+    .RETURN_IDS).nextTuple().primaryKey();
+}
+
+std::vector<QtSqlLib::PrimaryKey> BenchmarkDatabase::insertTracks(
+  QtSqlLib::Database& db, DataGenerator& generator, int count)
+{
+  db.execQuery(BATCH_INSERT_INTO(TableIds::Tracks)
+    .VALUES(TracksCols::Name, generator.texts(count, 16))
+    .VALUES(TracksCols::Length, generator.numbers(count, 60, 600))
+    .VALUES(TracksCols::Rating, generator.numbers(count, 1, 5)));
+
+  auto results = db.execQuery(FROM_TABLE(TableIds::Tracks).SELECT(TracksCols::Id));
+  return takeLastPrimaryKeys(results, count);
+}
+
+std::vector<QtSqlLib::PrimaryKey> BenchmarkDatabase::insertArtists(
+  QtSqlLib::Database& db, DataGenerator& generator, int count)
+{
+  db.execQuery(BATCH_INSERT_INTO(TableIds::Artists)
+    .VALUES(ArtistsCols::Name, generator.texts(count, 24)));
+
+  auto results = db.execQuery(FROM_TABLE(TableIds::Artists).SELECT(ArtistsCols::Id));
+  return takeLastPrimaryKeys(results, count);
+}
+
+void BenchmarkDatabase::populate(QtSqlLib::Database& db, int numAlbums, int numTracksPerAlbum, int numArtistsPerAlbum)
+{
+  DataGenerator generator;
+
+  auto transaction = db.beginTransaction();
+
+  const auto artists = insertArtists(db, generator, std::max(numArtistsPerAlbum * 4, 1));
+
+  for (auto i=0; i<numAlbums; ++i)
+  {
+    const auto album = insertAlbum(db, generator.nextText(32));
+
+    const auto tracks = insertTracks(db, generator, numTracksPerAlbum);
+    db.execQuery(LINK_TUPLES(Relationships::AlbumTracks).FROM_ONE(album).TO_MANY(tracks));
+
+    std::vector<QtSqlLib::PrimaryKey> albumArtists;
+    const auto firstArtist = generator.nextNumber(0, static_cast<int>(artists.size()) - 1);
+    for (auto j=0; j<numArtistsPerAlbum; ++j)
+    {
+      albumArtists.emplace_back(artists.at((firstArtist + j) % artists.size()));
+    }
+
+    if (!albumArtists.empty())
+    {
+      db.execQuery(LINK_TUPLES(Relationships::AlbumArtists).FROM_ONE(album).TO_MANY(albumArtists));
+    }
+  }
+
+  transaction.commit();
+}
+
+size_t BenchmarkDatabase::iterateResults(QtSqlLib::ResultSet& results)
+{
+  size_t numTuples = 0;
+  while (results.hasNextTuple())
+  {
+    static_cast<void>(results.nextTuple());
+    numTuples++;
+
+    while (results.hasNextJoinedTuple())
+    {
+      static_cast<void>(results.nextJoinedTuple());
+      numTuples++;
+    }
+  }
+  return numTuples;
+}
+
+std::vector<QtSqlLib::PrimaryKey> BenchmarkDatabase::takeLastPrimaryKeys(QtSqlLib::ResultSet& results, int count)
+{
+  std::vector<QtSqlLib::PrimaryKey> keys;
+
+  // tuples are returned in rowid order, the most recently inserted ones are at the end
+  while (results.hasNextTuple())
+  {
+    keys.emplace_back(results.nextTuple().primaryKey());
+  }
+
+  if (static_cast<int>(keys.size()) > count)
+  {
+    keys.erase(keys.begin(), keys.end() - count);
+  }
+  return keys;
+}
+
+}
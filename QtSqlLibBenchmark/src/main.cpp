@@ -0,0 +1,44 @@
+#include <benchmark/benchmark.h>
+
+#include <QCoreApplication>
+#include <QtGlobal>
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <vector>
+
+static const char* s_defaultOutArgument = "--benchmark_out=QtSqlLibBenchmark.json";
+static const char* s_defaultOutFormatArgument = "--benchmark_out_format=json";
+
+int main(int argc, char** argv)
+{
+  QCoreApplication app(argc, argv);
+
+  // results are written as JSON by default, so that runs of different library versions can be compared
+  std::vector<char*> arguments(argv, argv + argc);
+  const auto hasOutArgument = std::any_of(arguments.cbegin(), arguments.cend(), [](const char* argument)
+  {
+    return std::strncmp(argument, "--benchmark_out=", std::strlen("--benchmark_out=")) == 0;
+  });
+
+  if (!hasOutArgument)
+  {
+    arguments.emplace_back(const_cast<char*>(s_defaultOutArgument));
+    arguments.emplace_back(const_cast<char*>(s_defaultOutFormatArgument));
+  }
+
+  auto numArguments = static_cast<int>(arguments.size());
+
+  benchmark::AddCustomContext("qt_version", qVersion());
+  benchmark::Initialize(&numArguments, arguments.data());
+  if (benchmark::ReportUnrecognizedArguments(numArguments, arguments.data()))
+  {
+    return 1;
+  }
+
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+
+  return 0;
+}
@@ -2,6 +2,7 @@
 
 #include <QtSqlLib/API/IID.h>
 #include <QtSqlLib/API/IIndexConfigurator.h>
+#include <QtSqlLib/API/IQueryObserver.h>
 #include <QtSqlLib/API/IQueryVisitor.h>
 #include <QtSqlLib/API/IRelationshipConfigurator.h>
 #include <QtSqlLib/API/ITableConfigurator.h>
@@ -10,9 +11,13 @@
 #include <QtSqlLib/ConcatenatedColumn.h>
 #include <QtSqlLib/Database.h>
 #include <QtSqlLib/DatabaseException.h>
+#include <QtSqlLib/DatabaseOptions.h>
 #include <QtSqlLib/Expr.h>
 #include <QtSqlLib/ID.h>
 #include <QtSqlLib/Query/BatchInsertInto.h>
+#include <QtSqlLib/Query/BatchInsertIntoExt.h>
+#include <QtSqlLib/Query/BatchUpdateTable.h>
+#include <QtSqlLib/Query/BatchUpsert.h>
 #include <QtSqlLib/Query/DeleteFrom.h>
 #include <QtSqlLib/Query/FromTable.h>
 #include <QtSqlLib/Query/InsertInto.h>
@@ -22,7 +27,9 @@
 #include <QtSqlLib/Query/QuerySequence.h>
 #include <QtSqlLib/Query/UnlinkTuples.h>
 #include <QtSqlLib/Query/UpdateTable.h>
+#include <QtSqlLib/Query/Upsert.h>
 #include <QtSqlLib/QueryIdentifiers.h>
+#include <QtSqlLib/QueryPlan.h>
 #include <QtSqlLib/ResultSet.h>
 #include <QtSqlLib/Schema.h>
 #include <QtSqlLib/SchemaConfigurator.h>
@@ -36,6 +43,7 @@ using BatchInsertInto = QtSqlLib::Query::BatchInsertInto;
 using ColumnStatistics = QtSqlLib::ColumnStatistics;
 using DataType = QtSqlLib::API::DataType;
 using DatabaseException = QtSqlLib::DatabaseException;
+using DatabaseOptions = QtSqlLib::DatabaseOptions;
 using DeleteFrom = QtSqlLib::Query::DeleteFrom;
 using Expr = QtSqlLib::Expr;
 using FromTable = QtSqlLib::Query::FromTable;
@@ -142,6 +150,22 @@ enum class Relationships
   Special6
 };
 
+class RecordingQueryObserver : public QtSqlLib::API::IQueryObserver
+{
+public:
+  void onQueryExecuted(const QueryExecution& execution) override;
+  void onResultIterationFinished(const ResultIteration& iteration) override;
+
+  std::vector<QueryExecution> executionsExcept(const QString& queryPrefix) const;
+  size_t numExecutions(const QString& queryPrefix) const;
+  uint64_t numRowsFetched() const;
+  void clear();
+
+  std::vector<QueryExecution> executions;
+  std::vector<ResultIteration> iterations;
+
+};
+
 class Funcs
 {
 public:
@@ -151,6 +175,11 @@ public:
 
   static size_t numResults(QtSqlLib::ResultSet& results);
 
+  static void configureAlbumsSchema(SchemaConfigurator& configurator);
+
+  // artist1 is linked to album1 (track1, track2) and album2 (track3), artist2 is linked to album1
+  static void insertArtistsAlbumsTracks(QtSqlLib::Database& db);
+
   static bool isResultTuplesContaining(
     QtSqlLib::ResultSet& results,
     IID::Type tableId, IID::Type columnId, QVariant value);
@@ -0,0 +1,134 @@
+#include <gtest/gtest.h>
+
+#include <Common.h>
+
+#include <QFile>
+
+#include <future>
+#include <set>
+#include <vector>
+
+namespace QtSqlLibTest
+{
+
+class TestAsyncQueries : public testing::Test
+{
+public:
+  TestAsyncQueries()
+  {
+    QFile::remove(Funcs::getDefaultDatabaseFilename());
+  }
+
+  ~TestAsyncQueries() override
+  {
+    m_db.close();
+  }
+
+  QtSqlLib::Database m_db;
+
+};
+
+/**
+ * @test: Inserts some tuples asynchronously and then queries them with multiple asynchronous queries in flight.
+ * @expected: No exceptions occur.
+ *            Each future delivers a row block containing all inserted tuples, which can be read in the calling
+ *            thread. The executor uses connections of its own, no connection pool is configured implicitly.
+ */
+TEST_F(TestAsyncQueries, insertAndReadAsync)
+{
+  SchemaConfigurator configurator;
+  configurator.CONFIGURE_TABLE(TableIds::Table1, "table1")
+    .COLUMN(Table1Cols::Id, "id", DataType::Integer).PRIMARY_KEY.AUTO_INCREMENT.NOT_NULL
+    .COLUMN_VARCHAR(Table1Cols::Text, "text", 128)
+    .COLUMN(Table1Cols::Number, "number", DataType::Integer);
+
+  m_db.setNumAsyncExecutorThreads(2);
+  m_db.initialize(configurator, Funcs::getDefaultDatabaseFilename());
+
+  auto insertQuery = std::make_unique<BatchInsertInto>(QtSqlLib::ID(TableIds::Table1));
+  insertQuery->VALUES(Table1Cols::Text, QVariantList() << "value1" << "value2" << "value3")
+    .VALUES(Table1Cols::Number, QVariantList() << 1 << 2 << 3);
+
+  m_db.execQueryAsync(std::move(insertQuery)).get();
+
+  std::vector<std::future<QtSqlLib::RowBlock>> futures;
+  for (auto i = 0; i < 4; i++)
+  {
+    auto selectQuery = std::make_unique<FromTable>(QtSqlLib::ID(TableIds::Table1));
+    selectQuery->SELECT(Table1Cols::Text, Table1Cols::Number);
+
+    futures.emplace_back(m_db.execQueryAsync(std::move(selectQuery)));
+  }
+
+  for (auto& future : futures)
+  {
+    const auto block = future.get();
+
+    std::set<QString> texts;
+    for (size_t i=0; i<block.size(); ++i)
+    {
+      texts.insert(block.row(i).columnValue(Table1Cols::Text).toString());
+    }
+
+    EXPECT_EQ(block.numTuples(), 3);
+    EXPECT_EQ(texts, std::set<QString>({ "value1", "value2", "value3" }));
+  }
+
+  EXPECT_EQ(m_db.getConnectionPoolSize(), 0);
+}
+
+/**
+ * @test: Executes an asynchronous query with split joins and an asynchronous streaming query.
+ * @expected: The rows of both queries are fetched entirely by the executor thread, including the joined tuples of
+ *            the split join queries.
+ */
+TEST_F(TestAsyncQueries, splitJoinsAndStreamingAsync)
+{
+  SchemaConfigurator configurator;
+  Funcs::configureAlbumsSchema(configurator);
+
+  m_db.initialize(configurator, Funcs::getDefaultDatabaseFilename());
+
+  const auto albumKey = m_db.execQuery(INSERT_INTO_EXT(TableIds::Albums)
+    .VALUE(AlbumsCols::Name, "album")
+    .RETURN_IDS).nextTuple().primaryKey();
+
+  for (auto i=0; i<3; ++i)
+  {
+    m_db.execQuery(INSERT_INTO_EXT(TableIds::Tracks)
+      .VALUE(TracksCols::Name, QString("track%1").arg(i))
+      .LINK_TO_ONE_TUPLE(Relationships::AlbumTracks, albumKey));
+  }
+
+  auto splitJoinQuery = std::make_unique<FromTable>(QtSqlLib::ID(TableIds::Albums));
+  splitJoinQuery->SELECT_ALL.JOIN_ALL(Relationships::AlbumTracks).SPLIT_JOINS;
+
+  auto streamingQuery = std::make_unique<FromTable>(QtSqlLib::ID(TableIds::Tracks));
+  streamingQuery->SELECT_ALL.STREAMING;
+
+  const auto splitJoinBlock = m_db.execQueryAsync(std::move(splitJoinQuery)).get();
+  const auto streamingBlock = m_db.execQueryAsync(std::move(streamingQuery)).get();
+
+  EXPECT_EQ(splitJoinBlock.numTuples(), 1);
+  EXPECT_EQ(splitJoinBlock.size(), 4);
+  EXPECT_EQ(streamingBlock.numTuples(), 3);
+}
+
+/**
+ * @test: Executes an asynchronous query that refers to an invalid table id.
+ * @expected: The exception is forwarded through the future.
+ */
+TEST_F(TestAsyncQueries, exceptionForwarded)
+{
+  SchemaConfigurator configurator;
+  configurator.CONFIGURE_TABLE(TableIds::Table1, "table1")
+    .COLUMN(Table1Cols::Id, "id", DataType::Integer).PRIMARY_KEY.AUTO_INCREMENT.NOT_NULL;
+
+  m_db.initialize(configurator, Funcs::getDefaultDatabaseFilename());
+
+  auto future = m_db.execQueryAsync(std::make_unique<FromTable>(QtSqlLib::ID(TableIds::Table2)));
+
+  EXPECT_THROW(future.get(), DatabaseException);
+}
+
+}
@@ -97,6 +97,63 @@ TEST_F(TestBasicQueries, insertAndRead)
   }
 }
 
+/**
+ * @test: Inserts a tuple with integer, real, text and blob values, where one column is null, and reads them with
+ *        the typed column accessors of the TupleView.
+ * @expected: The typed accessors deliver the inserted values.
+ *            Null and not selected columns are recognized and deliver default values.
+ */
+TEST_F(TestBasicQueries, typedColumnAccessors)
+{
+  SchemaConfigurator configurator;
+  configurator.CONFIGURE_TABLE(TableIds::Table1, "table1")
+    .COLUMN(Table1Cols::Id, "id", DataType::Integer).PRIMARY_KEY.AUTO_INCREMENT.NOT_NULL
+    .COLUMN_VARCHAR(Table1Cols::Text, "text", 128)
+    .COLUMN(Table1Cols::Number, "number", DataType::Real)
+    .COLUMN(Table1Cols::Mandatory, "mandatory", DataType::Blob);
+
+  m_db.initialize(configurator, Funcs::getDefaultDatabaseFilename());
+
+  m_db.execQuery(INSERT_INTO(TableIds::Table1)
+    .VALUE(Table1Cols::Text, "test")
+    .VALUE(Table1Cols::Number, 0.5)
+    .VALUE(Table1Cols::Mandatory, QByteArray("blob")));
+
+  m_db.execQuery(INSERT_INTO(TableIds::Table1)
+    .VALUE(Table1Cols::Number, 1.5));
+
+  auto results = m_db.execQuery(FROM_TABLE(TableIds::Table1)
+    .SELECT(Table1Cols::Id, Table1Cols::Text, Table1Cols::Number, Table1Cols::Mandatory)
+    .ORDER_BY(Table1Cols::Id));
+
+  ASSERT_TRUE(results.hasNextTuple());
+  const auto tuple1 = results.nextTuple();
+
+  EXPECT_EQ(tuple1.int64At(Table1Cols::Id), 1);
+  EXPECT_EQ(tuple1.textAt(Table1Cols::Text), "test");
+  EXPECT_DOUBLE_EQ(tuple1.doubleAt(Table1Cols::Number), 0.5);
+  EXPECT_EQ(tuple1.blobAt(Table1Cols::Mandatory), QByteArray("blob"));
+  EXPECT_FALSE(tuple1.isNullAt(Table1Cols::Text));
+
+  ASSERT_TRUE(results.hasNextTuple());
+  const auto tuple2 = results.nextTuple();
+
+  EXPECT_EQ(tuple2.int64At(Table1Cols::Id), 2);
+  EXPECT_TRUE(tuple2.isNullAt(Table1Cols::Text));
+  EXPECT_TRUE(tuple2.textAt(Table1Cols::Text).isEmpty());
+  EXPECT_DOUBLE_EQ(tuple2.doubleAt(Table1Cols::Number), 1.5);
+
+  auto partialResults = m_db.execQuery(FROM_TABLE(TableIds::Table1)
+    .SELECT(Table1Cols::Text));
+
+  ASSERT_TRUE(partialResults.hasNextTuple());
+  const auto tuple3 = partialResults.nextTuple();
+
+  EXPECT_FALSE(tuple3.hasColumnValue(Table1Cols::Number));
+  EXPECT_TRUE(tuple3.isNullAt(Table1Cols::Number));
+  EXPECT_EQ(tuple3.int64At(Table1Cols::Number), 0);
+}
+
 /**
  * @test: Creates a single table and inserts some values, then updates a single value with UpdateTable.
  * @expected: No exceptions occur.
@@ -0,0 +1,247 @@
+#include <gtest/gtest.h>
+
+#include <Common.h>
+
+#include <QFile>
+
+#include <map>
+
+namespace QtSqlLibTest
+{
+
+class TestBatchInsertIntoExt : public testing::Test
+{
+public:
+  TestBatchInsertIntoExt()
+  {
+    QFile::remove(Funcs::getDefaultDatabaseFilename());
+  }
+
+  ~TestBatchInsertIntoExt() override
+  {
+    m_db.close();
+  }
+
+  void setupAlbumsTracksArtists()
+  {
+    SchemaConfigurator configurator;
+    Funcs::configureAlbumsSchema(configurator);
+
+    m_db.initialize(configurator, Funcs::getDefaultDatabaseFilename());
+
+    m_db.execQuery(BATCH_INSERT_INTO(TableIds::Tracks)
+      .VALUES(TracksCols::Name, QVariantList() << "track1" << "track2" << "track3" << "track4"));
+
+    m_db.execQuery(BATCH_INSERT_INTO(TableIds::Artists)
+      .VALUES(ArtistsCols::Name, QVariantList() << "artist1" << "artist2" << "artist3"));
+  }
+
+  template <typename TTableId, typename TColumnId>
+  static QtSqlLib::PrimaryKey key(TTableId tableId, TColumnId columnId, int id)
+  {
+    return QtSqlLib::PrimaryKey(static_cast<IID::Type>(tableId),
+      { QtSqlLib::PrimaryKey::ColumnValue { static_cast<IID::Type>(columnId), id } });
+  }
+
+  void expectAlbumRelations()
+  {
+    auto artistResults = m_db.execQuery(FROM_TABLE(TableIds::Albums)
+      .SELECT_ALL
+      .JOIN_ALL(Relationships::AlbumArtists));
+
+    Funcs::expectRelations(artistResults, Relationships::AlbumArtists,
+      TableIds::Albums, AlbumsCols::Name, TableIds::Artists, ArtistsCols::Name,
+      "album1", QVariantList() << "artist1" << "artist2");
+
+    Funcs::expectRelations(artistResults, Relationships::AlbumArtists,
+      TableIds::Albums, AlbumsCols::Name, TableIds::Artists, ArtistsCols::Name,
+      "album2", QVariantList() << "artist3");
+
+    auto trackResults = m_db.execQuery(FROM_TABLE(TableIds::Albums)
+      .SELECT_ALL
+      .JOIN_ALL(Relationships::AlbumTracks));
+
+    Funcs::expectRelations(trackResults, Relationships::AlbumTracks,
+      TableIds::Albums, AlbumsCols::Name, TableIds::Tracks, TracksCols::Name,
+      "album1", QVariantList() << "track1" << "track2");
+
+    Funcs::expectRelations(trackResults, Relationships::AlbumTracks,
+      TableIds::Albums, AlbumsCols::Name, TableIds::Tracks, TracksCols::Name,
+      "album2", QVariantList() << "track3");
+  }
+
+  QtSqlLib::Database m_db;
+
+};
+
+/**
+ * @test: Inserts two albums with explicit ids, links them to many artists (ManyToMany) and many tracks (OneToMany).
+ * @expected: The albums, the link table rows and the foreign keys of the tracks are written by three batch queries.
+ */
+TEST_F(TestBatchInsertIntoExt, linkRowsWithKnownKeys)
+{
+  setupAlbumsTracksArtists();
+
+  auto observer = std::make_shared<RecordingQueryObserver>();
+  m_db.registerQueryObserver(observer);
+
+  m_db.execQuery(BATCH_INSERT_INTO_EXT(TableIds::Albums)
+    .VALUES(AlbumsCols::Id, QVariantList() << 10 << 20)
+    .VALUES(AlbumsCols::Name, QVariantList() << "album1" << "album2")
+    .LINK_TO_MANY_TUPLES(Relationships::AlbumArtists, {
+      { key(TableIds::Artists, ArtistsCols::Id, 1), key(TableIds::Artists, ArtistsCols::Id, 2) },
+      { key(TableIds::Artists, ArtistsCols::Id, 3) } })
+    .LINK_TO_MANY_TUPLES(Relationships::AlbumTracks, {
+      { key(TableIds::Tracks, TracksCols::Id, 1), key(TableIds::Tracks, TracksCols::Id, 2) },
+      { key(TableIds::Tracks, TracksCols::Id, 3) } }));
+
+  m_db.unregisterQueryObserver(observer);
+
+  const auto executions = observer->executionsExcept("SELECT");
+  ASSERT_EQ(executions.size(), 3);
+  EXPECT_TRUE(executions[0].isBatch);
+  EXPECT_TRUE(executions[1].isBatch);
+  EXPECT_TRUE(executions[2].isBatch);
+
+  expectAlbumRelations();
+}
+
+/**
+ * @test: Inserts three tracks, each linked to one album (OneToMany, child side).
+ * @expected: The tracks are inserted by a single batch query containing the foreign keys of their albums.
+ */
+TEST_F(TestBatchInsertIntoExt, linkToOneTuplePerRow)
+{
+  setupAlbumsTracksArtists();
+
+  m_db.execQuery(BATCH_INSERT_INTO(TableIds::Albums)
+    .VALUES(AlbumsCols::Name, QVariantList() << "album1" << "album2"));
+
+  auto observer = std::make_shared<RecordingQueryObserver>();
+  m_db.registerQueryObserver(observer);
+
+  m_db.execQuery(BATCH_INSERT_INTO_EXT(TableIds::Tracks)
+    .VALUES(TracksCols::Name, QVariantList() << "track5" << "track6" << "track7")
+    .LINK_TO_ONE_TUPLE(Relationships::AlbumTracks, std::vector<QtSqlLib::PrimaryKey>({
+      key(TableIds::Albums, AlbumsCols::Id, 1),
+      key(TableIds::Albums, AlbumsCols::Id, 2),
+      key(TableIds::Albums, AlbumsCols::Id, 1) })));
+
+  m_db.unregisterQueryObserver(observer);
+
+  const auto executions = observer->executionsExcept("SELECT");
+  ASSERT_EQ(executions.size(), 1);
+  EXPECT_TRUE(executions[0].isBatch);
+
+  auto results = m_db.execQuery(FROM_TABLE(TableIds::Albums)
+    .SELECT_ALL
+    .JOIN_ALL(Relationships::AlbumTracks));
+
+  Funcs::expectRelations(results, Relationships::AlbumTracks,
+    TableIds::Albums, AlbumsCols::Name, TableIds::Tracks, TracksCols::Name,
+    "album1", QVariantList() << "track5" << "track7");
+
+  Funcs::expectRelations(results, Relationships::AlbumTracks,
+    TableIds::Albums, AlbumsCols::Name, TableIds::Tracks, TracksCols::Name,
+    "album2", QVariantList() << "track6");
+
+  EXPECT_THROW(m_db.execQuery(BATCH_INSERT_INTO_EXT(TableIds::Tracks)
+    .VALUES(TracksCols::Name, QVariantList() << "track8" << "track9")
+    .LINK_TO_ONE_TUPLE(Relationships::AlbumTracks, std::vector<QtSqlLib::PrimaryKey>({
+      key(TableIds::Albums, AlbumsCols::Id, 1) }))), DatabaseException);
+}
+
+/**
+ * @test: Inserts and deletes an album. Inserts two albums without ids and links them to many artists and tracks.
+ * @expected: The ids of the albums are assigned by the batch insert query following the greatest id ever used and
+ *            used for the link table rows and the foreign keys of the tracks.
+ */
+TEST_F(TestBatchInsertIntoExt, linkRowsWithGeneratedKeys)
+{
+  setupAlbumsTracksArtists();
+
+  m_db.execQuery(BATCH_INSERT_INTO(TableIds::Albums)
+    .VALUES(AlbumsCols::Name, QVariantList() << "album0"));
+  m_db.execQuery(DELETE_FROM(TableIds::Albums)
+    .WHERE(EQUAL(AlbumsCols::Name, "album0")));
+
+  auto observer = std::make_shared<RecordingQueryObserver>();
+  m_db.registerQueryObserver(observer);
+
+  m_db.execQuery(BATCH_INSERT_INTO_EXT(TableIds::Albums)
+    .VALUES(AlbumsCols::Name, QVariantList() << "album1" << "album2")
+    .LINK_TO_MANY_TUPLES(Relationships::AlbumArtists, {
+      { key(TableIds::Artists, ArtistsCols::Id, 1), key(TableIds::Artists, ArtistsCols::Id, 2) },
+      { key(TableIds::Artists, ArtistsCols::Id, 3) } })
+    .LINK_TO_MANY_TUPLES(Relationships::AlbumTracks, {
+      { key(TableIds::Tracks, TracksCols::Id, 1), key(TableIds::Tracks, TracksCols::Id, 2) },
+      { key(TableIds::Tracks, TracksCols::Id, 3) } }));
+
+  m_db.unregisterQueryObserver(observer);
+
+  const auto executions = observer->executionsExcept("SELECT");
+  ASSERT_EQ(executions.size(), 3);
+  EXPECT_TRUE(executions[0].isBatch);
+  EXPECT_FALSE(executions[0].sqlQuery.contains("RETURNING"));
+
+  std::map<QString, int> albumIds;
+  auto results = m_db.execQuery(FROM_TABLE(TableIds::Albums).SELECT_ALL);
+  while (results.hasNextTuple())
+  {
+    const auto tuple = results.nextTuple();
+    albumIds[tuple.columnValue(AlbumsCols::Name).toString()] = tuple.columnValue(AlbumsCols::Id).toInt();
+  }
+  EXPECT_EQ(albumIds, (std::map<QString, int>({ { "album1", 2 }, { "album2", 3 } })));
+
+  expectAlbumRelations();
+}
+
+/**
+ * @test: Inserts 20000 albums without ids (more than 32766 bound values) and links each of them to an artist.
+ * @expected: The albums and the link table rows are written by two batch queries and every album is linked to its
+ *            artist.
+ */
+TEST_F(TestBatchInsertIntoExt, linkManyRowsWithGeneratedKeys)
+{
+  setupAlbumsTracksArtists();
+
+  const auto numAlbums = 20000;
+
+  QVariantList albumNames;
+  std::vector<std::vector<QtSqlLib::PrimaryKey>> artistKeys;
+  for (auto i=0; i<numAlbums; ++i)
+  {
+    albumNames << QString("album%1").arg(i);
+    artistKeys.push_back({ key(TableIds::Artists, ArtistsCols::Id, (i % 3) + 1) });
+  }
+
+  auto observer = std::make_shared<RecordingQueryObserver>();
+  m_db.registerQueryObserver(observer);
+
+  m_db.execQuery(BATCH_INSERT_INTO_EXT(TableIds::Albums)
+    .VALUES(AlbumsCols::Name, albumNames)
+    .LINK_TO_MANY_TUPLES(Relationships::AlbumArtists, artistKeys));
+
+  m_db.unregisterQueryObserver(observer);
+
+  const auto executions = observer->executionsExcept("SELECT");
+  ASSERT_EQ(executions.size(), 2);
+  EXPECT_TRUE(executions[0].isBatch);
+  EXPECT_TRUE(executions[1].isBatch);
+
+  auto results = m_db.execQuery(FROM_TABLE(TableIds::Albums)
+    .SELECT_ALL
+    .JOIN_ALL(Relationships::AlbumArtists));
+
+  EXPECT_EQ(Funcs::numResults(results), static_cast<size_t>(numAlbums));
+
+  Funcs::expectRelations(results, Relationships::AlbumArtists,
+    TableIds::Albums, AlbumsCols::Name, TableIds::Artists, ArtistsCols::Name,
+    "album0", QVariantList() << "artist1");
+
+  Funcs::expectRelations(results, Relationships::AlbumArtists,
+    TableIds::Albums, AlbumsCols::Name, TableIds::Artists, ArtistsCols::Name,
+    "album19999", QVariantList() << "artist2");
+}
+
+}
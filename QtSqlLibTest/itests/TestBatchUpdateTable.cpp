@@ -0,0 +1,218 @@
+#include <gtest/gtest.h>
+
+#include <Common.h>
+
+#include <QFile>
+
+#include <map>
+
+namespace QtSqlLibTest
+{
+
+class TestBatchUpdateTable : public testing::Test
+{
+public:
+  TestBatchUpdateTable()
+  {
+    QFile::remove(Funcs::getDefaultDatabaseFilename());
+  }
+
+  ~TestBatchUpdateTable() override
+  {
+    m_db.close();
+  }
+
+  void updateRows(bool isUsingStagingTable);
+
+  QtSqlLib::Database m_db;
+
+};
+
+void TestBatchUpdateTable::updateRows(bool isUsingStagingTable)
+{
+  SchemaConfigurator configurator;
+  configurator.CONFIGURE_TABLE(TableIds::Table1, "table1")
+    .COLUMN(Table1Cols::Id, "id", DataType::Integer).PRIMARY_KEY.NOT_NULL
+    .COLUMN_VARCHAR(Table1Cols::Text, "text", 128)
+    .COLUMN(Table1Cols::Number, "number", DataType::Integer);
+
+  m_db.initialize(configurator, Funcs::getDefaultDatabaseFilename());
+
+  const auto numTuples = 1000;
+
+  QVariantList ids;
+  QVariantList texts;
+  QVariantList numbers;
+  for (auto i=0; i<numTuples + 1; ++i)
+  {
+    ids << i;
+    texts << "unchanged";
+    numbers << 0;
+  }
+
+  m_db.execQuery(BATCH_INSERT_INTO(TableIds::Table1)
+    .VALUES(Table1Cols::Id, ids)
+    .VALUES(Table1Cols::Text, texts)
+    .VALUES(Table1Cols::Number, numbers));
+
+  QVariantList updateIds;
+  QVariantList updateTexts;
+  QVariantList updateNumbers;
+  for (auto i=0; i<numTuples; ++i)
+  {
+    updateIds << i;
+    updateTexts << QString("text%1").arg(i);
+    updateNumbers << i * 2;
+  }
+
+  updateIds << 5;
+  updateTexts << "duplicate";
+  updateNumbers << -1;
+
+  QtSqlLib::Query::BatchUpdateTable query(QtSqlLib::ID(TableIds::Table1));
+  query.KEY_VALUES(Table1Cols::Id, updateIds)
+    .VALUES(Table1Cols::Text, updateTexts)
+    .VALUES(Table1Cols::Number, updateNumbers);
+
+  if (isUsingStagingTable)
+  {
+    query.USE_STAGING_TABLE;
+  }
+
+  m_db.execQuery(query);
+
+  std::map<int, std::pair<QString, int>> tuples;
+  auto results = m_db.execQuery(FROM_TABLE(TableIds::Table1).SELECT_ALL);
+  while (results.hasNextTuple())
+  {
+    const auto tuple = results.nextTuple();
+    tuples[tuple.columnValue(Table1Cols::Id).toInt()] = {
+      tuple.columnValue(Table1Cols::Text).toString(),
+      tuple.columnValue(Table1Cols::Number).toInt() };
+  }
+
+  ASSERT_EQ(tuples.size(), numTuples + 1);
+  EXPECT_EQ(tuples.at(0), std::make_pair(QString("text0"), 0));
+  EXPECT_EQ(tuples.at(999), std::make_pair(QString("text999"), 1998));
+  EXPECT_EQ(tuples.at(5), std::make_pair(QString("duplicate"), -1));
+  EXPECT_EQ(tuples.at(numTuples), std::make_pair(QString("unchanged"), 0));
+
+  EXPECT_THROW(m_db.execQuery(BATCH_UPDATE_TABLE(TableIds::Table1)
+    .KEY_VALUES(Table1Cols::Id, QVariantList() << 1 << 2)
+    .VALUES(Table1Cols::Number, QVariantList() << 1)), DatabaseException);
+}
+
+/**
+ * @test: Updates 1000 tuples to different values by one batch update query. The key of one tuple is contained twice.
+ * @expected: Each tuple contains the value of its row, the tuple with the duplicate key contains the value of the
+ *            last row. Tuples without a row are not changed.
+ */
+TEST_F(TestBatchUpdateTable, updateRows)
+{
+  updateRows(false);
+}
+
+/**
+ * @test: Updates 1000 tuples to different values by one batch update query using a staging table. The key of one
+ *        tuple is contained twice.
+ * @expected: Each tuple contains the value of its row, the tuple with the duplicate key contains the value of the
+ *            last row. Tuples without a row are not changed.
+ */
+TEST_F(TestBatchUpdateTable, updateRowsWithStagingTable)
+{
+  updateRows(true);
+}
+
+/**
+ * @test: Updates tuples using a staging table, where the update statement fails due to a unique constraint.
+ *        Updates the tuples a second time using a staging table.
+ * @expected: The first update throws an exception and leaves the tuples unchanged. The second update is not affected
+ *            by the failed one and updates the tuples.
+ */
+TEST_F(TestBatchUpdateTable, stagingTableAfterFailedUpdate)
+{
+  SchemaConfigurator configurator;
+  configurator.CONFIGURE_TABLE(TableIds::Table1, "table1")
+    .COLUMN(Table1Cols::Id, "id", DataType::Integer).PRIMARY_KEY.NOT_NULL
+    .COLUMN_VARCHAR(Table1Cols::Text, "text", 128)
+    .COLUMN(Table1Cols::Number, "number", DataType::Integer);
+
+  m_db.initialize(configurator, Funcs::getDefaultDatabaseFilename());
+
+  m_db.execQuery(BATCH_INSERT_INTO(TableIds::Table1)
+    .VALUES(Table1Cols::Id, QVariantList() << 1 << 2)
+    .VALUES(Table1Cols::Text, QVariantList() << "a" << "b")
+    .VALUES(Table1Cols::Number, QVariantList() << 1 << 2));
+
+  EXPECT_THROW(m_db.execQuery(BATCH_UPDATE_TABLE(TableIds::Table1)
+    .KEY_VALUES(Table1Cols::Text, QVariantList() << "a")
+    .VALUES(Table1Cols::Id, QVariantList() << 2)
+    .USE_STAGING_TABLE), DatabaseException);
+
+  m_db.execQuery(BATCH_UPDATE_TABLE(TableIds::Table1)
+    .KEY_VALUES(Table1Cols::Id, QVariantList() << 1 << 2)
+    .VALUES(Table1Cols::Number, QVariantList() << 10 << 20)
+    .USE_STAGING_TABLE);
+
+  std::map<int, std::pair<QString, int>> tuples;
+  auto results = m_db.execQuery(FROM_TABLE(TableIds::Table1).SELECT_ALL);
+  while (results.hasNextTuple())
+  {
+    const auto tuple = results.nextTuple();
+    tuples[tuple.columnValue(Table1Cols::Id).toInt()] = {
+      tuple.columnValue(Table1Cols::Text).toString(),
+      tuple.columnValue(Table1Cols::Number).toInt() };
+  }
+
+  ASSERT_EQ(tuples.size(), 2);
+  EXPECT_EQ(tuples.at(1), std::make_pair(QString("a"), 10));
+  EXPECT_EQ(tuples.at(2), std::make_pair(QString("b"), 20));
+}
+
+/**
+ * @test: Caches a select statement and updates tuples using a staging table. Executes the select query again.
+ * @expected: Creating and dropping the staging table does not invalidate the statement cache, so the second select
+ *            query is a cache hit.
+ */
+TEST_F(TestBatchUpdateTable, stagingTableKeepsCachedStatements)
+{
+  SchemaConfigurator configurator;
+  configurator.CONFIGURE_TABLE(TableIds::Table1, "table1")
+    .COLUMN(Table1Cols::Id, "id", DataType::Integer).PRIMARY_KEY.NOT_NULL
+    .COLUMN_VARCHAR(Table1Cols::Text, "text", 128)
+    .COLUMN(Table1Cols::Number, "number", DataType::Integer);
+
+  m_db.initialize(configurator, Funcs::getDefaultDatabaseFilename());
+
+  m_db.execQuery(BATCH_INSERT_INTO(TableIds::Table1)
+    .VALUES(Table1Cols::Id, QVariantList() << 1 << 2)
+    .VALUES(Table1Cols::Text, QVariantList() << "a" << "b")
+    .VALUES(Table1Cols::Number, QVariantList() << 1 << 2));
+
+  const auto execSelectQuery = [this]()
+  {
+    auto results = m_db.execQuery(FROM_TABLE(TableIds::Table1)
+      .SELECT(Table1Cols::Number)
+      .WHERE(EQUAL(Table1Cols::Id, 1)));
+
+    EXPECT_EQ(Funcs::numResults(results), 1U);
+  };
+
+  execSelectQuery();
+
+  m_db.execQuery(BATCH_UPDATE_TABLE(TableIds::Table1)
+    .KEY_VALUES(Table1Cols::Id, QVariantList() << 1 << 2)
+    .VALUES(Table1Cols::Number, QVariantList() << 10 << 20)
+    .USE_STAGING_TABLE);
+
+  const auto initialStatistics = m_db.getStatementCacheStatistics();
+  EXPECT_GT(initialStatistics.numCachedStatements, 0U);
+
+  execSelectQuery();
+
+  const auto statistics = m_db.getStatementCacheStatistics();
+  EXPECT_EQ(statistics.hits, initialStatistics.hits + 1);
+  EXPECT_EQ(statistics.misses, initialStatistics.misses);
+}
+
+}
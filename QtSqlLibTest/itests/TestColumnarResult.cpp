@@ -0,0 +1,259 @@
+#include <gtest/gtest.h>
+
+#include <Common.h>
+
+#include <QtSqlLib/ColumnKernels.h>
+
+#include <QFile>
+
+#include <algorithm>
+#include <map>
+
+namespace QtSqlLibTest
+{
+
+using ColumnBuffer = QtSqlLib::ColumnBuffer;
+using ColumnKernels = QtSqlLib::ColumnKernels;
+
+class TestColumnarResult : public testing::Test
+{
+public:
+  TestColumnarResult()
+  {
+    QFile::remove(Funcs::getDefaultDatabaseFilename());
+  }
+
+  ~TestColumnarResult() override
+  {
+    m_db.close();
+  }
+
+  void setupAlbumTracks()
+  {
+    SchemaConfigurator configurator;
+    configurator.CONFIGURE_TABLE(TableIds::Albums, "albums")
+      .COLUMN(AlbumsCols::Id, "id", DataType::Integer).PRIMARY_KEY.AUTO_INCREMENT.NOT_NULL
+      .COLUMN_VARCHAR(AlbumsCols::Name, "name", 128).NOT_NULL;
+
+    configurator.CONFIGURE_TABLE(TableIds::Tracks, "tracks")
+      .COLUMN(TracksCols::Id, "id", DataType::Integer).PRIMARY_KEY.AUTO_INCREMENT.NOT_NULL
+      .COLUMN_VARCHAR(TracksCols::Name, "name", 128).NOT_NULL
+      .COLUMN(TracksCols::Length, "length", DataType::Real).NOT_NULL
+      .COLUMN(TracksCols::Rating, "rating", DataType::Integer);
+
+    configurator.CONFIGURE_RELATIONSHIP(Relationships::AlbumTracks, TableIds::Albums, TableIds::Tracks,
+      QtSqlLib::API::RelationshipType::OneToMany);
+
+    m_db.initialize(configurator, Funcs::getDefaultDatabaseFilename());
+
+    m_db.execQuery(BATCH_INSERT_INTO(TableIds::Albums)
+      .VALUES(AlbumsCols::Name, QVariantList() << "album1" << "album2"));
+
+    m_db.execQuery(BATCH_INSERT_INTO(TableIds::Tracks)
+      .VALUES(TracksCols::Name, QVariantList() << "track1" << "track2" << "track3" << "track4")
+      .VALUES(TracksCols::Length, QVariantList() << 120.5 << 200.0 << 90.25 << 300.0)
+      .VALUES(TracksCols::Rating, QVariantList() << 3 << QVariant() << 5 << 1));
+  }
+
+  QtSqlLib::Database m_db;
+
+};
+
+/**
+ * @test: Materializes the results of a query with integer, real, text and nullable columns in columnar buffers.
+ * @expected: Each column buffer has the expected type, values and null flags.
+ */
+TEST_F(TestColumnarResult, materializeColumns)
+{
+  setupAlbumTracks();
+
+  auto results = m_db.execQuery(FROM_TABLE(TableIds::Tracks)
+    .SELECT(TracksCols::Name, TracksCols::Length, TracksCols::Rating)
+    .ORDER_BY(TracksCols::Id));
+
+  const auto columnar = results.toColumnar();
+  const auto& tracks = columnar.tuples();
+
+  ASSERT_EQ(tracks.numRows(), 4);
+
+  const auto& names = tracks.column(TracksCols::Name);
+  EXPECT_EQ(names.type(), ColumnBuffer::Type::Text);
+  EXPECT_EQ(names.textAt(0), "track1");
+  EXPECT_EQ(names.textAt(3), "track4");
+  EXPECT_EQ(names.offsets().size(), 5);
+
+  const auto& lengths = tracks.column(TracksCols::Length);
+  EXPECT_EQ(lengths.type(), ColumnBuffer::Type::Double);
+  EXPECT_DOUBLE_EQ(lengths.doubleAt(2), 90.25);
+
+  const auto& ratings = tracks.column(TracksCols::Rating);
+  EXPECT_EQ(ratings.type(), ColumnBuffer::Type::Int64);
+  EXPECT_EQ(ratings.int64At(0), 3);
+  EXPECT_TRUE(ratings.isNull(1));
+  EXPECT_FALSE(ratings.isNull(2));
+
+  // the primary key is selected implicitly
+  EXPECT_EQ(tracks.column(TracksCols::Id).int64At(0), 1);
+
+  EXPECT_THROW(tracks.column(TracksCols::Name).isNull(4), DatabaseException);
+  EXPECT_THROW(columnar.joinedTuples(Relationships::AlbumTracks), DatabaseException);
+}
+
+/**
+ * @test: Runs the sum, min, max, count and filter kernels on materialized columns.
+ * @expected: The aggregates ignore null values and respect the filtered selection.
+ */
+TEST_F(TestColumnarResult, kernels)
+{
+  setupAlbumTracks();
+
+  auto results = m_db.execQuery(FROM_TABLE(TableIds::Tracks).SELECT_ALL);
+
+  const auto columnar = results.toColumnar();
+  const auto& tracks = columnar.tuples();
+  const auto& lengths = tracks.column(TracksCols::Length);
+  const auto& ratings = tracks.column(TracksCols::Rating);
+
+  EXPECT_EQ(ColumnKernels::count(ratings), 3);
+  EXPECT_EQ(ColumnKernels::sumInt64(ratings), 9);
+  EXPECT_EQ(ColumnKernels::minInt64(ratings).value(), 1);
+  EXPECT_EQ(ColumnKernels::maxInt64(ratings).value(), 5);
+  EXPECT_DOUBLE_EQ(ColumnKernels::sumDouble(lengths), 710.75);
+  EXPECT_DOUBLE_EQ(ColumnKernels::minDouble(lengths).value(), 90.25);
+  EXPECT_THROW(ColumnKernels::sumInt64(lengths), DatabaseException);
+
+  const auto longTracks = ColumnKernels::filter(lengths, QtSqlLib::EComparisonOperator::Greater, 150.0);
+  EXPECT_EQ(ColumnKernels::numSelected(longTracks), 2);
+  EXPECT_EQ(ColumnKernels::count(ratings, &longTracks), 1);
+  EXPECT_EQ(ColumnKernels::sumInt64(ratings, &longTracks), 1);
+  EXPECT_DOUBLE_EQ(ColumnKernels::maxDouble(lengths, &longTracks).value(), 300.0);
+
+  const auto unrated = ColumnKernels::filter(ratings, QtSqlLib::EComparisonOperator::Is, QVariant());
+  EXPECT_EQ(ColumnKernels::numSelected(unrated), 1);
+  EXPECT_FALSE(ColumnKernels::minInt64(ratings, &unrated).has_value());
+
+  const auto track3 = ColumnKernels::filter(tracks.column(TracksCols::Name), QtSqlLib::EComparisonOperator::Equal, "track3");
+  EXPECT_EQ(ColumnKernels::numSelected(track3), 1);
+  EXPECT_EQ(ColumnKernels::sumInt64(ratings, &track3), 5);
+
+  EXPECT_THROW(ColumnKernels::filter(tracks.column(TracksCols::Name), QtSqlLib::EComparisonOperator::Like, "track%"),
+    DatabaseException);
+}
+
+/**
+ * @test: Materializes the results of a query joining the tracks to their albums.
+ * @expected: The joined tracks are stored in a separate table and refer to the rows of their albums.
+ */
+TEST_F(TestColumnarResult, joinedTuples)
+{
+  setupAlbumTracks();
+
+  const auto albums = m_db.execQuery(FROM_TABLE(TableIds::Albums).SELECT(AlbumsCols::Id).ORDER_BY(AlbumsCols::Id))
+    .toColumnar();
+  const auto tracks = m_db.execQuery(FROM_TABLE(TableIds::Tracks).SELECT(TracksCols::Id).ORDER_BY(TracksCols::Id))
+    .toColumnar();
+
+  const auto& albumIds = albums.tuples().column(AlbumsCols::Id);
+  const auto& trackIds = tracks.tuples().column(TracksCols::Id);
+
+  for (size_t i=0; i<trackIds.size(); ++i)
+  {
+    const auto albumKey = QtSqlLib::PrimaryKey(static_cast<IID::Type>(TableIds::Albums),
+      { { static_cast<IID::Type>(AlbumsCols::Id), static_cast<qlonglong>(albumIds.int64At(i % 2)) } });
+    const auto trackKey = QtSqlLib::PrimaryKey(static_cast<IID::Type>(TableIds::Tracks),
+      { { static_cast<IID::Type>(TracksCols::Id), static_cast<qlonglong>(trackIds.int64At(i)) } });
+
+    m_db.execQuery(LINK_TUPLES(Relationships::AlbumTracks).FROM_ONE(albumKey).TO_ONE(trackKey));
+  }
+
+  auto results = m_db.execQuery(FROM_TABLE(TableIds::Albums)
+    .SELECT(AlbumsCols::Name)
+    .JOIN(Relationships::AlbumTracks, TracksCols::Name, TracksCols::Rating)
+    .ORDER_BY(AlbumsCols::Id));
+
+  const auto columnar = results.toColumnar();
+  ASSERT_EQ(columnar.tuples().numRows(), 2);
+  ASSERT_EQ(columnar.joins().size(), 1);
+
+  const auto& joinedTracks = columnar.joinedTuples(Relationships::AlbumTracks);
+  ASSERT_EQ(joinedTracks.numRows(), 4);
+  ASSERT_EQ(joinedTracks.parentRows().size(), 4);
+
+  int64_t sumOfFirstAlbum = 0;
+  for (size_t i=0; i<joinedTracks.numRows(); ++i)
+  {
+    if (joinedTracks.parentRows().at(i) == 0)
+    {
+      sumOfFirstAlbum += joinedTracks.column(TracksCols::Rating).int64At(i);
+    }
+  }
+
+  // track1 and track3 belong to album1
+  EXPECT_EQ(sumOfFirstAlbum, 8);
+}
+
+
+/**
+ * @test: Materializes the results of a query joining the albums to the artists and the tracks to the albums.
+ * @expected: The albums refer to the rows of their artists and the tracks refer to the rows of their albums in the
+ *            joined albums table.
+ */
+TEST_F(TestColumnarResult, nestedJoinedTuples)
+{
+  SchemaConfigurator configurator;
+  Funcs::configureAlbumsSchema(configurator);
+
+  m_db.initialize(configurator, Funcs::getDefaultDatabaseFilename());
+  Funcs::insertArtistsAlbumsTracks(m_db);
+
+  const auto columnar = m_db.execQuery(FROM_TABLE(TableIds::Artists)
+    .SELECT_ALL
+    .JOIN_ALL_PATH(Relationships::AlbumArtists, Relationships::AlbumTracks)
+    .ORDER_BY(ArtistsCols::Name)).toColumnar();
+
+  ASSERT_EQ(columnar.tuples().numRows(), 2);
+
+  const auto& albums = columnar.joinedTuples(Relationships::AlbumArtists);
+  const auto& tracks = columnar.joinedTuples(Relationships::AlbumTracks);
+  EXPECT_FALSE(albums.parentRelationshipId().has_value());
+  EXPECT_EQ(tracks.parentRelationshipId().value(), static_cast<IID::Type>(Relationships::AlbumArtists));
+
+  // album1 and album2 of artist1, album1 of artist2
+  ASSERT_EQ(albums.numRows(), 3);
+  std::map<QString, QStringList> albumNamesOfArtists;
+  for (size_t i=0; i<albums.numRows(); ++i)
+  {
+    const auto artistRow = albums.parentRows().at(i);
+    albumNamesOfArtists[columnar.tuples().column(ArtistsCols::Name).textAt(artistRow)]
+      << albums.column(AlbumsCols::Name).textAt(i);
+  }
+
+  for (auto& albumNames : albumNamesOfArtists)
+  {
+    std::sort(albumNames.second.begin(), albumNames.second.end());
+  }
+  EXPECT_EQ(albumNamesOfArtists, (std::map<QString, QStringList> {
+    { "artist1", { "album1", "album2" } }, { "artist2", { "album1" } } }));
+
+  ASSERT_EQ(tracks.numRows(), 5);
+  std::map<QString, QStringList> trackNamesOfAlbums;
+  for (size_t i=0; i<tracks.numRows(); ++i)
+  {
+    const auto albumRow = tracks.parentRows().at(i);
+    ASSERT_LT(albumRow, albums.numRows());
+
+    const auto artistName = columnar.tuples().column(ArtistsCols::Name).textAt(albums.parentRows().at(albumRow));
+    trackNamesOfAlbums[artistName + "/" + albums.column(AlbumsCols::Name).textAt(albumRow)]
+      << tracks.column(TracksCols::Name).textAt(i);
+  }
+
+  for (auto& trackNames : trackNamesOfAlbums)
+  {
+    std::sort(trackNames.second.begin(), trackNames.second.end());
+  }
+  EXPECT_EQ(trackNamesOfAlbums, (std::map<QString, QStringList> {
+    { "artist1/album1", { "track1", "track2" } },
+    { "artist1/album2", { "track3" } },
+    { "artist2/album1", { "track1", "track2" } } }));
+}
+}
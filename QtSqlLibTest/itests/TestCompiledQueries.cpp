@@ -0,0 +1,90 @@
+#include <gtest/gtest.h>
+
+#include <Common.h>
+
+#include <QFile>
+
+namespace QtSqlLibTest
+{
+
+class TestCompiledQueries : public testing::Test
+{
+public:
+  TestCompiledQueries()
+  {
+    QFile::remove(Funcs::getDefaultDatabaseFilename());
+  }
+
+  ~TestCompiledQueries() override
+  {
+    m_db.close();
+  }
+
+  QtSqlLib::Database m_db;
+
+};
+
+/**
+ * @test: Compiles a select query with a named parameter once and executes it multiple times with different bound
+ *        values.
+ * @expected: No exceptions occur.
+ *            Each execution delivers the tuple matching the currently bound parameter value.
+ */
+TEST_F(TestCompiledQueries, executeWithParameters)
+{
+  SchemaConfigurator configurator;
+  configurator.CONFIGURE_TABLE(TableIds::Table1, "table1")
+    .COLUMN(Table1Cols::Id, "id", DataType::Integer).PRIMARY_KEY.AUTO_INCREMENT.NOT_NULL
+    .COLUMN_VARCHAR(Table1Cols::Text, "text", 128)
+    .COLUMN(Table1Cols::Number, "number", DataType::Integer);
+
+  m_db.initialize(configurator, Funcs::getDefaultDatabaseFilename());
+
+  m_db.execQuery(BATCH_INSERT_INTO(TableIds::Table1)
+    .VALUES(Table1Cols::Text, QVariantList() << "value1" << "value2" << "value3")
+    .VALUES(Table1Cols::Number, QVariantList() << 1 << 2 << 3));
+
+  auto query = m_db.compile(FROM_TABLE(TableIds::Table1)
+    .SELECT(Table1Cols::Text, Table1Cols::Number)
+    .WHERE(EQUAL(Table1Cols::Number, PARAM("number")).OR.EQUAL(Table1Cols::Text, "value3")));
+
+  ASSERT_EQ(query.getParameterNames().size(), 1U);
+  EXPECT_EQ(query.getParameterNames().at(0), "number");
+
+  for (auto i = 1; i <= 2; i++)
+  {
+    auto results = m_db.execQuery(query.BIND("number", i));
+
+    EXPECT_EQ(Funcs::numResults(results), 2);
+    EXPECT_TRUE(Funcs::isResultTuplesContaining(results, TableIds::Table1, Table1Cols::Text,
+      QString("value%1").arg(i)));
+    EXPECT_TRUE(Funcs::isResultTuplesContaining(results, TableIds::Table1, Table1Cols::Text, "value3"));
+  }
+}
+
+/**
+ * @test: Uses a named parameter within a regular query and executes a compiled query without binding its parameter.
+ * @expected: Both cases throw an exception.
+ */
+TEST_F(TestCompiledQueries, missingParameterValues)
+{
+  SchemaConfigurator configurator;
+  configurator.CONFIGURE_TABLE(TableIds::Table1, "table1")
+    .COLUMN(Table1Cols::Id, "id", DataType::Integer).PRIMARY_KEY.AUTO_INCREMENT.NOT_NULL
+    .COLUMN(Table1Cols::Number, "number", DataType::Integer);
+
+  m_db.initialize(configurator, Funcs::getDefaultDatabaseFilename());
+
+  EXPECT_THROW(m_db.execQuery(FROM_TABLE(TableIds::Table1)
+    .SELECT_ALL
+    .WHERE(EQUAL(Table1Cols::Number, PARAM("number")))), DatabaseException);
+
+  auto query = m_db.compile(FROM_TABLE(TableIds::Table1)
+    .SELECT_ALL
+    .WHERE(EQUAL(Table1Cols::Number, PARAM("number"))));
+
+  EXPECT_THROW(m_db.execQuery(query), DatabaseException);
+  EXPECT_THROW(query.BIND("unknown", 1), DatabaseException);
+}
+
+}
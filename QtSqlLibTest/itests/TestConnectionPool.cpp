@@ -0,0 +1,195 @@
+#include <gtest/gtest.h>
+
+#include <Common.h>
+
+#include <QFile>
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace QtSqlLibTest
+{
+
+class TestConnectionPool : public testing::Test
+{
+public:
+  TestConnectionPool()
+  {
+    QFile::remove(Funcs::getDefaultDatabaseFilename());
+  }
+
+  ~TestConnectionPool() override
+  {
+    m_db.close();
+  }
+
+  QtSqlLib::Database m_db;
+
+};
+
+/**
+ * @test: Enables the connection pool, inserts some tuples and queries them concurrently from multiple worker threads.
+ * @expected: No exceptions occur.
+ *            Every worker thread retrieves all inserted tuples through its own pooled connection.
+ */
+TEST_F(TestConnectionPool, concurrentReads)
+{
+  static const auto s_numThreads = 4;
+  static const auto s_numQueriesPerThread = 10;
+
+  SchemaConfigurator configurator;
+  configurator.CONFIGURE_TABLE(TableIds::Table1, "table1")
+    .COLUMN(Table1Cols::Id, "id", DataType::Integer).PRIMARY_KEY.AUTO_INCREMENT.NOT_NULL
+    .COLUMN_VARCHAR(Table1Cols::Text, "text", 128)
+    .COLUMN(Table1Cols::Number, "number", DataType::Integer);
+
+  m_db.setConnectionPoolSize(s_numThreads);
+  m_db.initialize(configurator, Funcs::getDefaultDatabaseFilename());
+
+  m_db.execQuery(BATCH_INSERT_INTO(TableIds::Table1)
+    .VALUES(Table1Cols::Text, QVariantList() << "value1" << "value2" << "value3")
+    .VALUES(Table1Cols::Number, QVariantList() << 1 << 2 << 3));
+
+  std::atomic<int> numSucceededQueries(0);
+  std::vector<std::thread> threads;
+  for (auto i = 0; i < s_numThreads; i++)
+  {
+    threads.emplace_back([this, &numSucceededQueries]()
+    {
+      for (auto j = 0; j < s_numQueriesPerThread; j++)
+      {
+        auto results = m_db.execQuery(FROM_TABLE(TableIds::Table1)
+          .SELECT(Table1Cols::Text, Table1Cols::Number));
+
+        if (Funcs::numResults(results) == 3)
+        {
+          numSucceededQueries++;
+        }
+      }
+    });
+  }
+
+  for (auto& thread : threads)
+  {
+    thread.join();
+  }
+
+  EXPECT_EQ(numSucceededQueries, s_numThreads * s_numQueriesPerThread);
+}
+
+/**
+ * @test: Enables a connection pool with a single connection and queries from a worker thread while another worker
+ *        thread still holds the only pooled connection.
+ * @expected: The second worker thread fails to acquire a connection after the timeout elapsed.
+ *            After the first worker released its connection, the second worker thread succeeds.
+ */
+TEST_F(TestConnectionPool, poolExhausted)
+{
+  SchemaConfigurator configurator;
+  configurator.CONFIGURE_TABLE(TableIds::Table1, "table1")
+    .COLUMN(Table1Cols::Id, "id", DataType::Integer).PRIMARY_KEY.AUTO_INCREMENT.NOT_NULL;
+
+  m_db.initialize(configurator, Funcs::getDefaultDatabaseFilename());
+  m_db.setConnectionPoolSize(1, 100);
+
+  std::atomic<bool> bIsFirstConnectionAcquired(false);
+  std::atomic<bool> bIsSecondQueryDone(false);
+  std::atomic<bool> bIsSecondQueryFailed(false);
+
+  std::thread firstThread([this, &bIsFirstConnectionAcquired, &bIsSecondQueryDone]()
+  {
+    m_db.execQuery(FROM_TABLE(TableIds::Table1).SELECT(Table1Cols::Id));
+    bIsFirstConnectionAcquired = true;
+
+    while (!bIsSecondQueryDone)
+    {
+      std::this_thread::yield();
+    }
+
+    m_db.releaseThreadConnection();
+  });
+
+  while (!bIsFirstConnectionAcquired)
+  {
+    std::this_thread::yield();
+  }
+
+  std::thread secondThread([this, &bIsSecondQueryDone, &bIsSecondQueryFailed]()
+  {
+    try
+    {
+      m_db.execQuery(FROM_TABLE(TableIds::Table1).SELECT(Table1Cols::Id));
+    }
+    catch (const DatabaseException&)
+    {
+      bIsSecondQueryFailed = true;
+    }
+    bIsSecondQueryDone = true;
+  });
+
+  secondThread.join();
+  firstThread.join();
+
+  EXPECT_TRUE(bIsSecondQueryFailed);
+
+  std::thread thirdThread([this]()
+  {
+    EXPECT_NO_THROW(m_db.execQuery(FROM_TABLE(TableIds::Table1).SELECT(Table1Cols::Id)));
+  });
+  thirdThread.join();
+}
+
+/**
+ * @test: Closes the database while a worker thread still holds a pooled connection. Initializes the database again
+ *        after the worker thread exited and queries from another worker thread.
+ * @expected: Closing the database throws an exception after the acquire timeout elapsed.
+ *            The connection of the new pool does not collide with the one left open by the closed pool.
+ */
+TEST_F(TestConnectionPool, closeWhileConnectionHeld)
+{
+  SchemaConfigurator configurator;
+  configurator.CONFIGURE_TABLE(TableIds::Table1, "table1")
+    .COLUMN(Table1Cols::Id, "id", DataType::Integer).PRIMARY_KEY.AUTO_INCREMENT.NOT_NULL;
+
+  m_db.setConnectionPoolSize(1, 100);
+  m_db.initialize(configurator, Funcs::getDefaultDatabaseFilename());
+
+  std::atomic<bool> bIsConnectionAcquired(false);
+  std::atomic<bool> bIsDatabaseClosed(false);
+
+  std::thread firstThread([this, &bIsConnectionAcquired, &bIsDatabaseClosed]()
+  {
+    m_db.execQuery(FROM_TABLE(TableIds::Table1).SELECT(Table1Cols::Id));
+    bIsConnectionAcquired = true;
+
+    while (!bIsDatabaseClosed)
+    {
+      std::this_thread::yield();
+    }
+  });
+
+  while (!bIsConnectionAcquired)
+  {
+    std::this_thread::yield();
+  }
+
+  EXPECT_THROW(m_db.close(), DatabaseException);
+
+  bIsDatabaseClosed = true;
+  firstThread.join();
+
+  SchemaConfigurator secondConfigurator;
+  secondConfigurator.CONFIGURE_TABLE(TableIds::Table1, "table1")
+    .COLUMN(Table1Cols::Id, "id", DataType::Integer).PRIMARY_KEY.AUTO_INCREMENT.NOT_NULL;
+
+  m_db.initialize(secondConfigurator, Funcs::getDefaultDatabaseFilename());
+
+  std::thread secondThread([this]()
+  {
+    EXPECT_NO_THROW(m_db.execQuery(FROM_TABLE(TableIds::Table1).SELECT(Table1Cols::Id)));
+  });
+  secondThread.join();
+}
+
+}
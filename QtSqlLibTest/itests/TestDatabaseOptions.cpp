@@ -0,0 +1,136 @@
+#include <gtest/gtest.h>
+
+#include <Common.h>
+
+#include <QFile>
+#include <QSqlQuery>
+
+namespace QtSqlLibTest
+{
+
+class TestDatabaseOptions : public testing::Test
+{
+public:
+  TestDatabaseOptions()
+  {
+    QFile::remove(Funcs::getDefaultDatabaseFilename());
+  }
+
+  ~TestDatabaseOptions() override
+  {
+    m_db.close();
+  }
+
+  void setupTestDatabase(const DatabaseOptions& options = DatabaseOptions())
+  {
+    SchemaConfigurator configurator;
+    configurator.CONFIGURE_TABLE(TableIds::Table1, "table1")
+      .COLUMN(Table1Cols::Id, "id", DataType::Integer).PRIMARY_KEY.AUTO_INCREMENT.NOT_NULL
+      .COLUMN_VARCHAR(Table1Cols::Text, "text", 128).NOT_NULL;
+
+    m_db.initialize(configurator, Funcs::getDefaultDatabaseFilename(), options);
+  }
+
+  static QVariant queryPragma(const QString& pragma)
+  {
+    QSqlQuery query(QSqlDatabase::database());
+    if (!query.exec(QString("PRAGMA %1;").arg(pragma)) || !query.next())
+    {
+      return {};
+    }
+    return query.value(0);
+  }
+
+  QtSqlLib::Database m_db;
+
+};
+
+/**
+ * @test: Initializes a new database with creation and runtime options.
+ * @expected: The corresponding PRAGMA values are set on the connection.
+ */
+TEST_F(TestDatabaseOptions, initializeWithOptions)
+{
+  DatabaseOptions options;
+  options.pageSize = 8192;
+  options.autoVacuum = DatabaseOptions::AutoVacuum::Incremental;
+  options.journalMode = DatabaseOptions::JournalMode::Wal;
+  options.synchronous = DatabaseOptions::Synchronous::Normal;
+  options.cacheSize = -4096;
+
+  setupTestDatabase(options);
+
+  EXPECT_EQ(queryPragma("page_size").toInt(), 8192);
+  EXPECT_EQ(queryPragma("auto_vacuum").toInt(), 2);
+  EXPECT_EQ(queryPragma("journal_mode").toString().toLower(), "wal");
+  EXPECT_EQ(queryPragma("synchronous").toInt(), 1);
+  EXPECT_EQ(queryPragma("cache_size").toInt(), -4096);
+}
+
+/**
+ * @test: Switches between the builtin profiles and a custom profile at runtime and applies an unknown profile.
+ * @expected: The runtime options of each profile are applied, unspecified options are kept.
+ *            Applying an unknown profile throws an exception.
+ */
+TEST_F(TestDatabaseOptions, applyProfiles)
+{
+  setupTestDatabase();
+
+  m_db.applyProfile(DatabaseOptions::bulkLoadProfileName);
+
+  EXPECT_EQ(queryPragma("synchronous").toInt(), 0);
+  EXPECT_EQ(queryPragma("temp_store").toInt(), 2);
+
+  m_db.applyProfile(DatabaseOptions::oltpProfileName);
+
+  EXPECT_EQ(queryPragma("journal_mode").toString().toLower(), "wal");
+  EXPECT_EQ(queryPragma("synchronous").toInt(), 1);
+  EXPECT_EQ(queryPragma("busy_timeout").toInt(), 5000);
+
+  DatabaseOptions custom;
+  custom.cacheSize = -1024;
+  m_db.registerProfile("custom", custom);
+  m_db.applyProfile("custom");
+
+  EXPECT_EQ(queryPragma("cache_size").toInt(), -1024);
+  EXPECT_EQ(queryPragma("synchronous").toInt(), 1);
+  EXPECT_EQ(m_db.getOptions().cacheSize.value(), -1024);
+
+  EXPECT_THROW(m_db.applyProfile("unknown"), DatabaseException);
+
+  m_db.execQuery(INSERT_INTO(TableIds::Table1).VALUE(Table1Cols::Text, "value"));
+  auto results = m_db.execQuery(FROM_TABLE(TableIds::Table1).SELECT(Table1Cols::Text));
+  EXPECT_EQ(Funcs::numResults(results), 1);
+}
+
+/**
+ * @test: Applies runtime options while a transaction is open on the connection, then commits the transaction.
+ * @expected: The options are not applied within the transaction and queries succeed.
+ *            The options are applied by the first query after the transaction finished.
+ */
+TEST_F(TestDatabaseOptions, applyOptionsAfterTransaction)
+{
+  setupTestDatabase();
+
+  DatabaseOptions options;
+  options.journalMode = DatabaseOptions::JournalMode::Memory;
+  options.synchronous = DatabaseOptions::Synchronous::Off;
+
+  {
+    auto transaction = m_db.beginTransaction();
+    m_db.applyOptions(options);
+
+    m_db.execQuery(INSERT_INTO(TableIds::Table1).VALUE(Table1Cols::Text, "value"));
+    EXPECT_EQ(queryPragma("journal_mode").toString().toLower(), "delete");
+
+    transaction.commit();
+  }
+
+  auto results = m_db.execQuery(FROM_TABLE(TableIds::Table1).SELECT(Table1Cols::Text));
+  EXPECT_EQ(Funcs::numResults(results), 1);
+
+  EXPECT_EQ(queryPragma("journal_mode").toString().toLower(), "memory");
+  EXPECT_EQ(queryPragma("synchronous").toInt(), 0);
+}
+
+}
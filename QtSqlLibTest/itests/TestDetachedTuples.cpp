@@ -0,0 +1,197 @@
+#include <gtest/gtest.h>
+
+#include <Common.h>
+
+#include <QtSqlLib/TupleArena.h>
+
+#include <QFile>
+
+#include <map>
+#include <set>
+
+namespace QtSqlLibTest
+{
+
+class TestDetachedTuples : public testing::Test
+{
+public:
+  TestDetachedTuples()
+  {
+    QFile::remove(Funcs::getDefaultDatabaseFilename());
+  }
+
+  ~TestDetachedTuples() override
+  {
+    m_db.close();
+  }
+
+  QtSqlLib::Database m_db;
+
+};
+
+/**
+ * @test: Detaches all tuples of a query with 5000 rows and accesses them after the result set was destroyed.
+ * @expected: The detached tuples keep their values. The values are stored in a few arena chunks.
+ */
+TEST_F(TestDetachedTuples, detachTuples)
+{
+  SchemaConfigurator configurator;
+  configurator.CONFIGURE_TABLE(TableIds::Table1, "table1")
+    .COLUMN(Table1Cols::Id, "id", DataType::Integer).PRIMARY_KEY.AUTO_INCREMENT.NOT_NULL
+    .COLUMN_VARCHAR(Table1Cols::Text, "text", 128)
+    .COLUMN(Table1Cols::Number, "number", DataType::Integer);
+
+  m_db.initialize(configurator, Funcs::getDefaultDatabaseFilename());
+
+  const auto numTuples = 5000;
+
+  QVariantList texts;
+  QVariantList numbers;
+  for (auto i=0; i<numTuples; ++i)
+  {
+    texts << QString("text%1").arg(i);
+    numbers << i;
+  }
+
+  m_db.execQuery(BATCH_INSERT_INTO(TableIds::Table1)
+    .VALUES(Table1Cols::Text, texts)
+    .VALUES(Table1Cols::Number, numbers));
+
+  std::vector<QtSqlLib::Tuple> tuples;
+  auto arena = std::make_shared<QtSqlLib::TupleArena>();
+
+  {
+    auto results = m_db.execQuery(FROM_TABLE(TableIds::Table1)
+      .SELECT_ALL
+      .ORDER_BY(Table1Cols::Number));
+
+    while (results.hasNextTuple())
+    {
+      const auto tuple = results.nextTuple();
+      tuples.emplace_back(tuple.detach(arena));
+    }
+  }
+
+  ASSERT_EQ(tuples.size(), numTuples);
+  EXPECT_EQ(tuples[0].textAt(Table1Cols::Text), "text0");
+  EXPECT_EQ(tuples[4999].int64At(Table1Cols::Number), 4999);
+  EXPECT_EQ(tuples[4999].primaryKey().value(Table1Cols::Id).toInt(), 5000);
+  EXPECT_EQ(tuples[10].tableId(), static_cast<IID::Type>(TableIds::Table1));
+  EXPECT_FALSE(tuples[10].hasColumnValue(Table1Cols::Mandatory));
+
+  EXPECT_EQ(arena->numValues(), 3 * numTuples);
+  EXPECT_LE(arena->numChunks(), 5);
+}
+
+/**
+ * @test: Detaches albums and their joined tracks into the arena of the result set. Tries to detach an invalidated
+ *        tuple.
+ * @expected: The detached tuples stay valid after the iteration finished. Detaching an invalidated tuple throws an
+ *            exception.
+ */
+TEST_F(TestDetachedTuples, detachJoinedTuples)
+{
+  SchemaConfigurator configurator;
+  Funcs::configureAlbumsSchema(configurator);
+
+  m_db.initialize(configurator, Funcs::getDefaultDatabaseFilename());
+
+  const auto albumKey = m_db.execQuery(INSERT_INTO_EXT(TableIds::Albums)
+    .VALUE(AlbumsCols::Name, "album")
+    .RETURN_IDS).nextTuple().primaryKey();
+
+  m_db.execQuery(INSERT_INTO_EXT(TableIds::Tracks)
+    .VALUE(TracksCols::Name, "track")
+    .LINK_TO_ONE_TUPLE(Relationships::AlbumTracks, albumKey));
+
+  std::vector<QtSqlLib::Tuple> tuples;
+
+  auto results = m_db.execQuery(FROM_TABLE(TableIds::Albums)
+    .SELECT_ALL
+    .JOIN_ALL(Relationships::AlbumTracks));
+
+  const auto album = results.nextTuple();
+  tuples.emplace_back(album.detach());
+  tuples.emplace_back(results.nextJoinedTuple().detach());
+
+  EXPECT_FALSE(results.hasNextTuple());
+  EXPECT_THROW(album.detach(), DatabaseException);
+
+  results = QtSqlLib::ResultSet();
+
+  ASSERT_EQ(tuples.size(), 2);
+  EXPECT_EQ(tuples[0].columnValue(AlbumsCols::Name).toString(), "album");
+  EXPECT_FALSE(tuples[0].relationshipId().has_value());
+  EXPECT_EQ(tuples[1].columnValue(TracksCols::Name).toString(), "track");
+  EXPECT_EQ(tuples[1].relationshipId().value(), static_cast<IID::Type>(Relationships::AlbumTracks));
+}
+
+
+/**
+ * @test: Detaches artists with their joined albums and the tracks joined to the albums.
+ * @expected: The detached albums keep the primary key of their artist and the detached tracks keep the primary key of
+ *            their album, so they can be attached to their parent tuples after the result set was destroyed.
+ */
+TEST_F(TestDetachedTuples, detachNestedJoinedTuples)
+{
+  SchemaConfigurator configurator;
+  Funcs::configureAlbumsSchema(configurator);
+
+  m_db.initialize(configurator, Funcs::getDefaultDatabaseFilename());
+  Funcs::insertArtistsAlbumsTracks(m_db);
+
+  std::vector<QtSqlLib::Tuple> tuples;
+  {
+    auto results = m_db.execQuery(FROM_TABLE(TableIds::Artists)
+      .SELECT_ALL
+      .JOIN_ALL_PATH(Relationships::AlbumArtists, Relationships::AlbumTracks)
+      .ORDER_BY(ArtistsCols::Name));
+
+    while (results.hasNextTuple())
+    {
+      tuples.emplace_back(results.nextTuple().detach());
+      while (results.hasNextJoinedTuple())
+      {
+        tuples.emplace_back(results.nextJoinedTuple().detach());
+      }
+    }
+  }
+
+  std::map<QtSqlLib::PrimaryKey, QString> namesByKey;
+  for (const auto& tuple : tuples)
+  {
+    if (!tuple.relationshipId())
+    {
+      EXPECT_EQ(tuple.parentPrimaryKey().numValues(), 0);
+      namesByKey[tuple.primaryKey()] = tuple.columnValue(ArtistsCols::Name).toString();
+    }
+    else if (tuple.relationshipId().value() == static_cast<IID::Type>(Relationships::AlbumArtists))
+    {
+      namesByKey[tuple.primaryKey()] = tuple.columnValue(AlbumsCols::Name).toString();
+    }
+  }
+
+  std::set<QString> artistAlbums;
+  std::set<QString> albumTracks;
+  for (const auto& tuple : tuples)
+  {
+    if (!tuple.relationshipId())
+    {
+      continue;
+    }
+
+    const auto parentName = namesByKey.at(tuple.parentPrimaryKey());
+    if (tuple.relationshipId().value() == static_cast<IID::Type>(Relationships::AlbumArtists))
+    {
+      artistAlbums.insert(parentName + "/" + tuple.columnValue(AlbumsCols::Name).toString());
+    }
+    else
+    {
+      albumTracks.insert(parentName + "/" + tuple.columnValue(TracksCols::Name).toString());
+    }
+  }
+
+  EXPECT_EQ(artistAlbums, (std::set<QString> { "artist1/album1", "artist1/album2", "artist2/album1" }));
+  EXPECT_EQ(albumTracks, (std::set<QString> { "album1/track1", "album1/track2", "album2/track3" }));
+}
+}
@@ -0,0 +1,109 @@
+#include <gtest/gtest.h>
+
+#include <Common.h>
+
+#include <QFile>
+
+#include <map>
+#include <set>
+
+namespace QtSqlLibTest
+{
+
+class TestNestedJoins : public testing::Test
+{
+public:
+  TestNestedJoins()
+  {
+    QFile::remove(Funcs::getDefaultDatabaseFilename());
+  }
+
+  ~TestNestedJoins() override
+  {
+    m_db.close();
+  }
+
+  QtSqlLib::Database m_db;
+
+};
+
+/**
+ * @test: Queries artists with their albums and the tracks of the albums through the relationship path
+ *        artists -> albums -> tracks in one query.
+ *        artist1 is linked to album1 (track1, track2) and album2 (track3), artist2 is linked to album1.
+ * @expected: Each album is returned once per artist and each track once per album. The tracks refer to their album
+ *            by the parent primary key.
+ *            A path with a relationship that does not belong to the parent table throws an exception.
+ */
+TEST_F(TestNestedJoins, relationshipPath)
+{
+  SchemaConfigurator configurator;
+  Funcs::configureAlbumsSchema(configurator);
+
+  m_db.initialize(configurator, Funcs::getDefaultDatabaseFilename());
+  Funcs::insertArtistsAlbumsTracks(m_db);
+
+  auto results = m_db.execQuery(FROM_TABLE(TableIds::Artists)
+    .SELECT_ALL
+    .JOIN_ALL_PATH(Relationships::AlbumArtists, Relationships::AlbumTracks)
+    .ORDER_BY(ArtistsCols::Name));
+
+  using AlbumTracks = std::map<QString, std::set<QString>>;
+  std::vector<AlbumTracks> artists;
+
+  while (results.hasNextTuple())
+  {
+    results.nextTuple();
+
+    std::vector<QString> albumNames;
+    std::map<int, QString> albumNamesById;
+    std::vector<std::pair<int, QString>> trackAlbums;
+
+    while (results.hasNextJoinedTuple())
+    {
+      const auto tuple = results.nextJoinedTuple();
+      if (tuple.relationshipId().value() == static_cast<IID::Type>(Relationships::AlbumArtists))
+      {
+        EXPECT_FALSE(tuple.parentRelationshipId().has_value());
+
+        const auto name = tuple.columnValue(AlbumsCols::Name).toString();
+        albumNames.emplace_back(name);
+        albumNamesById[tuple.columnValue(AlbumsCols::Id).toInt()] = name;
+      }
+      else
+      {
+        EXPECT_EQ(tuple.parentRelationshipId().value(), static_cast<IID::Type>(Relationships::AlbumArtists));
+        trackAlbums.emplace_back(
+          tuple.parentPrimaryKey().value(AlbumsCols::Id).toInt(),
+          tuple.columnValue(TracksCols::Name).toString());
+      }
+    }
+
+    AlbumTracks albumTracks;
+    for (const auto& name : albumNames)
+    {
+      EXPECT_EQ(albumTracks.count(name), 0);
+      albumTracks[name];
+    }
+
+    for (const auto& trackAlbum : trackAlbums)
+    {
+      const auto& albumName = albumNamesById.at(trackAlbum.first);
+      EXPECT_TRUE(albumTracks[albumName].insert(trackAlbum.second).second);
+    }
+    artists.emplace_back(std::move(albumTracks));
+  }
+
+  ASSERT_EQ(artists.size(), 2);
+  EXPECT_EQ(artists[0], AlbumTracks({
+    { "album1", { "track1", "track2" } },
+    { "album2", { "track3" } } }));
+  EXPECT_EQ(artists[1], AlbumTracks({
+    { "album1", { "track1", "track2" } } }));
+
+  EXPECT_THROW(m_db.execQuery(FROM_TABLE(TableIds::Artists)
+    .SELECT_ALL
+    .JOIN_ALL_PATH(Relationships::AlbumTracks, Relationships::AlbumArtists)), DatabaseException);
+}
+
+}
@@ -0,0 +1,158 @@
+#include <gtest/gtest.h>
+
+#include <Common.h>
+
+#include <QFile>
+
+namespace QtSqlLibTest
+{
+
+class TestPagination : public testing::Test
+{
+public:
+  TestPagination()
+  {
+    QFile::remove(Funcs::getDefaultDatabaseFilename());
+  }
+
+  ~TestPagination() override
+  {
+    m_db.close();
+  }
+
+  QList<int> queryNumbers(QtSqlLib::Query::FromTable& query)
+  {
+    QList<int> numbers;
+    auto results = m_db.execQuery(query);
+    while (results.hasNextTuple())
+    {
+      numbers.append(results.nextTuple().columnValue(Table1Cols::Number).toInt());
+    }
+    return numbers;
+  }
+
+  QtSqlLib::Database m_db;
+
+};
+
+/**
+ * @test: Queries pages of a table with ten tuples using limit() and offset() and using keyset pagination with
+ *        after() and before().
+ * @expected: Each query returns the expected page of tuples.
+ */
+TEST_F(TestPagination, limitOffsetAndKeyset)
+{
+  SchemaConfigurator configurator;
+  configurator.CONFIGURE_TABLE(TableIds::Table1, "table1")
+    .COLUMN(Table1Cols::Id, "id", DataType::Integer).PRIMARY_KEY.AUTO_INCREMENT.NOT_NULL
+    .COLUMN(Table1Cols::Number, "number", DataType::Integer);
+
+  m_db.initialize(configurator, Funcs::getDefaultDatabaseFilename());
+
+  QVariantList numbers;
+  for (auto i=1; i<=10; ++i)
+  {
+    numbers << i;
+  }
+
+  m_db.execQuery(BATCH_INSERT_INTO(TableIds::Table1)
+    .VALUES(Table1Cols::Number, numbers));
+
+  EXPECT_EQ(queryNumbers(FROM_TABLE(TableIds::Table1)
+    .SELECT(Table1Cols::Number)
+    .ORDER_BY(Table1Cols::Number)
+    .LIMIT(3)
+    .OFFSET(3)), QList<int>({ 4, 5, 6 }));
+
+  EXPECT_EQ(queryNumbers(FROM_TABLE(TableIds::Table1)
+    .SELECT(Table1Cols::Number)
+    .ORDER_BY(Table1Cols::Number)
+    .OFFSET(8)), QList<int>({ 9, 10 }));
+
+  QList<int> pagedNumbers;
+  std::optional<QtSqlLib::PrimaryKey> lastKey;
+  while (true)
+  {
+    FromTable query(QtSqlLib::ID(TableIds::Table1));
+    query.SELECT(Table1Cols::Number).LIMIT(4);
+    if (lastKey)
+    {
+      query.AFTER(lastKey.value());
+    }
+
+    auto results = m_db.execQuery(query);
+    if (!results.hasNextTuple())
+    {
+      break;
+    }
+
+    while (results.hasNextTuple())
+    {
+      const auto tuple = results.nextTuple();
+      pagedNumbers.append(tuple.columnValue(Table1Cols::Number).toInt());
+      lastKey = tuple.primaryKey();
+    }
+  }
+
+  EXPECT_EQ(pagedNumbers, QList<int>({ 1, 2, 3, 4, 5, 6, 7, 8, 9, 10 }));
+
+  const QtSqlLib::PrimaryKey key(static_cast<IID::Type>(TableIds::Table1),
+    { QtSqlLib::PrimaryKey::ColumnValue { static_cast<IID::Type>(Table1Cols::Id), 6 } });
+
+  EXPECT_EQ(queryNumbers(FROM_TABLE(TableIds::Table1)
+    .SELECT(Table1Cols::Number)
+    .BEFORE(key)
+    .LIMIT(2)), QList<int>({ 5, 4 }));
+
+  EXPECT_EQ(queryNumbers(FROM_TABLE(TableIds::Table1)
+    .SELECT(Table1Cols::Number)
+    .WHERE(LESS(Table1Cols::Number, 9))
+    .AFTER(key)), QList<int>({ 7, 8 }));
+
+  EXPECT_THROW(m_db.execQuery(FROM_TABLE(TableIds::Table1)
+    .SELECT_ALL
+    .AFTER(key)
+    .ORDER_BY(Table1Cols::Number)), DatabaseException);
+}
+
+/**
+ * @test: Queries the tuples after a key of a table with a composite primary key. Tries to limit a query with a join.
+ * @expected: The row value comparison returns the tuples ordered after the key. Limiting a join query throws.
+ */
+TEST_F(TestPagination, compositeKeyset)
+{
+  SchemaConfigurator configurator;
+  configurator.CONFIGURE_TABLE(TableIds::Table1, "table1")
+    .COLUMN(Table1Cols::Id, "id", DataType::Integer).NOT_NULL
+    .COLUMN_VARCHAR(Table1Cols::Text, "text", 128).NOT_NULL
+    .COLUMN(Table1Cols::Number, "number", DataType::Integer)
+    .PRIMARY_KEYS(Table1Cols::Id, Table1Cols::Text);
+
+  configurator.CONFIGURE_TABLE(TableIds::Table2, "table2")
+    .COLUMN(Table2Cols::Id, "id", DataType::Integer).PRIMARY_KEY.AUTO_INCREMENT.NOT_NULL;
+
+  configurator.CONFIGURE_RELATIONSHIP(Relationships::Special1, TableIds::Table1, TableIds::Table2,
+    QtSqlLib::API::RelationshipType::OneToMany);
+
+  m_db.initialize(configurator, Funcs::getDefaultDatabaseFilename());
+
+  m_db.execQuery(BATCH_INSERT_INTO(TableIds::Table1)
+    .VALUES(Table1Cols::Id, QVariantList() << 1 << 1 << 2 << 2)
+    .VALUES(Table1Cols::Text, QVariantList() << "a" << "b" << "a" << "b")
+    .VALUES(Table1Cols::Number, QVariantList() << 1 << 2 << 3 << 4));
+
+  const QtSqlLib::PrimaryKey key(static_cast<IID::Type>(TableIds::Table1), {
+    QtSqlLib::PrimaryKey::ColumnValue { static_cast<IID::Type>(Table1Cols::Id), 1 },
+    QtSqlLib::PrimaryKey::ColumnValue { static_cast<IID::Type>(Table1Cols::Text), "b" } });
+
+  EXPECT_EQ(queryNumbers(FROM_TABLE(TableIds::Table1)
+    .SELECT(Table1Cols::Number)
+    .AFTER(key)), QList<int>({ 3, 4 }));
+
+  EXPECT_THROW(m_db.execQuery(FROM_TABLE(TableIds::Table1)
+    .SELECT_ALL
+    .JOIN_ALL(Relationships::Special1)
+    .LIMIT(2)), DatabaseException);
+}
+
+}
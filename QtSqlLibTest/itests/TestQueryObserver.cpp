@@ -0,0 +1,110 @@
+#include <gtest/gtest.h>
+
+#include <Common.h>
+
+#include <QFile>
+
+namespace QtSqlLibTest
+{
+
+class TestQueryObserver : public testing::Test
+{
+public:
+  TestQueryObserver()
+  {
+    QFile::remove(Funcs::getDefaultDatabaseFilename());
+  }
+
+  ~TestQueryObserver() override
+  {
+    m_db.close();
+  }
+
+  void setupTestDatabase()
+  {
+    SchemaConfigurator configurator;
+    configurator.CONFIGURE_TABLE(TableIds::Table1, "table1")
+      .COLUMN(Table1Cols::Id, "id", DataType::Integer).PRIMARY_KEY.AUTO_INCREMENT.NOT_NULL
+      .COLUMN_VARCHAR(Table1Cols::Text, "text", 128)
+      .COLUMN(Table1Cols::Number, "number", DataType::Integer);
+
+    m_db.initialize(configurator, Funcs::getDefaultDatabaseFilename());
+  }
+
+  QtSqlLib::Database m_db;
+
+};
+
+/**
+ * @test: Registers an observer and executes an insert, an update and a select query. The select results are iterated.
+ * @expected: The observer is notified about each executed query with its SQL text, bound values and the number of
+ *            affected rows. After the result set is released, the iteration statistics are reported.
+ */
+TEST_F(TestQueryObserver, observeQueries)
+{
+  setupTestDatabase();
+
+  auto observer = std::make_shared<RecordingQueryObserver>();
+  m_db.registerQueryObserver(observer);
+
+  m_db.execQuery(BATCH_INSERT_INTO(TableIds::Table1)
+    .VALUES(Table1Cols::Text, QVariantList() << "value1" << "value2" << "value3")
+    .VALUES(Table1Cols::Number, QVariantList() << 1 << 2 << 3));
+
+  ASSERT_EQ(observer->executions.size(), 1);
+  EXPECT_TRUE(observer->executions[0].sqlQuery.startsWith("INSERT"));
+  EXPECT_TRUE(observer->executions[0].isBatch);
+  EXPECT_TRUE(observer->executions[0].errorText.isEmpty());
+
+  m_db.execQuery(UPDATE_TABLE(TableIds::Table1)
+    .SET(Table1Cols::Number, 10)
+    .WHERE(GREATEREQUAL(Table1Cols::Number, 2)));
+
+  ASSERT_EQ(observer->executions.size(), 2);
+  EXPECT_TRUE(observer->executions[1].sqlQuery.startsWith("UPDATE"));
+  EXPECT_FALSE(observer->executions[1].isBatch);
+  EXPECT_EQ(observer->executions[1].numRowsAffected, 2);
+  EXPECT_EQ(observer->executions[1].boundValues, QVariantList() << 10 << 2);
+
+  {
+    auto results = m_db.execQuery(FROM_TABLE(TableIds::Table1).SELECT(Table1Cols::Text));
+
+    ASSERT_EQ(observer->executions.size(), 3);
+    EXPECT_TRUE(observer->executions[2].sqlQuery.startsWith("SELECT"));
+    EXPECT_EQ(observer->executions[2].numRowsAffected, -1);
+    EXPECT_TRUE(observer->iterations.empty());
+
+    EXPECT_EQ(Funcs::numResults(results), 3);
+  }
+
+  ASSERT_EQ(observer->iterations.size(), 1);
+  EXPECT_EQ(observer->iterations[0].numRowsFetched, 3);
+  EXPECT_EQ(observer->iterations[0].numTuplesReturned, 3);
+  EXPECT_TRUE(observer->iterations[0].sqlQuery.startsWith("SELECT"));
+}
+
+/**
+ * @test: Executes a failing query with a registered observer, then unregisters the observer and executes another query.
+ * @expected: The observer receives the error of the failing query and is not notified anymore after unregistering.
+ */
+TEST_F(TestQueryObserver, observeErrorAndUnregister)
+{
+  setupTestDatabase();
+
+  auto observer = std::make_shared<RecordingQueryObserver>();
+  m_db.registerQueryObserver(observer);
+
+  m_db.execQuery(INSERT_INTO(TableIds::Table1).VALUE(Table1Cols::Id, 1).VALUE(Table1Cols::Text, "value"));
+  EXPECT_THROW(m_db.execQuery(INSERT_INTO(TableIds::Table1).VALUE(Table1Cols::Id, 1).VALUE(Table1Cols::Text, "value")),
+    DatabaseException);
+
+  ASSERT_EQ(observer->executions.size(), 2);
+  EXPECT_FALSE(observer->executions[1].errorText.isEmpty());
+
+  m_db.unregisterQueryObserver(observer);
+  m_db.execQuery(INSERT_INTO(TableIds::Table1).VALUE(Table1Cols::Text, "value"));
+
+  EXPECT_EQ(observer->executions.size(), 2);
+}
+
+}
@@ -0,0 +1,140 @@
+#include <gtest/gtest.h>
+
+#include <Common.h>
+
+#include <QFile>
+
+namespace QtSqlLibTest
+{
+
+using QueryPlan = QtSqlLib::QueryPlan;
+
+class TestQueryPlan : public testing::Test
+{
+public:
+  TestQueryPlan()
+  {
+    QFile::remove(Funcs::getDefaultDatabaseFilename());
+  }
+
+  ~TestQueryPlan() override
+  {
+    m_db.close();
+  }
+
+  void setupTestDatabase(bool enableForeignKeyIndexing)
+  {
+    SchemaConfigurator configurator;
+    configurator.CONFIGURE_TABLE(TableIds::Table1, "table1")
+      .COLUMN(Table1Cols::Id, "id", DataType::Integer).PRIMARY_KEY.AUTO_INCREMENT.NOT_NULL
+      .COLUMN_VARCHAR(Table1Cols::Text, "text", 128)
+      .COLUMN(Table1Cols::Number, "number", DataType::Integer);
+
+    configurator.CONFIGURE_TABLE(TableIds::Table2, "table2")
+      .COLUMN(Table2Cols::Id, "id", DataType::Integer).PRIMARY_KEY.AUTO_INCREMENT.NOT_NULL
+      .COLUMN_VARCHAR(Table2Cols::Text, "text", 128);
+
+    if (enableForeignKeyIndexing)
+    {
+      configurator.CONFIGURE_RELATIONSHIP(Relationships::Special1, TableIds::Table1, TableIds::Table2,
+        QtSqlLib::API::RelationshipType::OneToMany).ENABLE_FOREIGN_KEY_INDEXING;
+    }
+    else
+    {
+      configurator.CONFIGURE_RELATIONSHIP(Relationships::Special1, TableIds::Table1, TableIds::Table2,
+        QtSqlLib::API::RelationshipType::OneToMany);
+    }
+
+    m_db.initialize(configurator, Funcs::getDefaultDatabaseFilename());
+    m_db.setQueryPlanDiagnosticsEnabled(true);
+  }
+
+  static bool isColumnReferenced(const QueryPlan::Node& node, TableIds tableId, Table1Cols columnId)
+  {
+    return std::any_of(node.columns.cbegin(), node.columns.cend(), [&](const QueryPlan::ColumnReference& column)
+    {
+      return column.tableId == QtSqlLib::ID(tableId).get() && column.columnId == QtSqlLib::ID(columnId).get();
+    });
+  }
+
+  QtSqlLib::Database m_db;
+
+};
+
+/**
+ * @test: Executes the same select query with a filter on an unindexed column and a sort order twice.
+ * @expected: The query plan is captured once. It contains a full table scan mapped to the filtered column
+ *            and a temporary b-tree mapped to the sorted column.
+ */
+TEST_F(TestQueryPlan, detectFullScanAndTempBTree)
+{
+  setupTestDatabase(false);
+
+  for (auto i=0; i<2; ++i)
+  {
+    auto results = m_db.execQuery(FROM_TABLE(TableIds::Table1)
+      .SELECT(Table1Cols::Id, Table1Cols::Text)
+      .WHERE(EQUAL(Table1Cols::Number, i))
+      .ORDER_BY(Table1Cols::Text));
+  }
+
+  const auto queryPlans = m_db.getQueryPlans();
+  ASSERT_EQ(queryPlans.size(), 1);
+
+  const auto fullScans = queryPlans[0].findFullTableScans();
+  ASSERT_EQ(fullScans.size(), 1);
+  EXPECT_TRUE(fullScans[0].tableId == QtSqlLib::ID(TableIds::Table1).get());
+  EXPECT_TRUE(isColumnReferenced(fullScans[0], TableIds::Table1, Table1Cols::Number));
+
+  const auto tempBTrees = queryPlans[0].findNodes(QueryPlan::NodeType::TempBTree);
+  ASSERT_EQ(tempBTrees.size(), 1);
+  EXPECT_TRUE(tempBTrees[0].tableId == QtSqlLib::ID(TableIds::Table1).get());
+  EXPECT_TRUE(isColumnReferenced(tempBTrees[0], TableIds::Table1, Table1Cols::Text));
+
+  m_db.clearQueryPlans();
+  EXPECT_TRUE(m_db.getQueryPlans().empty());
+}
+
+/**
+ * @test: Joins a one-to-many relationship, once without and once with foreign key indexing.
+ * @expected: Without foreign key indexing the joined table is accessed by a scan or an automatic index.
+ *            With foreign key indexing the joined table is searched by the created index.
+ */
+TEST_F(TestQueryPlan, detectUnindexedForeignKeys)
+{
+  const auto isJoinTableNode = [](const QueryPlan::Node& node)
+  {
+    return node.tableId == QtSqlLib::ID(TableIds::Table2).get() && !node.columns.empty();
+  };
+
+  setupTestDatabase(false);
+  m_db.execQuery(FROM_TABLE(TableIds::Table1).SELECT(Table1Cols::Text).JOIN_ALL(Relationships::Special1));
+
+  auto queryPlans = m_db.getQueryPlans();
+  ASSERT_EQ(queryPlans.size(), 1);
+
+  auto fullScans = queryPlans[0].findFullTableScans();
+  const auto automaticIndices = queryPlans[0].findAutomaticIndices();
+  EXPECT_TRUE(std::any_of(fullScans.cbegin(), fullScans.cend(), isJoinTableNode) ||
+    std::any_of(automaticIndices.cbegin(), automaticIndices.cend(), isJoinTableNode));
+
+  m_db.close();
+  QFile::remove(Funcs::getDefaultDatabaseFilename());
+
+  setupTestDatabase(true);
+  m_db.execQuery(FROM_TABLE(TableIds::Table1).SELECT(Table1Cols::Text).JOIN_ALL(Relationships::Special1));
+
+  queryPlans = m_db.getQueryPlans();
+  ASSERT_EQ(queryPlans.size(), 1);
+
+  fullScans = queryPlans[0].findFullTableScans();
+  EXPECT_FALSE(std::any_of(fullScans.cbegin(), fullScans.cend(), isJoinTableNode));
+
+  const auto searches = queryPlans[0].findNodes(QueryPlan::NodeType::Search);
+  EXPECT_TRUE(std::any_of(searches.cbegin(), searches.cend(), [](const QueryPlan::Node& node)
+  {
+    return node.tableId == QtSqlLib::ID(TableIds::Table2).get() && !node.indexName.isEmpty();
+  }));
+}
+
+}
@@ -1187,4 +1187,88 @@ TEST_F(TestRelationship, specialRelationships)
   expectSpecialRelation6Students(results);
 }
 
+/**
+ * @test: Links and unlinks 100 tracks to an album and 100 artists to the album by a many-to-many relationship.
+ * @expected: Each link and unlink query is executed as one batch statement, independent of the number of tuples.
+ *            The tuples are linked and unlinked correctly.
+ */
+TEST_F(TestRelationship, linkAndUnlinkManyTuplesBatched)
+{
+  SchemaConfigurator configurator;
+  Funcs::configureAlbumsSchema(configurator);
+
+  m_db.initialize(configurator, Funcs::getDefaultDatabaseFilename());
+
+  const auto numTuples = 100;
+
+  QVariantList names;
+  for (auto i=0; i<numTuples; ++i)
+  {
+    names << QString("name%1").arg(i);
+  }
+
+  m_db.execQuery(INSERT_INTO(TableIds::Albums).VALUE(AlbumsCols::Name, "album"));
+  m_db.execQuery(BATCH_INSERT_INTO(TableIds::Tracks).VALUES(TracksCols::Name, names));
+  m_db.execQuery(BATCH_INSERT_INTO(TableIds::Artists).VALUES(ArtistsCols::Name, names));
+
+  const auto albumKey = QtSqlLib::PrimaryKey(static_cast<IID::Type>(TableIds::Albums),
+    { QtSqlLib::PrimaryKey::ColumnValue { static_cast<IID::Type>(AlbumsCols::Id), 1 } });
+
+  std::vector<QtSqlLib::PrimaryKey> trackKeys;
+  std::vector<QtSqlLib::PrimaryKey> artistKeys;
+  for (auto i=1; i<=numTuples; ++i)
+  {
+    trackKeys.emplace_back(QtSqlLib::PrimaryKey(static_cast<IID::Type>(TableIds::Tracks),
+      { QtSqlLib::PrimaryKey::ColumnValue { static_cast<IID::Type>(TracksCols::Id), i } }));
+    artistKeys.emplace_back(QtSqlLib::PrimaryKey(static_cast<IID::Type>(TableIds::Artists),
+      { QtSqlLib::PrimaryKey::ColumnValue { static_cast<IID::Type>(ArtistsCols::Id), i } }));
+  }
+
+  const auto countJoinedTuples = [this](Relationships relationshipId)
+  {
+    auto results = m_db.execQuery(FROM_TABLE(TableIds::Albums)
+      .SELECT_ALL
+      .JOIN_ALL(relationshipId));
+
+    auto numJoinedTuples = 0;
+    while (results.hasNextTuple())
+    {
+      results.nextTuple();
+      while (results.hasNextJoinedTuple())
+      {
+        results.nextJoinedTuple();
+        numJoinedTuples++;
+      }
+    }
+    return numJoinedTuples;
+  };
+
+  auto observer = std::make_shared<RecordingQueryObserver>();
+  m_db.registerQueryObserver(observer);
+
+  m_db.execQuery(LINK_TUPLES(Relationships::AlbumTracks).FROM_ONE(albumKey).TO_MANY(trackKeys));
+  m_db.execQuery(LINK_TUPLES(Relationships::AlbumArtists).FROM_ONE(albumKey).TO_MANY(artistKeys));
+
+  ASSERT_EQ(observer->executions.size(), 2);
+  EXPECT_TRUE(observer->executions[0].isBatch);
+  EXPECT_TRUE(observer->executions[1].isBatch);
+
+  EXPECT_EQ(countJoinedTuples(Relationships::AlbumTracks), numTuples);
+  EXPECT_EQ(countJoinedTuples(Relationships::AlbumArtists), numTuples);
+
+  observer->executions.clear();
+
+  m_db.execQuery(UNLINK_TUPLES(Relationships::AlbumTracks).FROM_ONE(albumKey).TO_MANY(trackKeys));
+  m_db.execQuery(UNLINK_TUPLES(Relationships::AlbumArtists).FROM_ONE(albumKey).TO_MANY(artistKeys));
+
+  ASSERT_EQ(observer->executions.size(), 2);
+  EXPECT_TRUE(observer->executions[0].isBatch);
+  EXPECT_TRUE(observer->executions[1].isBatch);
+
+  m_db.unregisterQueryObserver(observer);
+
+  EXPECT_EQ(countJoinedTuples(Relationships::AlbumTracks), 0);
+  EXPECT_EQ(countJoinedTuples(Relationships::AlbumArtists), 0);
+}
+
 }
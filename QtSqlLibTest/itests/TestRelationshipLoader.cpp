@@ -0,0 +1,149 @@
+#include <gtest/gtest.h>
+
+#include <Common.h>
+
+#include <QtSqlLib/RelationshipLoader.h>
+
+#include <QFile>
+
+namespace QtSqlLibTest
+{
+
+class TestRelationshipLoader : public testing::Test
+{
+public:
+  TestRelationshipLoader()
+  {
+    QFile::remove(Funcs::getDefaultDatabaseFilename());
+  }
+
+  ~TestRelationshipLoader() override
+  {
+    m_db.close();
+  }
+
+  QtSqlLib::Database m_db;
+
+};
+
+/**
+ * @test: Queries ten albums and requests the tracks of each album from a relationship loader.
+ * @expected: The tracks of all albums are loaded by one query, so the access pattern costs two queries in total.
+ *            Each album gets its own tracks, albums without tracks get an empty list.
+ */
+TEST_F(TestRelationshipLoader, loadRelatedTuples)
+{
+  SchemaConfigurator configurator;
+  Funcs::configureAlbumsSchema(configurator);
+
+  m_db.initialize(configurator, Funcs::getDefaultDatabaseFilename());
+
+  // album i has i tracks
+  for (auto i=0; i<10; ++i)
+  {
+    const auto albumKey = m_db.execQuery(INSERT_INTO_EXT(TableIds::Albums)
+      .VALUE(AlbumsCols::Name, QString("album%1").arg(i))
+      .RETURN_IDS).nextTuple().primaryKey();
+
+    for (auto j=0; j<i; ++j)
+    {
+      m_db.execQuery(INSERT_INTO_EXT(TableIds::Tracks)
+        .VALUE(TracksCols::Name, QString("track%1_%2").arg(i).arg(j))
+        .LINK_TO_ONE_TUPLE(Relationships::AlbumTracks, albumKey));
+    }
+  }
+
+  auto observer = std::make_shared<RecordingQueryObserver>();
+  m_db.registerQueryObserver(observer);
+
+  QtSqlLib::RelationshipLoader loader(m_db, QtSqlLib::ID(Relationships::AlbumTracks));
+
+  std::vector<std::pair<QString, QtSqlLib::PrimaryKey>> albums;
+  {
+    auto results = m_db.execQuery(FROM_TABLE(TableIds::Albums)
+      .SELECT(AlbumsCols::Name)
+      .ORDER_BY(AlbumsCols::Id));
+
+    while (results.hasNextTuple())
+    {
+      const auto tuple = results.nextTuple();
+      albums.emplace_back(tuple.columnValue(AlbumsCols::Name).toString(), tuple.primaryKey());
+      loader.request(tuple.primaryKey());
+    }
+  }
+
+  EXPECT_EQ(loader.numPendingKeys(), 10);
+
+  for (size_t i=0; i<albums.size(); ++i)
+  {
+    const auto& tracks = loader.relatedTuples(albums[i].second);
+    ASSERT_EQ(tracks.size(), i);
+
+    for (const auto& track : tracks)
+    {
+      EXPECT_TRUE(track.columnValue(TracksCols::Name).toString().startsWith(QString("track%1_").arg(i)));
+    }
+  }
+
+  EXPECT_EQ(loader.numPendingKeys(), 0);
+  EXPECT_EQ(observer->numExecutions("SELECT"), 2);
+
+  m_db.unregisterQueryObserver(observer);
+}
+
+/**
+ * @test: Requests keys of different tables from the same relationship loader.
+ * @expected: An exception is thrown.
+ */
+TEST_F(TestRelationshipLoader, differentTables)
+{
+  QtSqlLib::RelationshipLoader loader(m_db, QtSqlLib::ID(Relationships::AlbumTracks));
+
+  loader.request(QtSqlLib::PrimaryKey(static_cast<IID::Type>(TableIds::Albums),
+    { QtSqlLib::PrimaryKey::ColumnValue { static_cast<IID::Type>(AlbumsCols::Id), 1 } }));
+
+  EXPECT_THROW(loader.request(QtSqlLib::PrimaryKey(static_cast<IID::Type>(TableIds::Tracks),
+    { QtSqlLib::PrimaryKey::ColumnValue { static_cast<IID::Type>(TracksCols::Id), 1 } })), DatabaseException);
+}
+
+/**
+ * @test: Requests the tracks of an album while the database is closed. Initializes the database again and requests
+ *        the tracks a second time.
+ * @expected: The first request throws an exception and the album does not count as loaded.
+ *            The second request loads the tracks of the album.
+ */
+TEST_F(TestRelationshipLoader, failedLoad)
+{
+  SchemaConfigurator configurator;
+  Funcs::configureAlbumsSchema(configurator);
+
+  m_db.initialize(configurator, Funcs::getDefaultDatabaseFilename());
+
+  const auto albumKey = m_db.execQuery(INSERT_INTO_EXT(TableIds::Albums)
+    .VALUE(AlbumsCols::Name, "album1")
+    .RETURN_IDS).nextTuple().primaryKey();
+
+  m_db.execQuery(INSERT_INTO_EXT(TableIds::Tracks)
+    .VALUE(TracksCols::Name, "track1")
+    .LINK_TO_ONE_TUPLE(Relationships::AlbumTracks, albumKey));
+
+  m_db.close();
+
+  QtSqlLib::RelationshipLoader loader(m_db, QtSqlLib::ID(Relationships::AlbumTracks));
+
+  EXPECT_THROW(loader.relatedTuples(albumKey), DatabaseException);
+  EXPECT_FALSE(loader.isLoaded(albumKey));
+  EXPECT_EQ(loader.numPendingKeys(), 1);
+
+  SchemaConfigurator secondConfigurator;
+  Funcs::configureAlbumsSchema(secondConfigurator);
+
+  m_db.initialize(secondConfigurator, Funcs::getDefaultDatabaseFilename());
+
+  const auto& tracks = loader.relatedTuples(albumKey);
+  ASSERT_EQ(tracks.size(), 1);
+  EXPECT_EQ(tracks[0].columnValue(TracksCols::Name).toString(), "track1");
+  EXPECT_EQ(loader.numPendingKeys(), 0);
+}
+
+}
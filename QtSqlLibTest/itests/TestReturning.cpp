@@ -0,0 +1,133 @@
+#include <gtest/gtest.h>
+
+#include <Common.h>
+
+#include <QFile>
+
+#include <set>
+
+namespace QtSqlLibTest
+{
+
+class TestReturning : public testing::Test
+{
+public:
+  TestReturning()
+  {
+    QFile::remove(Funcs::getDefaultDatabaseFilename());
+  }
+
+  ~TestReturning() override
+  {
+    m_db.close();
+  }
+
+  void setupTable1()
+  {
+    SchemaConfigurator configurator;
+    configurator.CONFIGURE_TABLE(TableIds::Table1, "table1")
+      .COLUMN(Table1Cols::Id, "id", DataType::Integer).PRIMARY_KEY.AUTO_INCREMENT.NOT_NULL
+      .COLUMN_VARCHAR(Table1Cols::Text, "text", 128)
+      .COLUMN(Table1Cols::Number, "number", DataType::Integer);
+
+    m_db.initialize(configurator, Funcs::getDefaultDatabaseFilename());
+  }
+
+  static std::set<int> collectIds(QtSqlLib::ResultSet& results)
+  {
+    std::set<int> ids;
+    while (results.hasNextTuple())
+    {
+      ids.insert(results.nextTuple().primaryKey().value(Table1Cols::Id).toInt());
+    }
+    return ids;
+  }
+
+  QtSqlLib::Database m_db;
+
+};
+
+/**
+ * @test: Inserts a single tuple and returns its id.
+ * @expected: The id of the inserted tuple is returned.
+ */
+TEST_F(TestReturning, insertInto)
+{
+  setupTable1();
+
+  m_db.execQuery(INSERT_INTO(TableIds::Table1).VALUE(Table1Cols::Number, 1));
+
+  auto results = m_db.execQuery(INSERT_INTO(TableIds::Table1)
+    .VALUE(Table1Cols::Number, 2)
+    .RETURN_IDS);
+
+  EXPECT_EQ(collectIds(results), std::set<int>({ 2 }));
+}
+
+/**
+ * @test: Inserts five tuples by a batch insert query returning ids.
+ * @expected: The ids of all inserted tuples are returned by one result set and the tuples contain the inserted values.
+ */
+TEST_F(TestReturning, batchInsertInto)
+{
+  setupTable1();
+
+  if (!m_db.isReturningSupported())
+  {
+    GTEST_SKIP() << "RETURNING clauses are not supported by the SQLite version.";
+  }
+
+  auto results = m_db.execQuery(BATCH_INSERT_INTO(TableIds::Table1)
+    .VALUES(Table1Cols::Text, QVariantList() << "a" << "b" << "c" << "d" << "e")
+    .VALUES(Table1Cols::Number, QVariantList() << 1 << 2 << 3 << 4 << 5)
+    .RETURN_IDS);
+
+  EXPECT_EQ(collectIds(results), std::set<int>({ 1, 2, 3, 4, 5 }));
+
+  auto tuples = m_db.execQuery(FROM_TABLE(TableIds::Table1)
+    .SELECT(Table1Cols::Text)
+    .WHERE(EQUAL(Table1Cols::Number, 4)));
+
+  ASSERT_TRUE(tuples.hasNextTuple());
+  EXPECT_EQ(tuples.nextTuple().columnValue(Table1Cols::Text).toString(), "d");
+
+  EXPECT_THROW(m_db.execQuery(BATCH_INSERT_INTO(TableIds::Table1)
+    .VALUES(Table1Cols::Text, QVariantList() << "a" << "b")
+    .VALUES(Table1Cols::Number, QVariantList() << 1)
+    .RETURN_IDS), DatabaseException);
+}
+
+/**
+ * @test: Updates and deletes tuples by queries returning ids.
+ * @expected: The ids of the updated and deleted tuples are returned.
+ */
+TEST_F(TestReturning, updateAndDelete)
+{
+  setupTable1();
+
+  if (!m_db.isReturningSupported())
+  {
+    GTEST_SKIP() << "RETURNING clauses are not supported by the SQLite version.";
+  }
+
+  m_db.execQuery(BATCH_INSERT_INTO(TableIds::Table1)
+    .VALUES(Table1Cols::Number, QVariantList() << 1 << 2 << 3 << 4 << 5));
+
+  auto updatedResults = m_db.execQuery(UPDATE_TABLE(TableIds::Table1)
+    .SET(Table1Cols::Text, "updated")
+    .WHERE(GREATER(Table1Cols::Number, 3))
+    .RETURN_IDS);
+
+  EXPECT_EQ(collectIds(updatedResults), std::set<int>({ 4, 5 }));
+
+  auto deletedResults = m_db.execQuery(DELETE_FROM(TableIds::Table1)
+    .WHERE(LESSEQUAL(Table1Cols::Number, 2))
+    .RETURN_IDS);
+
+  EXPECT_EQ(collectIds(deletedResults), std::set<int>({ 1, 2 }));
+
+  auto remaining = m_db.execQuery(FROM_TABLE(TableIds::Table1).SELECT(Table1Cols::Id));
+  EXPECT_EQ(collectIds(remaining), std::set<int>({ 3, 4, 5 }));
+}
+
+}
@@ -0,0 +1,187 @@
+#include <gtest/gtest.h>
+
+#include <Common.h>
+
+#include <QFile>
+
+#include <map>
+#include <thread>
+
+namespace QtSqlLibTest
+{
+
+class TestRowBlock : public testing::Test
+{
+public:
+  TestRowBlock()
+  {
+    QFile::remove(Funcs::getDefaultDatabaseFilename());
+  }
+
+  ~TestRowBlock() override
+  {
+    m_db.close();
+  }
+
+  QtSqlLib::Database m_db;
+
+};
+
+/**
+ * @test: Fetches the results of a query with five tuples in blocks of two tuples, reusing the same row block.
+ * @expected: The blocks contain two, two and one tuple with the expected values, then the result set is exhausted.
+ *            A block can be read by another thread after the result set was destroyed.
+ */
+TEST_F(TestRowBlock, fetchBlocks)
+{
+  SchemaConfigurator configurator;
+  configurator.CONFIGURE_TABLE(TableIds::Table1, "table1")
+    .COLUMN(Table1Cols::Id, "id", DataType::Integer).PRIMARY_KEY.AUTO_INCREMENT.NOT_NULL
+    .COLUMN_VARCHAR(Table1Cols::Text, "text", 128)
+    .COLUMN(Table1Cols::Number, "number", DataType::Integer);
+
+  m_db.initialize(configurator, Funcs::getDefaultDatabaseFilename());
+
+  m_db.execQuery(BATCH_INSERT_INTO(TableIds::Table1)
+    .VALUES(Table1Cols::Text, QVariantList() << "a" << "b" << "c" << "d" << "e")
+    .VALUES(Table1Cols::Number, QVariantList() << 1 << 2 << 3 << 4 << 5));
+
+  QtSqlLib::RowBlock block;
+  QStringList texts;
+
+  {
+    auto results = m_db.execQuery(FROM_TABLE(TableIds::Table1)
+      .SELECT(Table1Cols::Text, Table1Cols::Number)
+      .ORDER_BY(Table1Cols::Number));
+
+    EXPECT_EQ(results.nextBlock(block, 2), 2);
+    EXPECT_EQ(block.size(), 2);
+    EXPECT_EQ(block.row(0).columnValue(Table1Cols::Text).toString(), "a");
+    EXPECT_EQ(block.row(1).columnValue(Table1Cols::Number).toInt(), 2);
+    EXPECT_FALSE(block.row(1).isJoinedTuple());
+    EXPECT_EQ(block.row(1).primaryKey().value(Table1Cols::Id).toInt(), 2);
+
+    EXPECT_EQ(results.nextBlock(block, 2), 2);
+    EXPECT_EQ(block.row(0).columnValue(Table1Cols::Text).toString(), "c");
+    EXPECT_THROW(block.row(2), DatabaseException);
+
+    EXPECT_EQ(results.nextBlock(block, 2), 1);
+    EXPECT_EQ(block.row(0).columnValue(Table1Cols::Text).toString(), "e");
+  }
+
+  std::thread thread([&block, &texts]()
+  {
+    for (size_t i=0; i<block.size(); ++i)
+    {
+      texts.append(block.row(i).columnValue(Table1Cols::Text).toString());
+    }
+  });
+  thread.join();
+
+  EXPECT_EQ(texts, QStringList() << "e");
+}
+
+/**
+ * @test: Fetches the results of a query joining tracks to albums in blocks of one tuple.
+ * @expected: Each block contains one album followed by its joined tracks, which refer to the album row.
+ */
+TEST_F(TestRowBlock, joinedTuples)
+{
+  SchemaConfigurator configurator;
+  Funcs::configureAlbumsSchema(configurator);
+
+  m_db.initialize(configurator, Funcs::getDefaultDatabaseFilename());
+
+  for (auto i=0; i<2; ++i)
+  {
+    const auto albumKey = m_db.execQuery(INSERT_INTO_EXT(TableIds::Albums)
+      .VALUE(AlbumsCols::Name, QString("album%1").arg(i))
+      .RETURN_IDS).nextTuple().primaryKey();
+
+    for (auto j=0; j<3; ++j)
+    {
+      m_db.execQuery(INSERT_INTO_EXT(TableIds::Tracks)
+        .VALUE(TracksCols::Name, QString("track%1").arg(j))
+        .LINK_TO_ONE_TUPLE(Relationships::AlbumTracks, albumKey));
+    }
+  }
+
+  auto results = m_db.execQuery(FROM_TABLE(TableIds::Albums)
+    .SELECT_ALL
+    .JOIN_ALL(Relationships::AlbumTracks)
+    .ORDER_BY(AlbumsCols::Id));
+
+  QtSqlLib::RowBlock block;
+  size_t numBlocks = 0;
+
+  while (results.nextBlock(block, 1) > 0)
+  {
+    ASSERT_EQ(block.size(), 4);
+    EXPECT_EQ(block.numTuples(), 1);
+    EXPECT_EQ(block.row(0).tableId(), static_cast<IID::Type>(TableIds::Albums));
+
+    for (size_t i=1; i<block.size(); ++i)
+    {
+      const auto row = block.row(i);
+      EXPECT_TRUE(row.isJoinedTuple());
+      EXPECT_EQ(row.parentRow(), 0);
+      EXPECT_EQ(row.relationshipId().value(), static_cast<IID::Type>(Relationships::AlbumTracks));
+      EXPECT_TRUE(row.hasColumnValue(TracksCols::Name));
+    }
+    numBlocks++;
+  }
+
+  EXPECT_EQ(numBlocks, 2);
+  EXPECT_TRUE(block.isEmpty());
+}
+
+
+/**
+ * @test: Fetches the results of a query joining the albums to the artists and the tracks to the albums in blocks of
+ *        one tuple.
+ * @expected: The albums refer to the artist row and the tracks refer to the rows of their albums. The parent primary
+ *            keys of the rows are the primary keys of their parent rows.
+ */
+TEST_F(TestRowBlock, nestedJoinedTuples)
+{
+  SchemaConfigurator configurator;
+  Funcs::configureAlbumsSchema(configurator);
+
+  m_db.initialize(configurator, Funcs::getDefaultDatabaseFilename());
+  Funcs::insertArtistsAlbumsTracks(m_db);
+
+  auto results = m_db.execQuery(FROM_TABLE(TableIds::Artists)
+    .SELECT_ALL
+    .JOIN_ALL_PATH(Relationships::AlbumArtists, Relationships::AlbumTracks)
+    .ORDER_BY(ArtistsCols::Name));
+
+  QtSqlLib::RowBlock block;
+  ASSERT_EQ(results.nextBlock(block, 1), 1);
+  EXPECT_EQ(block.row(0).columnValue(ArtistsCols::Name).toString(), "artist1");
+  EXPECT_EQ(block.row(0).parentPrimaryKey().numValues(), 0);
+
+  std::map<QString, QString> albumNamesOfTracks;
+  for (size_t i=1; i<block.size(); ++i)
+  {
+    const auto row = block.row(i);
+    const auto parentRow = block.row(row.parentRow());
+    EXPECT_EQ(row.parentPrimaryKey(), parentRow.primaryKey());
+
+    if (row.relationshipId().value() == static_cast<IID::Type>(Relationships::AlbumArtists))
+    {
+      EXPECT_EQ(row.parentRow(), 0);
+      EXPECT_FALSE(row.parentRelationshipId().has_value());
+    }
+    else
+    {
+      EXPECT_EQ(row.parentRelationshipId().value(), static_cast<IID::Type>(Relationships::AlbumArtists));
+      EXPECT_EQ(parentRow.relationshipId().value(), static_cast<IID::Type>(Relationships::AlbumArtists));
+      albumNamesOfTracks[row.columnValue(TracksCols::Name).toString()] =
+        parentRow.columnValue(AlbumsCols::Name).toString();
+    }
+  }
+
+  EXPECT_EQ(albumNamesOfTracks, (std::map<QString, QString> {
+    { "track1", "album1" }, { "track2", "album1" }, { "track3", "album2" } }));
+}
+}
@@ -0,0 +1,163 @@
+#include <gtest/gtest.h>
+
+#include <Common.h>
+
+#include <QtSqlLib/RowMapping.h>
+
+#include <QFile>
+
+#include <set>
+
+namespace QtSqlLibTest
+{
+
+struct Album
+{
+  int id = 0;
+  QString name;
+};
+
+struct Track
+{
+  int64_t id = 0;
+  QString name;
+  double length = 0.0;
+  std::optional<int> rating;
+};
+
+}
+
+QTSQLLIB_MAP(QtSqlLibTest::Album,
+  (QtSqlLibTest::AlbumsCols::Id, &QtSqlLibTest::Album::id),
+  (QtSqlLibTest::AlbumsCols::Name, &QtSqlLibTest::Album::name))
+
+QTSQLLIB_MAP(QtSqlLibTest::Track,
+  (QtSqlLibTest::TracksCols::Id, &QtSqlLibTest::Track::id),
+  (QtSqlLibTest::TracksCols::Name, &QtSqlLibTest::Track::name),
+  (QtSqlLibTest::TracksCols::Length, &QtSqlLibTest::Track::length),
+  (QtSqlLibTest::TracksCols::Rating, &QtSqlLibTest::Track::rating))
+
+namespace QtSqlLibTest
+{
+
+class TestRowMapping : public testing::Test
+{
+public:
+  TestRowMapping()
+  {
+    QFile::remove(Funcs::getDefaultDatabaseFilename());
+  }
+
+  ~TestRowMapping() override
+  {
+    m_db.close();
+  }
+
+  void setupAlbumTracks()
+  {
+    SchemaConfigurator configurator;
+    configurator.CONFIGURE_TABLE(TableIds::Albums, "albums")
+      .COLUMN(AlbumsCols::Id, "id", DataType::Integer).PRIMARY_KEY.AUTO_INCREMENT.NOT_NULL
+      .COLUMN_VARCHAR(AlbumsCols::Name, "name", 128).NOT_NULL;
+
+    configurator.CONFIGURE_TABLE(TableIds::Tracks, "tracks")
+      .COLUMN(TracksCols::Id, "id", DataType::Integer).PRIMARY_KEY.AUTO_INCREMENT.NOT_NULL
+      .COLUMN_VARCHAR(TracksCols::Name, "name", 128).NOT_NULL
+      .COLUMN(TracksCols::Length, "length", DataType::Real).NOT_NULL
+      .COLUMN(TracksCols::Rating, "rating", DataType::Integer);
+
+    configurator.CONFIGURE_RELATIONSHIP(Relationships::AlbumTracks, TableIds::Albums, TableIds::Tracks,
+      QtSqlLib::API::RelationshipType::OneToMany);
+
+    m_db.initialize(configurator, Funcs::getDefaultDatabaseFilename());
+
+    const auto albumKey = m_db.execQuery(INSERT_INTO_EXT(TableIds::Albums)
+      .VALUE(AlbumsCols::Name, "album")
+      .RETURN_IDS).nextTuple().primaryKey();
+
+    m_db.execQuery(INSERT_INTO_EXT(TableIds::Tracks)
+      .VALUE(TracksCols::Name, "track1")
+      .VALUE(TracksCols::Length, 120.5)
+      .VALUE(TracksCols::Rating, 4)
+      .LINK_TO_ONE_TUPLE(Relationships::AlbumTracks, albumKey));
+
+    m_db.execQuery(INSERT_INTO_EXT(TableIds::Tracks)
+      .VALUE(TracksCols::Name, "track2")
+      .VALUE(TracksCols::Length, 200.0)
+      .LINK_TO_ONE_TUPLE(Relationships::AlbumTracks, albumKey));
+  }
+
+  QtSqlLib::Database m_db;
+
+};
+
+/**
+ * @test: Maps the tuples of a FromTable query to structs, including a nullable column mapped to an optional member.
+ * @expected: The struct members contain the column values of the tuples.
+ */
+TEST_F(TestRowMapping, mapTuples)
+{
+  setupAlbumTracks();
+
+  auto results = m_db.execQuery(FROM_TABLE(TableIds::Tracks)
+    .SELECT_ALL
+    .ORDER_BY(TracksCols::Id));
+
+  QtSqlLib::RowMapper<Track> mapper(results);
+
+  std::vector<Track> tracks;
+  while (results.hasNextTuple())
+  {
+    tracks.emplace_back(mapper.map(results.nextTuple()));
+  }
+
+  ASSERT_EQ(tracks.size(), 2);
+  EXPECT_EQ(tracks[0].id, 1);
+  EXPECT_EQ(tracks[0].name, "track1");
+  EXPECT_DOUBLE_EQ(tracks[0].length, 120.5);
+  ASSERT_TRUE(tracks[0].rating.has_value());
+  EXPECT_EQ(tracks[0].rating.value(), 4);
+
+  EXPECT_EQ(tracks[1].name, "track2");
+  EXPECT_FALSE(tracks[1].rating.has_value());
+}
+
+/**
+ * @test: Maps the tuples and the joined tuples of a FromTable query to structs. Maps a query that does not select
+ *        all mapped columns.
+ * @expected: Albums and joined tracks are mapped correctly.
+ *            Mapping a tuple with missing columns throws an exception.
+ */
+TEST_F(TestRowMapping, mapJoinedTuples)
+{
+  setupAlbumTracks();
+
+  auto results = m_db.execQuery(FROM_TABLE(TableIds::Albums)
+    .SELECT_ALL
+    .JOIN_ALL(Relationships::AlbumTracks));
+
+  QtSqlLib::RowMapper<Album> albumMapper(results);
+  QtSqlLib::RowMapper<Track> trackMapper(results);
+
+  ASSERT_TRUE(results.hasNextTuple());
+  const auto album = albumMapper.map(results.nextTuple());
+  EXPECT_EQ(album.id, 1);
+  EXPECT_EQ(album.name, "album");
+
+  std::set<QString> trackNames;
+  while (results.hasNextJoinedTuple())
+  {
+    trackNames.insert(trackMapper.map(results.nextJoinedTuple()).name);
+  }
+
+  EXPECT_EQ(trackNames, std::set<QString>({ "track1", "track2" }));
+
+  auto partialResults = m_db.execQuery(FROM_TABLE(TableIds::Tracks)
+    .SELECT(TracksCols::Name));
+
+  QtSqlLib::RowMapper<Track> partialMapper(partialResults);
+  ASSERT_TRUE(partialResults.hasNextTuple());
+  EXPECT_THROW(partialMapper.map(partialResults.nextTuple()), DatabaseException);
+}
+
+}
@@ -0,0 +1,189 @@
+#include <gtest/gtest.h>
+
+#include <Common.h>
+
+#include <QFile>
+
+#include <set>
+
+namespace QtSqlLibTest
+{
+
+class TestSplitJoins : public testing::Test
+{
+public:
+  TestSplitJoins()
+  {
+    QFile::remove(Funcs::getDefaultDatabaseFilename());
+  }
+
+  ~TestSplitJoins() override
+  {
+    m_db.close();
+  }
+
+  void setupAlbums()
+  {
+    SchemaConfigurator configurator;
+    Funcs::configureAlbumsSchema(configurator);
+
+    m_db.initialize(configurator, Funcs::getDefaultDatabaseFilename());
+
+    // album1 has four tracks and four artists, album2 has no tracks and one artist
+    for (auto i=1; i<=2; ++i)
+    {
+      const auto albumKey = m_db.execQuery(INSERT_INTO_EXT(TableIds::Albums)
+        .VALUE(AlbumsCols::Name, QString("album%1").arg(i))
+        .RETURN_IDS).nextTuple().primaryKey();
+
+      const auto numChildren = (i == 1) ? 4 : 1;
+      for (auto j=0; j<numChildren; ++j)
+      {
+        if (i == 1)
+        {
+          m_db.execQuery(INSERT_INTO_EXT(TableIds::Tracks)
+            .VALUE(TracksCols::Name, QString("track%1").arg(j))
+            .LINK_TO_ONE_TUPLE(Relationships::AlbumTracks, albumKey));
+        }
+
+        m_db.execQuery(INSERT_INTO_EXT(TableIds::Artists)
+          .VALUE(ArtistsCols::Name, QString("artist%1_%2").arg(i).arg(j))
+          .LINK_TO_ONE_TUPLE(Relationships::AlbumArtists, albumKey));
+      }
+    }
+  }
+
+  struct AlbumData
+  {
+    QString name;
+    std::set<QString> tracks;
+    std::set<QString> artists;
+  };
+
+  static std::vector<AlbumData> readAlbums(QtSqlLib::ResultSet& results)
+  {
+    std::vector<AlbumData> albums;
+    while (results.hasNextTuple())
+    {
+      AlbumData album;
+      album.name = results.nextTuple().columnValue(AlbumsCols::Name).toString();
+
+      while (results.hasNextJoinedTuple())
+      {
+        const auto tuple = results.nextJoinedTuple();
+        if (tuple.relationshipId().value() == static_cast<IID::Type>(Relationships::AlbumTracks))
+        {
+          album.tracks.insert(tuple.columnValue(TracksCols::Name).toString());
+        }
+        else
+        {
+          album.artists.insert(tuple.columnValue(ArtistsCols::Name).toString());
+        }
+      }
+      albums.emplace_back(std::move(album));
+    }
+    return albums;
+  }
+
+  QtSqlLib::Database m_db;
+
+};
+
+/**
+ * @test: Queries albums joined with tracks and artists, once with a single query and once with split joins.
+ * @expected: Both queries return the same tuples and joined tuples. The split query fetches the sum of the rows of
+ *            the tuples and the joined tuples instead of their product.
+ */
+TEST_F(TestSplitJoins, splitJoins)
+{
+  setupAlbums();
+
+  auto observer = std::make_shared<RecordingQueryObserver>();
+  m_db.registerQueryObserver(observer);
+
+  std::vector<AlbumData> joinedAlbums;
+  {
+    auto results = m_db.execQuery(FROM_TABLE(TableIds::Albums)
+      .SELECT_ALL
+      .JOIN_ALL(Relationships::AlbumTracks)
+      .JOIN_ALL(Relationships::AlbumArtists)
+      .ORDER_BY(AlbumsCols::Name));
+
+    joinedAlbums = readAlbums(results);
+  }
+
+  EXPECT_EQ(observer->numRowsFetched(), 17);
+  observer->clear();
+
+  std::vector<AlbumData> splitAlbums;
+  {
+    auto results = m_db.execQuery(FROM_TABLE(TableIds::Albums)
+      .SELECT_ALL
+      .JOIN_ALL(Relationships::AlbumTracks)
+      .JOIN_ALL(Relationships::AlbumArtists)
+      .ORDER_BY(AlbumsCols::Name)
+      .SPLIT_JOINS);
+
+    splitAlbums = readAlbums(results);
+  }
+
+  // 2 albums, 4 tracks, 5 artists
+  EXPECT_EQ(observer->numRowsFetched(), 11);
+
+  ASSERT_EQ(splitAlbums.size(), 2);
+  ASSERT_EQ(joinedAlbums.size(), 2);
+  for (size_t i=0; i<splitAlbums.size(); ++i)
+  {
+    EXPECT_EQ(splitAlbums[i].name, joinedAlbums[i].name);
+    EXPECT_EQ(splitAlbums[i].tracks, joinedAlbums[i].tracks);
+    EXPECT_EQ(splitAlbums[i].artists, joinedAlbums[i].artists);
+  }
+
+  EXPECT_EQ(splitAlbums[0].tracks.size(), 4);
+  EXPECT_EQ(splitAlbums[0].artists.size(), 4);
+  EXPECT_TRUE(splitAlbums[1].tracks.empty());
+  EXPECT_EQ(splitAlbums[1].artists, std::set<QString>({ "artist2_0" }));
+}
+
+/**
+ * @test: Queries albums with split joins and a where clause, then iterates the results a second time.
+ *        Tries to order or filter a split join query by a joined column.
+ * @expected: Only the filtered album and its joined tuples are returned, also after resetting the iteration.
+ *            Ordering or filtering by a joined column throws an exception.
+ */
+TEST_F(TestSplitJoins, whereAndResetIteration)
+{
+  setupAlbums();
+
+  auto results = m_db.execQuery(FROM_TABLE(TableIds::Albums)
+    .SELECT_ALL
+    .JOIN_ALL(Relationships::AlbumTracks)
+    .JOIN_ALL(Relationships::AlbumArtists)
+    .WHERE(EQUAL(AlbumsCols::Name, "album1"))
+    .SPLIT_JOINS);
+
+  for (auto i=0; i<2; ++i)
+  {
+    const auto albums = readAlbums(results);
+    ASSERT_EQ(albums.size(), 1);
+    EXPECT_EQ(albums[0].name, "album1");
+    EXPECT_EQ(albums[0].tracks.size(), 4);
+    EXPECT_EQ(albums[0].artists.size(), 4);
+
+    results.resetIteration();
+  }
+
+  EXPECT_THROW(m_db.execQuery(FROM_TABLE(TableIds::Albums)
+    .SELECT_ALL
+    .JOIN_ALL(Relationships::AlbumTracks)
+    .ORDER_BY(COL(Relationships::AlbumTracks, TracksCols::Name))
+    .SPLIT_JOINS), DatabaseException);
+
+  EXPECT_THROW(m_db.execQuery(FROM_TABLE(TableIds::Albums)
+    .SELECT_ALL
+    .JOIN_ALL(Relationships::AlbumTracks)
+    .WHERE(EQUAL(COL(Relationships::AlbumTracks, TracksCols::Name), "track0"))
+    .SPLIT_JOINS), DatabaseException);
+}
+
+}
@@ -0,0 +1,259 @@
+#include <gtest/gtest.h>
+
+#include <Common.h>
+
+#include <QtSqlLib/StatementCache.h>
+
+#include <QFile>
+
+#include <future>
+#include <thread>
+
+namespace QtSqlLibTest
+{
+
+class SchemaStatementQuery : public Query
+{
+public:
+  SchemaStatementQuery(const QString& queryString) :
+    m_queryString(queryString)
+  {
+  }
+
+  SqlQuery getSqlQuery(const QSqlDatabase& db, ISchema& /*schema*/, QtSqlLib::ResultSet& /*previousQueryResults*/) override
+  {
+    return { QtSqlLib::StatementCache::prepare(db, m_queryString) };
+  }
+
+private:
+  QString m_queryString;
+
+};
+
+class TestStatementCache : public testing::Test
+{
+public:
+  TestStatementCache()
+  {
+    QFile::remove(Funcs::getDefaultDatabaseFilename());
+  }
+
+  ~TestStatementCache() override
+  {
+    m_db.close();
+  }
+
+  void setupTestDatabase()
+  {
+    SchemaConfigurator configurator;
+    configurator.CONFIGURE_TABLE(TableIds::Table1, "table1")
+      .COLUMN(Table1Cols::Id, "id", DataType::Integer).PRIMARY_KEY.AUTO_INCREMENT.NOT_NULL
+      .COLUMN_VARCHAR(Table1Cols::Text, "text", 128)
+      .COLUMN(Table1Cols::Number, "number", DataType::Integer);
+
+    m_db.initialize(configurator, Funcs::getDefaultDatabaseFilename());
+
+    m_db.execQuery(BATCH_INSERT_INTO(TableIds::Table1)
+      .VALUES(Table1Cols::Text, QVariantList() << "value1" << "value2" << "value3")
+      .VALUES(Table1Cols::Number, QVariantList() << 1 << 2 << 3));
+  }
+
+  QtSqlLib::Database m_db;
+
+};
+
+/**
+ * @test: Executes the same select query with different bound values multiple times.
+ * @expected: The first execution is a cache miss, every following execution is a cache hit.
+ *            Each query delivers the correct results.
+ */
+TEST_F(TestStatementCache, reuseStatement)
+{
+  setupTestDatabase();
+
+  const auto initialStatistics = m_db.getStatementCacheStatistics();
+
+  for (auto i = 1; i <= 3; i++)
+  {
+    auto results = m_db.execQuery(FROM_TABLE(TableIds::Table1)
+      .SELECT(Table1Cols::Text)
+      .WHERE(EQUAL(Table1Cols::Number, i)));
+
+    EXPECT_EQ(Funcs::numResults(results), 1);
+    EXPECT_TRUE(Funcs::isResultTuplesContaining(results, TableIds::Table1, Table1Cols::Text,
+      QString("value%1").arg(i)));
+  }
+
+  const auto statistics = m_db.getStatementCacheStatistics();
+
+  EXPECT_EQ(statistics.misses - initialStatistics.misses, 1U);
+  EXPECT_EQ(statistics.hits - initialStatistics.hits, 2U);
+}
+
+/**
+ * @test: Executes the same select query twice while the result set of the first execution is still alive.
+ * @expected: The second execution does not reuse the statement of the first one.
+ *            Both result sets deliver their own correct results.
+ */
+TEST_F(TestStatementCache, statementInUse)
+{
+  setupTestDatabase();
+
+  auto results1 = m_db.execQuery(FROM_TABLE(TableIds::Table1)
+    .SELECT(Table1Cols::Text)
+    .WHERE(EQUAL(Table1Cols::Number, 1)));
+
+  auto results2 = m_db.execQuery(FROM_TABLE(TableIds::Table1)
+    .SELECT(Table1Cols::Text)
+    .WHERE(EQUAL(Table1Cols::Number, 2)));
+
+  EXPECT_EQ(Funcs::numResults(results1), 1);
+  EXPECT_TRUE(Funcs::isResultTuplesContaining(results1, TableIds::Table1, Table1Cols::Text, "value1"));
+
+  EXPECT_EQ(Funcs::numResults(results2), 1);
+  EXPECT_TRUE(Funcs::isResultTuplesContaining(results2, TableIds::Table1, Table1Cols::Text, "value2"));
+}
+
+/**
+ * @test: Disables the statement cache and executes the same insert query multiple times.
+ * @expected: No statement is cached and no cache hits occur.
+ */
+TEST_F(TestStatementCache, cacheDisabled)
+{
+  setupTestDatabase();
+  m_db.setStatementCacheCapacity(0);
+
+  const auto initialStatistics = m_db.getStatementCacheStatistics();
+
+  for (auto i = 0; i < 3; i++)
+  {
+    m_db.execQuery(INSERT_INTO(TableIds::Table1)
+      .VALUE(Table1Cols::Text, "text")
+      .VALUE(Table1Cols::Number, i));
+  }
+
+  const auto statistics = m_db.getStatementCacheStatistics();
+
+  EXPECT_EQ(statistics.hits, initialStatistics.hits);
+  EXPECT_EQ(statistics.numCachedStatements, 0U);
+}
+
+/**
+ * @test: Caches a select statement on a pooled connection of a worker thread. Executes a schema statement on the
+ *        connection of the main thread and the select query on the worker thread again.
+ * @expected: The schema statement does not drop the statement cached by the worker thread. The worker thread drops
+ *            its stale statement itself, so its second execution is a cache miss.
+ */
+TEST_F(TestStatementCache, schemaStatementOnOtherConnection)
+{
+  m_db.setConnectionPoolSize(1);
+  setupTestDatabase();
+
+  const auto execSelectQuery = [this]()
+  {
+    auto results = m_db.execQuery(FROM_TABLE(TableIds::Table1)
+      .SELECT(Table1Cols::Text)
+      .WHERE(EQUAL(Table1Cols::Number, 1)));
+
+    return Funcs::numResults(results);
+  };
+
+  std::promise<void> statementCached;
+  std::promise<void> schemaChanged;
+  std::promise<void> statementReused;
+
+  std::thread worker([&]()
+  {
+    EXPECT_EQ(execSelectQuery(), 1U);
+    statementCached.set_value();
+
+    schemaChanged.get_future().wait();
+    EXPECT_EQ(execSelectQuery(), 1U);
+    statementReused.set_value();
+  });
+
+  statementCached.get_future().wait();
+
+  SchemaStatementQuery createTableQuery("CREATE TABLE 'table3' ('id' INTEGER);");
+  m_db.execQuery(createTableQuery);
+
+  const auto statistics = m_db.getStatementCacheStatistics();
+  EXPECT_GE(statistics.numCachedStatements, 1U);
+
+  auto statementReusedFuture = statementReused.get_future();
+  schemaChanged.set_value();
+  statementReusedFuture.wait();
+
+  const auto finalStatistics = m_db.getStatementCacheStatistics();
+  EXPECT_EQ(finalStatistics.hits, statistics.hits);
+  EXPECT_EQ(finalStatistics.misses, statistics.misses + 1);
+
+  worker.join();
+}
+
+/**
+ * @test: Caches a select statement and executes statements creating and dropping a temporary table.
+ * @expected: The cached statement is kept, so the following execution of the select query is a cache hit.
+ */
+TEST_F(TestStatementCache, tempSchemaStatement)
+{
+  setupTestDatabase();
+
+  const auto execSelectQuery = [this]()
+  {
+    auto results = m_db.execQuery(FROM_TABLE(TableIds::Table1)
+      .SELECT(Table1Cols::Text)
+      .WHERE(EQUAL(Table1Cols::Number, 1)));
+
+    EXPECT_EQ(Funcs::numResults(results), 1U);
+  };
+
+  execSelectQuery();
+  const auto initialStatistics = m_db.getStatementCacheStatistics();
+
+  SchemaStatementQuery createTableQuery("CREATE TEMP TABLE 'staging' ('id' INTEGER);");
+  m_db.execQuery(createTableQuery);
+
+  SchemaStatementQuery dropTableQuery("DROP TABLE IF EXISTS temp.'staging';");
+  m_db.execQuery(dropTableQuery);
+
+  execSelectQuery();
+
+  const auto statistics = m_db.getStatementCacheStatistics();
+  EXPECT_EQ(statistics.hits, initialStatistics.hits + 1);
+  EXPECT_EQ(statistics.misses, initialStatistics.misses);
+}
+
+/**
+ * @test: Executes queries, closes the database and initializes it again with the same connection name.
+ * @expected: The statistics of the closed database are not carried over to the initialized one.
+ */
+TEST_F(TestStatementCache, statisticsAfterReinitialization)
+{
+  setupTestDatabase();
+
+  const auto initialStatistics = m_db.getStatementCacheStatistics();
+
+  for (auto i = 0; i < 3; i++)
+  {
+    auto results = m_db.execQuery(FROM_TABLE(TableIds::Table1).SELECT(Table1Cols::Text));
+    EXPECT_EQ(Funcs::numResults(results), 3U);
+  }
+
+  EXPECT_GT(m_db.getStatementCacheStatistics().hits, initialStatistics.hits);
+
+  m_db.close();
+
+  const auto closedStatistics = m_db.getStatementCacheStatistics();
+  EXPECT_EQ(closedStatistics.hits, 0U);
+  EXPECT_EQ(closedStatistics.misses, 0U);
+
+  QFile::remove(Funcs::getDefaultDatabaseFilename());
+  setupTestDatabase();
+
+  const auto statistics = m_db.getStatementCacheStatistics();
+  EXPECT_EQ(statistics.hits, initialStatistics.hits);
+  EXPECT_EQ(statistics.misses, initialStatistics.misses);
+}
+
+}
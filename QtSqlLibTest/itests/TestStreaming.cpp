@@ -0,0 +1,127 @@
+#include <gtest/gtest.h>
+
+#include <Common.h>
+
+#include <QFile>
+
+namespace QtSqlLibTest
+{
+
+class TestStreaming : public testing::Test
+{
+public:
+  TestStreaming()
+  {
+    QFile::remove(Funcs::getDefaultDatabaseFilename());
+  }
+
+  ~TestStreaming() override
+  {
+    m_db.close();
+  }
+
+  void setupAlbumTracks()
+  {
+    SchemaConfigurator configurator;
+    Funcs::configureAlbumsSchema(configurator);
+
+    m_db.initialize(configurator, Funcs::getDefaultDatabaseFilename());
+
+    std::vector<QtSqlLib::PrimaryKey> albumKeys;
+    for (auto i=0; i<3; ++i)
+    {
+      albumKeys.emplace_back(m_db.execQuery(INSERT_INTO_EXT(TableIds::Albums)
+        .VALUE(AlbumsCols::Name, QString("album%1").arg(i))
+        .RETURN_IDS).nextTuple().primaryKey());
+    }
+
+    // tracks are linked alternately, so the joined rows of an album are not adjacent in rowid order
+    for (auto i=0; i<6; ++i)
+    {
+      const auto trackKey = m_db.execQuery(INSERT_INTO_EXT(TableIds::Tracks)
+        .VALUE(TracksCols::Name, QString("track%1").arg(i))
+        .RETURN_IDS).nextTuple().primaryKey();
+
+      m_db.execQuery(LINK_TUPLES(Relationships::AlbumTracks)
+        .FROM_ONE(albumKeys.at(i % albumKeys.size()))
+        .TO_ONE(trackKey));
+    }
+  }
+
+  QtSqlLib::Database m_db;
+
+};
+
+/**
+ * @test: Iterates a streaming query joining tracks to albums, whose tracks were linked alternately.
+ * @expected: The result set is forward-only and delivers each album exactly once, followed by all its tracks.
+ *            Resetting the iteration after it has started throws an exception.
+ */
+TEST_F(TestStreaming, joinedTuples)
+{
+  setupAlbumTracks();
+
+  auto results = m_db.execQuery(FROM_TABLE(TableIds::Albums)
+    .SELECT_ALL
+    .JOIN_ALL(Relationships::AlbumTracks)
+    .STREAMING);
+
+  EXPECT_TRUE(results.isForwardOnly());
+  EXPECT_NO_THROW(results.resetIteration());
+
+  std::set<QString> albumNames;
+  size_t numTracks = 0;
+
+  while (results.hasNextTuple())
+  {
+    const auto album = results.nextTuple();
+    EXPECT_TRUE(albumNames.insert(album.columnValue(AlbumsCols::Name).toString()).second);
+
+    size_t numAlbumTracks = 0;
+    while (results.hasNextJoinedTuple())
+    {
+      static_cast<void>(results.nextJoinedTuple());
+      numAlbumTracks++;
+    }
+
+    EXPECT_EQ(numAlbumTracks, 2);
+    numTracks += numAlbumTracks;
+  }
+
+  EXPECT_EQ(albumNames.size(), 3);
+  EXPECT_EQ(numTracks, 6);
+
+  EXPECT_THROW(results.resetIteration(), DatabaseException);
+}
+
+/**
+ * @test: Executes streaming queries with a custom order of the queried table and of a joined table.
+ * @expected: The order of the queried table is preserved.
+ *            Ordering by a column of the joined table throws an exception.
+ */
+TEST_F(TestStreaming, ordering)
+{
+  setupAlbumTracks();
+
+  auto results = m_db.execQuery(FROM_TABLE(TableIds::Albums)
+    .SELECT_ALL
+    .JOIN_ALL(Relationships::AlbumTracks)
+    .ORDER_BY(AlbumsCols::Name DESC)
+    .STREAMING);
+
+  QStringList albumNames;
+  while (results.hasNextTuple())
+  {
+    albumNames.append(results.nextTuple().columnValue(AlbumsCols::Name).toString());
+  }
+
+  EXPECT_EQ(albumNames, QStringList() << "album2" << "album1" << "album0");
+
+  EXPECT_THROW(m_db.execQuery(FROM_TABLE(TableIds::Albums)
+    .SELECT_ALL
+    .JOIN_ALL(Relationships::AlbumTracks)
+    .ORDER_BY(COL(Relationships::AlbumTracks, TracksCols::Name))
+    .STREAMING), DatabaseException);
+}
+
+}
@@ -0,0 +1,130 @@
+#include <gtest/gtest.h>
+
+#include <Common.h>
+
+#include <QFile>
+
+namespace QtSqlLibTest
+{
+
+class TestTransactions : public testing::Test
+{
+public:
+  TestTransactions()
+  {
+    QFile::remove(Funcs::getDefaultDatabaseFilename());
+  }
+
+  ~TestTransactions() override
+  {
+    m_db.close();
+  }
+
+  void setupTestDatabase(const QString& databaseName = QSqlDatabase::defaultConnection)
+  {
+    SchemaConfigurator configurator;
+    configurator.CONFIGURE_TABLE(TableIds::Table1, "table1")
+      .COLUMN(Table1Cols::Id, "id", DataType::Integer).PRIMARY_KEY.AUTO_INCREMENT.NOT_NULL
+      .COLUMN_VARCHAR(Table1Cols::Text, "text", 128).NOT_NULL;
+
+    m_db.initialize(configurator, Funcs::getDefaultDatabaseFilename(), databaseName);
+  }
+
+  void insertText(const QString& text)
+  {
+    m_db.execQuery(INSERT_INTO(TableIds::Table1).VALUE(Table1Cols::Text, text));
+  }
+
+  size_t numTuples()
+  {
+    auto results = m_db.execQuery(FROM_TABLE(TableIds::Table1).SELECT(Table1Cols::Text));
+    return Funcs::numResults(results);
+  }
+
+  QtSqlLib::Database m_db;
+
+};
+
+/**
+ * @test: Executes multiple insert queries within one explicit transaction, once committed and once rolled back by
+ *        leaving the scope.
+ * @expected: The committed tuples are stored, the rolled back tuples are discarded.
+ */
+TEST_F(TestTransactions, commitAndRollback)
+{
+  setupTestDatabase();
+
+  {
+    auto transaction = m_db.beginTransaction();
+    insertText("value1");
+    insertText("value2");
+    transaction.commit();
+
+    EXPECT_FALSE(transaction.isActive());
+  }
+
+  EXPECT_EQ(numTuples(), 2);
+
+  {
+    auto transaction = m_db.beginTransaction();
+    insertText("value3");
+
+    EXPECT_EQ(numTuples(), 3);
+  }
+
+  EXPECT_EQ(numTuples(), 2);
+}
+
+/**
+ * @test: Rolls back a nested transaction and commits the outer one.
+ *        Then executes a failing query within an explicit transaction.
+ * @expected: Only the tuples of the nested transaction are discarded.
+ *            The failing query does not affect the changes made before within the same transaction.
+ */
+TEST_F(TestTransactions, nestedTransactions)
+{
+  setupTestDatabase();
+
+  auto transaction = m_db.beginTransaction();
+  insertText("value1");
+
+  {
+    auto nestedTransaction = m_db.beginTransaction();
+    EXPECT_TRUE(nestedTransaction.isNested());
+
+    insertText("value2");
+
+    EXPECT_THROW(transaction.commit(), DatabaseException);
+    nestedTransaction.rollback();
+  }
+
+  EXPECT_THROW(m_db.execQuery(INSERT_INTO(TableIds::Table1).VALUE(Table1Cols::Text, QVariant())), DatabaseException);
+
+  transaction.commit();
+
+  auto results = m_db.execQuery(FROM_TABLE(TableIds::Table1).SELECT(Table1Cols::Text));
+
+  EXPECT_EQ(Funcs::numResults(results), 1);
+  EXPECT_TRUE(Funcs::isResultTuplesContaining(results, TableIds::Table1, Table1Cols::Text, "value1"));
+}
+
+/**
+ * @test: Uses a database connection with a non-default name and rolls back an explicit transaction.
+ * @expected: The tables are created on the named connection and the transaction is applied to it.
+ */
+TEST_F(TestTransactions, namedConnection)
+{
+  setupTestDatabase("named_connection");
+
+  insertText("value1");
+
+  {
+    auto transaction = m_db.beginTransaction();
+    insertText("value2");
+    transaction.rollback();
+  }
+
+  EXPECT_EQ(numTuples(), 1);
+}
+
+}
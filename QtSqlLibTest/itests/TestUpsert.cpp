@@ -0,0 +1,171 @@
+#include <gtest/gtest.h>
+
+#include <Common.h>
+
+#include <QFile>
+
+#include <map>
+
+namespace QtSqlLibTest
+{
+
+class TestUpsert : public testing::Test
+{
+public:
+  TestUpsert()
+  {
+    QFile::remove(Funcs::getDefaultDatabaseFilename());
+  }
+
+  ~TestUpsert() override
+  {
+    m_db.close();
+  }
+
+  void setupTable1(bool hasUniqueCols)
+  {
+    SchemaConfigurator configurator;
+    auto& table = configurator.CONFIGURE_TABLE(TableIds::Table1, "table1")
+      .COLUMN(Table1Cols::Id, "id", DataType::Integer).PRIMARY_KEY.NOT_NULL
+      .COLUMN_VARCHAR(Table1Cols::Text, "text", 128)
+      .COLUMN(Table1Cols::Number, "number", DataType::Integer)
+      .COLUMN(Table1Cols::Mandatory, "mandatory", DataType::Integer);
+
+    if (hasUniqueCols)
+    {
+      table.UNIQUE_COLS(Table1Cols::Text, Table1Cols::Mandatory);
+    }
+
+    m_db.initialize(configurator, Funcs::getDefaultDatabaseFilename());
+  }
+
+  std::map<int, std::pair<QString, int>> queryTuples()
+  {
+    std::map<int, std::pair<QString, int>> tuples;
+    auto results = m_db.execQuery(FROM_TABLE(TableIds::Table1)
+      .SELECT(Table1Cols::Id, Table1Cols::Text, Table1Cols::Number));
+
+    while (results.hasNextTuple())
+    {
+      const auto tuple = results.nextTuple();
+      tuples[tuple.columnValue(Table1Cols::Id).toInt()] = {
+        tuple.columnValue(Table1Cols::Text).toString(),
+        tuple.columnValue(Table1Cols::Number).toInt() };
+    }
+    return tuples;
+  }
+
+  QtSqlLib::Database m_db;
+
+};
+
+/**
+ * @test: Upserts tuples with existing and new primary keys, keeping the value of one column on conflicts.
+ * @expected: The existing tuple is updated except for the kept column, the new tuple is inserted.
+ */
+TEST_F(TestUpsert, primaryKeyConflict)
+{
+  setupTable1(false);
+
+  m_db.execQuery(INSERT_INTO(TableIds::Table1)
+    .VALUE(Table1Cols::Id, 1)
+    .VALUE(Table1Cols::Text, "a")
+    .VALUE(Table1Cols::Number, 1));
+
+  for (auto id=1; id<=2; ++id)
+  {
+    m_db.execQuery(UPSERT(TableIds::Table1)
+      .VALUE(Table1Cols::Id, id)
+      .VALUE(Table1Cols::Text, "b")
+      .VALUE(Table1Cols::Number, 5)
+      .KEEP(Table1Cols::Number));
+  }
+
+  const auto tuples = queryTuples();
+  ASSERT_EQ(tuples.size(), 2);
+  EXPECT_EQ(tuples.at(1), std::make_pair(QString("b"), 1));
+  EXPECT_EQ(tuples.at(2), std::make_pair(QString("b"), 5));
+
+  EXPECT_THROW(m_db.execQuery(UPSERT(TableIds::Table1)
+    .VALUE(Table1Cols::Id, 1)
+    .OVERWRITE(Table1Cols::Text)), DatabaseException);
+
+  EXPECT_THROW(m_db.execQuery(UPSERT(TableIds::Table1)
+    .VALUE(Table1Cols::Id, 1)
+    .ON_CONFLICT_UNIQUE_COLS), DatabaseException);
+}
+
+/**
+ * @test: Upserts tuples conflicting on the unique column set with different primary keys, overwriting a number
+ *        column only if the inserted number is greater than the existing one and less than a bound value.
+ * @expected: Conflicting tuples update the existing tuple instead of inserting a new one. The primary key of the
+ *            existing tuple is kept and the number is the maximum of the inserted numbers below the bound value.
+ */
+TEST_F(TestUpsert, uniqueColsConflict)
+{
+  setupTable1(true);
+
+  const std::vector<int> numbers { 2, 5, 3, 200 };
+  for (size_t i=0; i<numbers.size(); ++i)
+  {
+    m_db.execQuery(UPSERT(TableIds::Table1)
+      .VALUE(Table1Cols::Id, 10 + static_cast<int>(i))
+      .VALUE(Table1Cols::Text, "max")
+      .VALUE(Table1Cols::Mandatory, 1)
+      .VALUE(Table1Cols::Number, numbers[i])
+      .ON_CONFLICT_UNIQUE_COLS
+      .OVERWRITE_IF(Table1Cols::Number, GREATER_COL(EXCLUDED(Table1Cols::Number), Table1Cols::Number)
+        .AND.LESS(EXCLUDED(Table1Cols::Number), 100)));
+  }
+
+  const auto tuples = queryTuples();
+  ASSERT_EQ(tuples.size(), 1);
+  EXPECT_EQ(tuples.at(10), std::make_pair(QString("max"), 5));
+}
+
+/**
+ * @test: Upserts a batch of tuples of which some already exist, once ignoring and once overwriting conflicts.
+ *        Upserts a third batch overwriting a column only for tuples matching a condition with a bound value.
+ * @expected: Existing tuples are left untouched by the first and updated by the second batch.
+ *            New tuples are inserted. The third batch overwrites the conditional column of the matching tuple only.
+ */
+TEST_F(TestUpsert, batchUpsert)
+{
+  setupTable1(false);
+
+  m_db.execQuery(BATCH_INSERT_INTO(TableIds::Table1)
+    .VALUES(Table1Cols::Id, QVariantList() << 1 << 2)
+    .VALUES(Table1Cols::Text, QVariantList() << "a" << "b"));
+
+  m_db.execQuery(BATCH_UPSERT(TableIds::Table1)
+    .VALUES(Table1Cols::Id, QVariantList() << 2 << 3)
+    .VALUES(Table1Cols::Text, QVariantList() << "x" << "c")
+    .DO_NOTHING);
+
+  auto tuples = queryTuples();
+  ASSERT_EQ(tuples.size(), 3);
+  EXPECT_EQ(tuples.at(2).first, "b");
+  EXPECT_EQ(tuples.at(3).first, "c");
+
+  m_db.execQuery(BATCH_UPSERT(TableIds::Table1)
+    .VALUES(Table1Cols::Id, QVariantList() << 1 << 4)
+    .VALUES(Table1Cols::Text, QVariantList() << "y" << "d"));
+
+  tuples = queryTuples();
+  ASSERT_EQ(tuples.size(), 4);
+  EXPECT_EQ(tuples.at(1).first, "y");
+  EXPECT_EQ(tuples.at(4).first, "d");
+
+  m_db.execQuery(BATCH_UPSERT(TableIds::Table1)
+    .VALUES(Table1Cols::Id, QVariantList() << 1 << 2)
+    .VALUES(Table1Cols::Text, QVariantList() << "z" << "z")
+    .VALUES(Table1Cols::Number, QVariantList() << 7 << 7)
+    .OVERWRITE_IF(Table1Cols::Text, UNEQUAL(EXCLUDED(Table1Cols::Id), 2)));
+
+  tuples = queryTuples();
+  ASSERT_EQ(tuples.size(), 4);
+  EXPECT_EQ(tuples.at(1), std::make_pair(QString("z"), 7));
+  EXPECT_EQ(tuples.at(2), std::make_pair(QString("b"), 7));
+}
+
+}
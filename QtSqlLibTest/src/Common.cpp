@@ -2,14 +2,105 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <iterator>
+
 namespace QtSqlLibTest
 {
 
+void RecordingQueryObserver::onQueryExecuted(const QueryExecution& execution)
+{
+  executions.emplace_back(execution);
+}
+
+void RecordingQueryObserver::onResultIterationFinished(const ResultIteration& iteration)
+{
+  iterations.emplace_back(iteration);
+}
+
+std::vector<RecordingQueryObserver::QueryExecution> RecordingQueryObserver::executionsExcept(
+  const QString& queryPrefix) const
+{
+  std::vector<QueryExecution> result;
+  std::copy_if(executions.cbegin(), executions.cend(), std::back_inserter(result),
+    [&queryPrefix](const QueryExecution& execution) { return !execution.sqlQuery.startsWith(queryPrefix); });
+  return result;
+}
+
+size_t RecordingQueryObserver::numExecutions(const QString& queryPrefix) const
+{
+  return static_cast<size_t>(std::count_if(executions.cbegin(), executions.cend(),
+    [&queryPrefix](const QueryExecution& execution) { return execution.sqlQuery.startsWith(queryPrefix); }));
+}
+
+uint64_t RecordingQueryObserver::numRowsFetched() const
+{
+  uint64_t numRows = 0;
+  for (const auto& iteration : iterations)
+  {
+    numRows += iteration.numRowsFetched;
+  }
+  return numRows;
+}
+
+void RecordingQueryObserver::clear()
+{
+  executions.clear();
+  iterations.clear();
+}
+
 QString Funcs::getDefaultDatabaseFilename()
 {
   return "test.db";
 }
 
+void Funcs::configureAlbumsSchema(SchemaConfigurator& configurator)
+{
+  configurator.CONFIGURE_TABLE(TableIds::Albums, "albums")
+    .COLUMN(AlbumsCols::Id, "id", DataType::Integer).PRIMARY_KEY.AUTO_INCREMENT.NOT_NULL
+    .COLUMN_VARCHAR(AlbumsCols::Name, "name", 128).NOT_NULL;
+
+  configurator.CONFIGURE_TABLE(TableIds::Tracks, "tracks")
+    .COLUMN(TracksCols::Id, "id", DataType::Integer).PRIMARY_KEY.AUTO_INCREMENT.NOT_NULL
+    .COLUMN_VARCHAR(TracksCols::Name, "name", 128).NOT_NULL;
+
+  configurator.CONFIGURE_TABLE(TableIds::Artists, "artists")
+    .COLUMN(ArtistsCols::Id, "id", DataType::Integer).PRIMARY_KEY.AUTO_INCREMENT.NOT_NULL
+    .COLUMN_VARCHAR(ArtistsCols::Name, "name", 128).NOT_NULL;
+
+  configurator.CONFIGURE_RELATIONSHIP(Relationships::AlbumTracks, TableIds::Albums, TableIds::Tracks,
+    QtSqlLib::API::RelationshipType::OneToMany);
+  configurator.CONFIGURE_RELATIONSHIP(Relationships::AlbumArtists, TableIds::Albums, TableIds::Artists,
+    QtSqlLib::API::RelationshipType::ManyToMany);
+}
+
+void Funcs::insertArtistsAlbumsTracks(QtSqlLib::Database& db)
+{
+  std::vector<QtSqlLib::PrimaryKey> albumKeys;
+  for (const auto& name : { "album1", "album2" })
+  {
+    albumKeys.emplace_back(db.execQuery(INSERT_INTO_EXT(TableIds::Albums)
+      .VALUE(AlbumsCols::Name, name)
+      .RETURN_IDS).nextTuple().primaryKey());
+  }
+
+  const std::vector<std::pair<QString, size_t>> tracks { { "track1", 0 }, { "track2", 0 }, { "track3", 1 } };
+  for (const auto& track : tracks)
+  {
+    db.execQuery(INSERT_INTO_EXT(TableIds::Tracks)
+      .VALUE(TracksCols::Name, track.first)
+      .LINK_TO_ONE_TUPLE(Relationships::AlbumTracks, albumKeys[track.second]));
+  }
+
+  db.execQuery(INSERT_INTO_EXT(TableIds::Artists)
+    .VALUE(ArtistsCols::Name, "artist1")
+    .LINK_TO_MANY_TUPLES(Relationships::AlbumArtists, albumKeys));
+
+  db.execQuery(INSERT_INTO_EXT(TableIds::Artists)
+    .VALUE(ArtistsCols::Name, "artist2")
+    .LINK_TO_ONE_TUPLE(Relationships::AlbumArtists, albumKeys[0]));
+}
+
 size_t Funcs::numResults(QtSqlLib::ResultSet& results)
 {
   size_t counter = 0;
@@ -0,0 +1,87 @@
+#include <gtest/gtest.h>
+
+#include <QtSqlLib/PrimaryKey.h>
+
+#include <unordered_set>
+
+namespace QtSqlLibTest
+{
+
+using PrimaryKey = QtSqlLib::PrimaryKey;
+
+/**
+ * @test: Compares and hashes integer keys with one and two columns, stored with different integer types.
+ * @expected: Keys with equal values are equal and have the same hash, independent of the integer type.
+ *            Keys with different values or table ids are not equal and are ordered by their values.
+ */
+TEST(TestPrimaryKey, compareIntegerKeys)
+{
+  const PrimaryKey key1(0, { { 0, QVariant(1) } });
+  const PrimaryKey key2(0, { { 0, QVariant(static_cast<qlonglong>(1)) } });
+  const PrimaryKey key3(0, { { 0, QVariant(2) } });
+  const PrimaryKey key4(1, { { 0, QVariant(1) } });
+
+  EXPECT_TRUE(key1 == key2);
+  EXPECT_EQ(key1.hash(), key2.hash());
+  EXPECT_EQ(key1.value(0), QVariant(1));
+
+  EXPECT_TRUE(key1 != key3);
+  EXPECT_TRUE(key1 < key3);
+  EXPECT_TRUE(key1 != key4);
+  EXPECT_TRUE(key1 < key4);
+
+  const PrimaryKey compositeKey1(0, { { 0, QVariant(1) }, { 1, QVariant(2) } });
+  const PrimaryKey compositeKey2(0, { { 0, QVariant(1) }, { 1, QVariant(3) } });
+
+  EXPECT_TRUE(compositeKey1 < compositeKey2);
+  EXPECT_FALSE(compositeKey1 == compositeKey2);
+  EXPECT_EQ(compositeKey1.values().size(), 2);
+  EXPECT_EQ(compositeKey1.values().at(1).value, QVariant(2));
+}
+
+/**
+ * @test: Compares keys that cannot be stored inline, i.e. with text columns, null values or more than two columns.
+ * @expected: The keys are compared and hashed correctly and the null key is recognized.
+ */
+TEST(TestPrimaryKey, compareNonInlineKeys)
+{
+  const PrimaryKey textKey1(0, { { 0, QVariant("a") } });
+  const PrimaryKey textKey2(0, { { 0, QVariant("a") } });
+  const PrimaryKey textKey3(0, { { 0, QVariant("b") } });
+
+  EXPECT_TRUE(textKey1 == textKey2);
+  EXPECT_EQ(textKey1.hash(), textKey2.hash());
+  EXPECT_TRUE(textKey1 < textKey3);
+
+  const PrimaryKey largeKey1(0, { { 0, QVariant(1) }, { 1, QVariant(2) }, { 2, QVariant(3) } });
+  const PrimaryKey largeKey2(0, { { 0, QVariant(1) }, { 1, QVariant(2) }, { 2, QVariant(3) } });
+
+  EXPECT_TRUE(largeKey1 == largeKey2);
+  EXPECT_EQ(largeKey1.hash(), largeKey2.hash());
+  EXPECT_EQ(largeKey1.value(2), QVariant(3));
+
+  const PrimaryKey nullKey(0, { { 0, QVariant() } });
+
+  EXPECT_TRUE(nullKey.isNull());
+  EXPECT_TRUE(PrimaryKey().isNull());
+  EXPECT_FALSE(textKey1.isNull());
+  EXPECT_FALSE(largeKey1.isNull());
+}
+
+/**
+ * @test: Inserts equal and different keys into a hash set.
+ * @expected: Equal keys are only inserted once.
+ */
+TEST(TestPrimaryKey, hashSet)
+{
+  std::unordered_set<PrimaryKey> keys;
+
+  EXPECT_TRUE(keys.emplace(0, std::vector<PrimaryKey::ColumnValue> { { 0, QVariant(1) } }).second);
+  EXPECT_TRUE(keys.emplace(0, std::vector<PrimaryKey::ColumnValue> { { 0, QVariant(2) } }).second);
+  EXPECT_FALSE(keys.emplace(0, std::vector<PrimaryKey::ColumnValue> { { 0, QVariant(1) } }).second);
+  EXPECT_TRUE(keys.emplace(0, std::vector<PrimaryKey::ColumnValue> { { 0, QVariant("1") } }).second);
+
+  EXPECT_EQ(keys.size(), 3);
+}
+
+}